@@ -186,7 +186,7 @@ export const MOUSE_STATE_NAMES = ['IDLE', 'MOVING', 'RETURNING']
 export const ANIM_NAMES = ['ECG', 'EQ', 'Ghost', 'Matrix', 'Radar', 'None']
 
 /** Mouse style index to name mapping (matches firmware MOUSE_STYLE_NAMES[]) */
-export const MOUSE_STYLE_NAMES = ['Bezier', 'Brownian']
+export const MOUSE_STYLE_NAMES = ['Bezier', 'Brownian', 'Reach', 'Replay']
 
 /** Screensaver timeout index to name mapping (matches firmware SAVER_NAMES[]) */
 export const SAVER_NAMES = ['Never', '1 min', '5 min', '10 min', '15 min', '30 min']
@@ -0,0 +1,70 @@
+#ifndef GHOST_ALIAS_PURE_H
+#define GHOST_ALIAS_PURE_H
+
+#include <stdint.h>
+
+// ============================================================================
+// Alias-method weighted sampler (Vose) — built once from integer weights,
+// then each draw is one 32-bit random word and one table lookup, however
+// many outcomes there are.
+//
+// The draw splits the word by multiply-shift (as rng_below()): the high
+// part picks a column, the low part is the coin that keeps the column's
+// own outcome or takes its alias. Build is exact integer arithmetic, so
+// each outcome's probability is its weight share to within 2^-32.
+// Pure header — no Arduino dependencies (unit-tested on host).
+// ============================================================================
+
+template <uint8_t N>
+struct AliasTable {
+  uint8_t count;        // outcomes; 0 = no weight to draw from
+  uint32_t keep[N];     // Q32 chance a draw in column i stays on i
+  uint8_t alias[N];     // outcome taken otherwise
+};
+
+// Build from weights[0..count); false (and count 0) when count is 0 or
+// above N, or the weights sum to 0 or past 32 bits
+template <uint8_t N>
+inline bool alias_build(AliasTable<N>& t, const uint32_t* weights, uint8_t count) {
+  t.count = 0;
+  if (count == 0 || count > N) return false;
+  uint64_t total = 0;
+  for (uint8_t i = 0; i < count; i++) total += weights[i];
+  if (total == 0 || total > 0xFFFFFFFFu) return false;
+
+  // Column capacity is total; an outcome brings weight * count of it
+  uint64_t scaled[N];
+  uint8_t small[N], large[N];
+  uint8_t ns = 0, nl = 0;
+  for (uint8_t i = 0; i < count; i++) {
+    scaled[i] = (uint64_t)weights[i] * count;
+    if (scaled[i] < total) small[ns++] = i;
+    else large[nl++] = i;
+  }
+  // Top up each short column from a large outcome, which then goes back
+  // to whichever pile its remainder belongs in
+  while (ns > 0 && nl > 0) {
+    uint8_t s = small[--ns];
+    uint8_t l = large[--nl];
+    t.keep[s] = (uint32_t)((scaled[s] << 32) / total);
+    t.alias[s] = l;
+    scaled[l] -= total - scaled[s];
+    if (scaled[l] < total) small[ns++] = l;
+    else large[nl++] = l;
+  }
+  // Whatever is left fills its column exactly
+  while (nl > 0) { uint8_t l = large[--nl]; t.keep[l] = 0xFFFFFFFFu; t.alias[l] = l; }
+  while (ns > 0) { uint8_t s = small[--ns]; t.keep[s] = 0xFFFFFFFFu; t.alias[s] = s; }
+  t.count = count;
+  return true;
+}
+
+// Outcome index for one uniform 32-bit word; t.count must be non-zero
+template <uint8_t N>
+inline uint8_t alias_pick(const AliasTable<N>& t, uint32_t r) {
+  uint64_t m = (uint64_t)r * t.count;
+  uint8_t col = (uint8_t)(m >> 32);
+  return ((uint32_t)m < t.keep[col]) ? col : t.alias[col];
+}
+
+#endif // GHOST_ALIAS_PURE_H
@@ -0,0 +1,146 @@
+#include "bench.h"
+
+#if GHOST_BENCH
+
+#include "perf.h"
+#include "mouse_pure.h"
+#include "keys.h"
+#include "settings.h"
+#include "timing.h"
+
+#ifdef GHOST_PLATFORM_NATIVE
+  #include <time.h>
+#endif
+
+// ============================================================================
+// Micro-benchmarks — case table and timing
+// ============================================================================
+
+#ifdef GHOST_PLATFORM_NATIVE
+  // micros() is the simulated clock on host; time against the real one
+  #define BENCH_OPS_SCALE 20
+  static inline uint32_t benchTicks() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec);
+  }
+#else
+  // Op counts keep the whole !bench run well under 100 ms on a 64 MHz M4
+  #define BENCH_OPS_SCALE 1
+  static inline uint32_t benchTicks() { return perfCycles(); }
+#endif
+
+#define BENCH_REPEATS 3
+
+static volatile uint32_t benchSink;  // keeps checksums observable
+
+static uint32_t benchBezierEval(uint32_t ops) {
+  int32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+#if GHOST_MOTION_FIXED
+    acc += mouse_bezier_eval_q16(0, 60 << 8, 200 << 8, (i % 1024) << 6);
+#else
+    float t = (float)(i % 1024) / 1024.0f;
+    acc += mouse_bezier_eval(0, 60 << 8, 200 << 8, t);
+#endif
+  }
+  return (uint32_t)acc;
+}
+
+static uint32_t benchFormatMenuValue(uint32_t ops) {
+  uint8_t idx[MENU_ITEM_COUNT];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < MENU_ITEM_COUNT; i++) {
+    if (MENU_ITEMS[i].type == MENU_VALUE) idx[n++] = i;
+  }
+  if (n == 0) return 0;
+
+  char buf[32];
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    const MenuItem& item = MENU_ITEMS[idx[i % n]];
+    formatMenuValue(item.settingId, item.format, buf, sizeof(buf));
+    acc += (uint8_t)buf[0];
+  }
+  return acc;
+}
+
+static uint32_t benchFormatDuration(uint32_t ops) {
+  char buf[24];
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    formatDuration((i * 7919UL) % 7200000UL, buf, sizeof(buf));
+    acc += (uint8_t)buf[0];
+  }
+  return acc;
+}
+
+static uint32_t benchFormatUptime(uint32_t ops) {
+  char buf[24];
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    formatUptime(i * 86413UL, buf, sizeof(buf));
+    acc += (uint8_t)buf[0];
+  }
+  return acc;
+}
+
+struct BenchCase {
+  const char* name;
+  uint32_t (*fn)(uint32_t ops);
+  uint32_t ops;
+};
+
+static const BenchCase BENCH_CASES[] = {
+  { "mouse_bezier_eval",  benchBezierEval,         5000 },
+  { "timeToParam",        benchTimeToParam,        5000 },
+  { "planNextSweep",      benchPlanNextSweep,      1000 },
+  { "planNextReach",      benchPlanNextReach,      1000 },
+  { "evaluateBezierStep", benchBezierStep,         5000 },
+  { "selectWeightedMode", benchSelectWeightedMode, 2000 },
+  { "phaseDuration",      benchPhaseDuration,      2000 },
+  { "formatMenuValue",    benchFormatMenuValue,    500 },
+  { "formatDuration",     benchFormatDuration,     500 },
+  { "formatUptime",       benchFormatUptime,       500 },
+#ifndef GHOST_PLATFORM_NATIVE
+  { "jsonStatus",         benchJsonStatus,         50 },
+#endif
+};
+static const uint8_t BENCH_CASE_COUNT = sizeof(BENCH_CASES) / sizeof(BENCH_CASES[0]);
+
+void benchRun(BenchSink sink) {
+#ifndef GHOST_PLATFORM_NATIVE
+  perfCounterInit();
+#endif
+  for (uint8_t c = 0; c < BENCH_CASE_COUNT; c++) {
+    const BenchCase& bc = BENCH_CASES[c];
+    uint32_t ops = bc.ops * BENCH_OPS_SCALE;
+    uint32_t best = 0xFFFFFFFFu;
+    for (uint8_t r = 0; r < BENCH_REPEATS; r++) {
+      uint32_t t0 = benchTicks();
+      benchSink += bc.fn(ops);
+      uint32_t dt = benchTicks() - t0;
+      if (dt < best) best = dt;
+    }
+    BenchResult res = { bc.name, ops, best };
+    sink(res);
+  }
+}
+
+const char* benchTickUnit() {
+#ifdef GHOST_PLATFORM_NATIVE
+  return "ns";
+#else
+  return "cyc";
+#endif
+}
+
+void benchFormat(const BenchResult& r, char* buf, size_t bufSize) {
+  // perOp with one decimal, integer math only (no printf float on nRF52)
+  uint32_t tenths = r.ops ? (uint32_t)(((uint64_t)r.ticks * 10 + r.ops / 2) / r.ops) : 0;
+  snprintf(buf, bufSize, "name=%s|ops=%lu|%s=%lu|perOp=%lu.%lu", r.name,
+           (unsigned long)r.ops, benchTickUnit(), (unsigned long)r.ticks,
+           (unsigned long)(tenths / 10), (unsigned long)(tenths % 10));
+}
+
+#endif // GHOST_BENCH
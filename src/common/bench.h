@@ -0,0 +1,47 @@
+#ifndef GHOST_BENCH_H
+#define GHOST_BENCH_H
+
+#include "config.h"
+
+// ============================================================================
+// Micro-benchmarks for the hot paths of the HID tick, menu and protocol code
+// Build with -DGHOST_BENCH=1. On target, !bench runs every case once and
+// reports CPU cycles (perfCycles()); on host (pio run -e bench) the same
+// table is timed with the monotonic clock and reported in nanoseconds.
+// Each case is run three times and the fastest run is kept.
+// ============================================================================
+
+#if GHOST_BENCH
+
+struct BenchResult {
+  const char* name;
+  uint32_t ops;     // iterations per run
+  uint32_t ticks;   // fastest run: cycles on target, ns on host
+};
+
+typedef void (*BenchSink)(const BenchResult& r);
+
+// Run the whole table, calling sink once per case
+void benchRun(BenchSink sink);
+
+// Unit of BenchResult::ticks ("cyc" or "ns")
+const char* benchTickUnit();
+
+// "name=..|ops=..|cyc=..|perOp=12.3" (unit key follows benchTickUnit())
+void benchFormat(const BenchResult& r, char* buf, size_t bufSize);
+
+// Case bodies that need file-static code live next to it. Each runs `ops`
+// iterations and returns a checksum so the work cannot be optimized away.
+uint32_t benchTimeToParam(uint32_t ops);         // mouse.cpp
+uint32_t benchPlanNextSweep(uint32_t ops);       // mouse.cpp
+uint32_t benchPlanNextReach(uint32_t ops);       // mouse.cpp
+uint32_t benchBezierStep(uint32_t ops);          // mouse.cpp
+uint32_t benchSelectWeightedMode(uint32_t ops);  // orchestrator.cpp
+uint32_t benchPhaseDuration(uint32_t ops);       // orchestrator.cpp
+#ifndef GHOST_PLATFORM_NATIVE
+uint32_t benchJsonStatus(uint32_t ops);          // platform protocol.cpp
+#endif
+
+#endif // GHOST_BENCH
+
+#endif // GHOST_BENCH_H
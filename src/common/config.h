@@ -13,7 +13,9 @@
 #define SETTINGS_MAGIC 0x50524F63  // bumped: added displayFlip
 #define STATS_MAGIC    0x53544132  // "STA2" — lifetime stats file (bumped: added totalMouseClicks)
 #define STATS_FILE     "/stats.dat"
+#define MOUSE_TRACE_FILE_FMT "/mtrace%u.bin"  // recorded mouse trace slots (mouse_trace_pure.h)
 #define STATS_SAVE_INTERVAL_MS 900000UL   // 15 minutes — periodic flash save for stats counters
+#define SETTINGS_SAVE_DEBOUNCE_MS 5000UL  // deferred settings save after the last change
 #define PIXELS_PER_FOOT       1152UL     // 96 px/in * 12 in/ft
 #define PIXELS_PER_METER      3780UL     // 96 px/in * 39.37 in/m
 #define PIXELS_PER_TENTH_MILE 608256UL   // 96 px/in * 63360 in/mi / 10
@@ -48,6 +50,14 @@
   #define HAS_ENCODER       0
   #define HAS_TOUCH         1
   #define HAS_NEOPIXEL      0
+#elif defined(GHOST_PLATFORM_NATIVE)
+  // Host simulator (src/native/) — HID reports go to a recording sink
+  #define HAS_BATTERY       0
+  #define HAS_SOUND         0
+  #define HAS_USB_HID       1
+  #define HAS_ENCODER       0
+  #define HAS_TOUCH         0
+  #define HAS_NEOPIXEL      0
 #else // GHOST_PLATFORM_NRF52 or default
   #define HAS_BATTERY       1
   #define HAS_SOUND         1
@@ -57,6 +67,31 @@
   #define HAS_NEOPIXEL      0
 #endif
 
+// Loop stage profiler (perf.h) — off unless the build adds -DGHOST_PERF=1
+#ifndef GHOST_PERF
+  #define GHOST_PERF        0
+#endif
+
+// Micro-benchmarks (bench.h) — !bench command, off unless -DGHOST_BENCH=1
+#ifndef GHOST_BENCH
+  #define GHOST_BENCH       0
+#endif
+
+// Mouse motion math (mouse_pure.h) — 1 = integer fixed-point, 0 = float.
+// Fixed by default on the ESP32-C6, whose RISC-V core has no FPU.
+#ifndef GHOST_MOTION_FIXED
+  #if defined(GHOST_PLATFORM_C6)
+    #define GHOST_MOTION_FIXED 1
+  #else
+    #define GHOST_MOTION_FIXED 0
+  #endif
+#endif
+
+// HID report trace ring (hid_trace.h) — 8 bytes per record, 0 removes it
+#ifndef HID_TRACE_RECORDS
+  #define HID_TRACE_RECORDS 512
+#endif
+
 // ============================================================================
 // DISPLAY CONFIGURATION
 // ============================================================================
@@ -136,9 +171,12 @@
 #define MIN_CLAMP_MS          500UL
 
 #define MOUSE_MOVE_STEP_MS    20
-#define MOUSE_STYLE_COUNT     2       // Bezier, Brownian
+#define MOTION_LEAD_MS        MOUSE_MOVE_STEP_MS        // steps are planned this far ahead of their due time
+#define MOTION_MAX_LATE_MS    (4 * MOUSE_MOVE_STEP_MS)  // catch up at most this much; further behind, restart the grid
+#define MOUSE_STYLE_COUNT     4       // Bezier, Brownian, Reach, Replay
 #define SCROLL_INTERVAL_MIN_MS  2000
 #define SCROLL_INTERVAL_MAX_MS  5000
+#define SCROLL_RAMP_STEPS       10      // hi-res wheel: one detent eased over this many MOUSE_MOVE_STEP_MS
 
 // Bezier sweep constants
 #define SWEEP_PAUSE_MIN_MS    200
@@ -148,9 +186,29 @@
 #define SWEEP_SPEED_MIN       80      // px/sec
 #define SWEEP_SPEED_MAX       200     // px/sec
 #define SWEEP_DRIFT_FACTOR    3
+#define SWEEP_DURATION_MIN_MS 150
+#define SWEEP_DURATION_MAX_MS 3000
+#define SWEEP_MAX_STEPS       (SWEEP_DURATION_MAX_MS / MOUSE_MOVE_STEP_MS)  // pre-planned delta buffer size
+#define RETURN_DURATION_MAX_MS  1500  // curved return-to-origin always ends within this
+#define RETURN_WAIT_CAP_MS      2000  // orchestrator stops waiting on a return after this
+#define RETURN_BOW_DIVISOR      6     // return control point bows off the chord by dist/6
+
+// Reach style (mouseStyle 2) — minimum-jerk moves timed by Fitts' law
+#define REACH_FITTS_A_MS        100   // MT = a + b * log2(D / W + 1)
+#define REACH_FITTS_B_MS        120
+#define REACH_WIDTH_MIN         8     // random target width W (px)
+#define REACH_WIDTH_MAX         40
+#define REACH_OVERSHOOT_PCT     30    // chance a reach overshoots and corrects
+#define REACH_OVERSHOOT_MIN     3     // overshoot, % of reach distance
+#define REACH_OVERSHOOT_MAX     8
+
+// Replay style (mouseStyle 3) — recorded traces in flash (slots/format: mouse_trace_pure.h)
+#define MOUSE_TRACE_SCALE_MIN_PCT 80  // random playback time scale per trace
+#define MOUSE_TRACE_SCALE_MAX_PCT 125
 #define DISPLAY_UPDATE_MS     50          // 20 Hz (dirty flag skips I2C when idle)
 #define DISPLAY_UPDATE_SAVER_MS  200     // 5 Hz during screensaver (power saving)
 #define BATTERY_READ_MS       60000UL
+#define LOOP_IDLE_MAX_MS      100         // longest loop() sleep when nothing is due (USB state is polled)
 #define SLEEP_CONFIRM_THRESHOLD_MS  500   // Hold before showing confirmation
 #define SLEEP_COUNTDOWN_MS          6000  // Total countdown duration (light + deep)
 #define SLEEP_LIGHT_THRESHOLD_MS    3000  // Midpoint: release after this = light sleep
@@ -219,6 +277,8 @@
 #define BLE_IDLE_THRESHOLD_MS     5000  // enter idle after 5s of no HID
 #define BLE_IDLE_CHECK_MS         2000  // check for idle transition every 2s
 #define BLE_HID_FAIL_THRESHOLD    5     // consecutive notify failures before forced reconnect
+#define BLE_INTERVAL_MS(units)    ((uint16_t)((units) * 5 / 4))  // 1.25ms units -> ms
+#define USB_HID_POLL_MS           2     // HID endpoint bInterval (ms)
 
 // BLE device name character set
 #define NAME_CHAR_COUNT  65   // printable characters
@@ -302,6 +362,7 @@ enum MenuValueFormat { FMT_DURATION_MS, FMT_PERCENT, FMT_PERCENT_NEG, FMT_SAVER_
 enum ScheduleMode { SCHED_OFF, SCHED_AUTO_SLEEP, SCHED_FULL_AUTO, SCHED_MODE_COUNT };
 enum Profile { PROFILE_LAZY, PROFILE_NORMAL, PROFILE_BUSY, PROFILE_COUNT };
 enum MouseState { MOUSE_IDLE, MOUSE_JIGGLING, MOUSE_RETURNING };
+enum MouseStyle { MOUSE_STYLE_BEZIER, MOUSE_STYLE_BROWNIAN, MOUSE_STYLE_REACH, MOUSE_STYLE_REPLAY };
 enum FooterMode { FOOTER_CLOCK, FOOTER_UPTIME, FOOTER_VERSION, FOOTER_DIETEMP, FOOTER_MODE_COUNT };
 
 // Simulation mode enums
@@ -419,7 +480,7 @@ struct Settings {
   uint8_t saverBrightness; // 10-100 in steps of 10, default 20
   uint8_t displayBrightness; // 10-100 in steps of 10, default 80
   uint8_t mouseAmplitude;  // 1-5, step 1, default 1 (pixels per movement step)
-  uint8_t mouseStyle;      // 0=Bezier, 1=Brownian (default 0)
+  uint8_t mouseStyle;      // 0=Bezier, 1=Brownian, 2=Reach, 3=Replay (default 0)
   uint8_t animStyle;       // 0-5 index into ANIM_NAMES[] (default 2 = Ghost)
   char    deviceName[15]; // 14 chars + null terminator (BLE device name)
   uint8_t btWhileUsb;     // 0=Off (default), 1=On — keep BLE active when USB connected
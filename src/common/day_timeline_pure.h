@@ -0,0 +1,56 @@
+#ifndef GHOST_DAY_TIMELINE_PURE_H
+#define GHOST_DAY_TIMELINE_PURE_H
+
+#include <stdint.h>
+
+// ============================================================================
+// Day timeline — prefix sums of a day template's scaled block durations, so
+// a block's span is two reads and the block holding a time of day is a
+// binary search instead of a walk over every block.
+// Pure header — no Arduino dependencies (unit-tested on host).
+// ============================================================================
+
+template <uint8_t N>
+struct DayTimeline {
+  uint8_t numBlocks;
+  uint16_t endMin[N];   // minutes from job start to the end of block i (non-decreasing)
+};
+
+// Accumulate durMin[0..n) (minutes; 0 for a skipped block)
+template <uint8_t N>
+inline void timeline_build(DayTimeline<N>& t, const uint16_t* durMin, uint8_t n) {
+  if (n > N) n = N;
+  uint16_t cumulative = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    cumulative += durMin[i];
+    t.endMin[i] = cumulative;
+  }
+  t.numBlocks = n;
+}
+
+// Start of block i in minutes from job start (i == numBlocks: end of day)
+template <uint8_t N>
+inline uint16_t timeline_start(const DayTimeline<N>& t, uint8_t i) {
+  return (i == 0) ? 0 : t.endMin[i - 1];
+}
+
+template <uint8_t N>
+inline uint16_t timeline_duration(const DayTimeline<N>& t, uint8_t i) {
+  if (i >= t.numBlocks) return 0;
+  return t.endMin[i] - timeline_start(t, i);
+}
+
+// Block holding offsetMin: the first whose end lies past it, so a
+// zero-length block is never returned. numBlocks when past the last block.
+template <uint8_t N>
+inline uint8_t timeline_find(const DayTimeline<N>& t, uint32_t offsetMin) {
+  uint8_t lo = 0, hi = t.numBlocks;
+  while (lo < hi) {
+    uint8_t mid = (uint8_t)((lo + hi) / 2);
+    if (offsetMin < t.endMin[mid]) hi = mid;
+    else lo = (uint8_t)(mid + 1);
+  }
+  return lo;
+}
+
+#endif // GHOST_DAY_TIMELINE_PURE_H
@@ -0,0 +1,47 @@
+#include "hid_emit.h"
+#include "hid_emit_pure.h"
+#include "state.h"
+#include "mouse.h"
+#include "orchestrator.h"
+#include "platform_hal.h"
+#include "timers.h"
+
+// ============================================================================
+// HID emitter — see hid_emit.h
+// ============================================================================
+
+bool hidEmitService(unsigned long now, unsigned long& nextDueMs) {
+  timersRun(now);       // release / LED timers (keystroke, click, window switch)
+  flushQueuedMouseMoves(now);
+  return hidEmitDeadline(now, nextDueMs);
+}
+
+bool hidEmitDeadline(unsigned long now, unsigned long& dueMs) {
+  unsigned long mouseDue, timerDue;
+  bool any = false;
+  uint32_t due = 0;
+  if (mouseEmitDeadline(now, mouseDue)) hid_deadline_fold(any, due, (uint32_t)mouseDue);
+  if (timersDeadline(timerDue))         hid_deadline_fold(any, due, (uint32_t)timerDue);
+  if (any) dueMs = due;
+  return any;
+}
+
+// Same dispatch as the loop()s: orchestrator, or Simple mode's key timer
+// and mouse state machine
+bool hidPlanDeadline(unsigned long now, unsigned long& dueMs) {
+  if (settings.operationMode == OP_SIMULATION) {
+    dueMs = orchestratorDeadline(now);
+    return true;
+  }
+  bool any = false;
+  uint32_t due = 0;
+  unsigned long mouseDue;
+  if (keyEnabled && hasPopulatedSlot()) {
+    hid_deadline_fold(any, due, (uint32_t)(lastKeyTime + currentKeyInterval));
+  }
+  if (mouseEnabled && mouseStateDeadline(now, mouseDue)) {
+    hid_deadline_fold(any, due, (uint32_t)mouseDue);
+  }
+  if (any) dueMs = due;
+  return any;
+}
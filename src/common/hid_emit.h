@@ -0,0 +1,33 @@
+#ifndef GHOST_HID_EMIT_H
+#define GHOST_HID_EMIT_H
+
+#include "config.h"
+
+// ============================================================================
+// HID emitter
+// loop() only plans HID work: mouse steps with their due times (motion.h),
+// key / click / window-switch presses that arm a release timer. A platform
+// emitter woken by a hardware-timed wait (FreeRTOS tick on the nRF52 RTC,
+// esp_timer on ESP32) runs hidEmitService() at each deadline, so reports
+// leave on time even while loop() sits in a display flush or delay().
+// On the host, hostLoop() calls it once per simulated millisecond.
+//
+// loop()'s planning section and the emitter hold hidEmitLock() (platform
+// hid.cpp) while touching HID state; loop() calls hidEmitKick() after
+// planning so the emitter re-arms for anything new.
+// ============================================================================
+
+// Send everything due at now (mouse steps / coalesced report, release
+// timers). Returns false if nothing is pending; otherwise nextDueMs is the
+// earliest time with further work.
+bool hidEmitService(unsigned long now, unsigned long& nextDueMs);
+
+// Earliest time the emitter has work, without sending anything
+bool hidEmitDeadline(unsigned long now, unsigned long& dueMs);
+
+// Earliest time loop()'s HID planning has work: the orchestrator in
+// Simulation mode, otherwise the Simple mode key timer and mouse state
+// machine. Between deadlines loop() can sleep instead of polling.
+bool hidPlanDeadline(unsigned long now, unsigned long& dueMs);
+
+#endif // GHOST_HID_EMIT_H
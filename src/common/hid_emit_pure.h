@@ -0,0 +1,116 @@
+#ifndef GHOST_HID_EMIT_PURE_H
+#define GHOST_HID_EMIT_PURE_H
+
+#include <stdint.h>
+
+// ============================================================================
+// HID emission timing — timed step queue and drift-free cadence
+// loop() plans mouse steps a little ahead with their due times; the platform
+// emitter (hid_emit.h) hands them to the report coalescer once due. Times
+// are millis() values compared through signed differences, so everything
+// stays correct across the 49.7-day wrap.
+// Pure header — no Arduino dependencies (unit-tested on host).
+// ============================================================================
+
+#define HID_EMIT_QUEUE_LEN  16
+
+// now has reached (or passed) due
+inline bool hid_time_reached(uint32_t now, uint32_t due) {
+  return (int32_t)(now - due) >= 0;
+}
+
+inline bool hid_time_before(uint32_t a, uint32_t b) {
+  return (int32_t)(a - b) < 0;
+}
+
+// Fold one candidate into a running earliest deadline (any = one is set)
+inline void hid_deadline_fold(bool& any, uint32_t& earliest, uint32_t t) {
+  if (!any || hid_time_before(t, earliest)) earliest = t;
+  any = true;
+}
+
+// ---------------------------------------------------------------------------
+// Timed step queue (FIFO — the cadence hands out due times in order)
+// ---------------------------------------------------------------------------
+
+struct HidTimedStep {
+  uint32_t dueMs;
+  int16_t dx, dy;
+};
+
+struct HidStepQueue {
+  HidTimedStep slot[HID_EMIT_QUEUE_LEN];
+  uint8_t head;
+  uint8_t count;
+};
+
+inline int16_t hid_step_sat(int32_t v) {
+  return (int16_t)(v > 32767 ? 32767 : (v < -32767 ? -32767 : v));
+}
+
+// Append a step. A due time earlier than the tail's is raised to it, so the
+// queue stays ordered. When full, the step rides with the newest entry
+// (saturating at +/-32767 — far beyond any step the planners produce).
+inline void hid_step_push(HidStepQueue& q, uint32_t dueMs, int16_t dx, int16_t dy) {
+  if (q.count > 0) {
+    HidTimedStep& tail = q.slot[(q.head + q.count - 1) % HID_EMIT_QUEUE_LEN];
+    if (hid_time_before(dueMs, tail.dueMs)) dueMs = tail.dueMs;
+    if (q.count == HID_EMIT_QUEUE_LEN) {
+      tail.dx = hid_step_sat((int32_t)tail.dx + dx);
+      tail.dy = hid_step_sat((int32_t)tail.dy + dy);
+      return;
+    }
+  }
+  HidTimedStep& s = q.slot[(q.head + q.count) % HID_EMIT_QUEUE_LEN];
+  s.dueMs = dueMs;
+  s.dx = dx;
+  s.dy = dy;
+  q.count++;
+}
+
+inline bool hid_step_pending(const HidStepQueue& q) {
+  return q.count > 0;
+}
+
+// Due time of the oldest step; false when empty
+inline bool hid_step_next_due(const HidStepQueue& q, uint32_t& dueMs) {
+  if (q.count == 0) return false;
+  dueMs = q.slot[q.head].dueMs;
+  return true;
+}
+
+// Pop the oldest step if it is due at now
+inline bool hid_step_pop_due(HidStepQueue& q, uint32_t now, int16_t& dx, int16_t& dy) {
+  if (q.count == 0 || !hid_time_reached(now, q.slot[q.head].dueMs)) return false;
+  dx = q.slot[q.head].dx;
+  dy = q.slot[q.head].dy;
+  q.head = (uint8_t)((q.head + 1) % HID_EMIT_QUEUE_LEN);
+  q.count--;
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+// Drift-free cadence — lastDueMs advances by whole periods, never to "now",
+// so a late tick does not push every later step back. Steps up to leadMs
+// ahead are handed out early, giving the emitter slack over a slow loop().
+// More than maxLateMs behind (stalled loop, state just re-entered with a
+// stale timer), the grid restarts at now instead of bursting the backlog.
+// Returns true with the next step's due time, false when none is due yet.
+// ---------------------------------------------------------------------------
+
+inline bool hid_cadence_next(uint32_t& lastDueMs, uint32_t now, uint32_t periodMs,
+                             uint32_t leadMs, uint32_t maxLateMs, uint32_t& dueMs) {
+  uint32_t due = lastDueMs + periodMs;
+  if (hid_time_before(due + maxLateMs, now)) due = now;
+  if (!hid_time_reached(now + leadMs, due)) return false;
+  lastDueMs = due;
+  dueMs = due;
+  return true;
+}
+
+// When hid_cadence_next() next hands out a step (the planner's wake time)
+inline uint32_t hid_cadence_plan_at(uint32_t lastDueMs, uint32_t periodMs, uint32_t leadMs) {
+  return lastDueMs + periodMs - leadMs;
+}
+
+#endif // GHOST_HID_EMIT_PURE_H
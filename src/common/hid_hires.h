@@ -0,0 +1,52 @@
+#ifndef GHOST_HID_HIRES_H
+#define GHOST_HID_HIRES_H
+
+#include <stdint.h>
+
+// ============================================================================
+// High-resolution wheel (HID Usage Tables §4.3.1, Resolution Multiplier)
+// The mouse report keeps its int8 Wheel byte; a 1-byte feature report on the
+// same report ID lets the host switch that byte from detents to 1/MULT-detent
+// units. Hosts that never write the feature (or ignore it) keep reading whole
+// detents, so the default is the old behavior.
+// Pure header — no Arduino dependencies (unit-tested on host).
+// ============================================================================
+
+#define HIRES_SCROLL_MULTIPLIER  8     // wheel units per detent once enabled
+
+// Drop-in replacement for a "Usage (Wheel), Input (Data, Var, Rel)" item
+// inside a mouse Physical collection. Usage Page must be Generic Desktop on
+// entry; leaves Logical -127..127, Report Size 8, Count 1, Physical 0 behind.
+// Feature layout: bits 0-1 = multiplier (0 = detents, 1 = MULT), bits 2-7 pad.
+#define GHOST_HID_DESC_HIRES_WHEEL \
+  0xA1, 0x02,                     /* Collection (Logical)                 */ \
+  0x09, 0x48,                     /*   Usage (Resolution Multiplier)      */ \
+  0x15, 0x00,                     /*   Logical Minimum (0)                */ \
+  0x25, 0x01,                     /*   Logical Maximum (1)                */ \
+  0x35, 0x01,                     /*   Physical Minimum (1)               */ \
+  0x45, HIRES_SCROLL_MULTIPLIER,  /*   Physical Maximum (MULT)            */ \
+  0x75, 0x02,                     /*   Report Size (2)                    */ \
+  0x95, 0x01,                     /*   Report Count (1)                   */ \
+  0xB1, 0x02,                     /*   Feature (Data, Variable, Absolute) */ \
+  0x35, 0x00,                     /*   Physical Minimum (0)               */ \
+  0x45, 0x00,                     /*   Physical Maximum (0)               */ \
+  0x75, 0x06,                     /*   Report Size (6)                    */ \
+  0xB1, 0x01,                     /*   Feature (Constant) — Padding       */ \
+  0x09, 0x38,                     /*   Usage (Wheel)                      */ \
+  0x15, 0x81,                     /*   Logical Minimum (-127)             */ \
+  0x25, 0x7F,                     /*   Logical Maximum (127)              */ \
+  0x75, 0x08,                     /*   Report Size (8)                    */ \
+  0x81, 0x06,                     /*   Input (Data, Variable, Relative)   */ \
+  0xC0                            /* End Collection                       */
+
+// Wheel units per detent for a feature byte the host wrote
+inline uint8_t hid_hires_units(uint8_t feature) {
+  return (feature & 0x03) ? HIRES_SCROLL_MULTIPLIER : 1;
+}
+
+// Feature byte that reads back the current resolution (GET_REPORT)
+inline uint8_t hid_hires_feature(uint8_t units) {
+  return (units > 1) ? 1 : 0;
+}
+
+#endif // GHOST_HID_HIRES_H
@@ -0,0 +1,108 @@
+#include "hid_trace.h"
+
+#if HID_TRACE_RECORDS > 0
+
+// ============================================================================
+// HID report trace — ring storage and base64 dump
+// ============================================================================
+
+static HidTraceRecord traceRing[HID_TRACE_RECORDS];
+static uint16_t traceHead = 0;   // next write slot
+static uint16_t traceCount = 0;
+static uint32_t traceDropped = 0;
+
+static void tracePush(const HidTraceRecord& r) {
+  traceRing[traceHead] = r;
+  traceHead = (traceHead + 1) % HID_TRACE_RECORDS;
+  if (traceCount < HID_TRACE_RECORDS) traceCount++;
+  else traceDropped++;
+}
+
+void hidTraceKeyboard(uint8_t flags, uint8_t modifier, const uint8_t keycodes[6]) {
+  HidTraceRecord r;
+  r.us = micros();
+  r.meta = (uint8_t)(HID_TRACE_KEYBOARD | (flags & HID_TRACE_FLAG_MASK));
+  r.p[0] = modifier;
+  r.p[1] = keycodes[0];
+  r.p[2] = keycodes[1];
+  tracePush(r);
+}
+
+void hidTraceMouse(uint8_t flags, uint8_t buttons, int8_t dx, int8_t dy, int8_t wheel) {
+  tracePush(hid_trace_mouse_record(micros(), flags, buttons, dx, dy, wheel));
+}
+
+void hidTraceConsumer(uint8_t flags, uint16_t usage) {
+  HidTraceRecord r;
+  r.us = micros();
+  r.meta = (uint8_t)(HID_TRACE_CONSUMER | (flags & HID_TRACE_FLAG_MASK));
+  r.p[0] = (uint8_t)usage;
+  r.p[1] = (uint8_t)(usage >> 8);
+  r.p[2] = 0;
+  tracePush(r);
+}
+
+void hidTraceReset() {
+  traceHead = 0;
+  traceCount = 0;
+  traceDropped = 0;
+}
+
+uint16_t hidTraceCount() { return traceCount; }
+uint32_t hidTraceDropped() { return traceDropped; }
+
+HidTraceRecord hidTraceAt(uint16_t i) {
+  uint16_t oldest = (traceCount < HID_TRACE_RECORDS) ? 0 : traceHead;
+  return traceRing[(oldest + i) % HID_TRACE_RECORDS];
+}
+
+// ----------------------------------------------------------------------------
+// Base64 line encoder — 57 raw bytes per 76-char line
+// ----------------------------------------------------------------------------
+
+static const char B64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static uint8_t b64Buf[57];
+static uint8_t b64Pos;
+
+static void b64FlushLine(void (*writeLine)(const char*)) {
+  if (b64Pos == 0) return;
+  char line[77];
+  uint8_t o = 0;
+  for (uint8_t i = 0; i < b64Pos; i += 3) {
+    uint8_t remaining = b64Pos - i;
+    uint32_t n = (uint32_t)b64Buf[i] << 16;
+    if (remaining > 1) n |= (uint32_t)b64Buf[i + 1] << 8;
+    if (remaining > 2) n |= b64Buf[i + 2];
+    line[o++] = B64[(n >> 18) & 0x3F];
+    line[o++] = B64[(n >> 12) & 0x3F];
+    line[o++] = (remaining > 1) ? B64[(n >> 6) & 0x3F] : '=';
+    line[o++] = (remaining > 2) ? B64[n & 0x3F] : '=';
+  }
+  line[o] = '\0';
+  writeLine(line);
+  b64Pos = 0;
+}
+
+static void b64Write(const uint8_t* data, uint8_t len, void (*writeLine)(const char*)) {
+  for (uint8_t i = 0; i < len; i++) {
+    b64Buf[b64Pos++] = data[i];
+    if (b64Pos == sizeof(b64Buf)) b64FlushLine(writeLine);
+  }
+}
+
+void hidTraceDump(void (*writeLine)(const char* line)) {
+  uint8_t buf[HID_TRACE_HEADER_SIZE];
+  b64Pos = 0;
+
+  writeLine("--- HIDTRACE START ---");
+  hid_trace_put_header(buf, traceCount, traceDropped);
+  b64Write(buf, HID_TRACE_HEADER_SIZE, writeLine);
+  for (uint16_t i = 0; i < traceCount; i++) {
+    hid_trace_put_record(buf, hidTraceAt(i));
+    b64Write(buf, HID_TRACE_RECORD_SIZE, writeLine);
+  }
+  b64FlushLine(writeLine);
+  writeLine("--- HIDTRACE END ---");
+}
+
+#endif // HID_TRACE_RECORDS
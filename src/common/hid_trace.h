@@ -0,0 +1,49 @@
+#ifndef GHOST_HID_TRACE_H
+#define GHOST_HID_TRACE_H
+
+#include "config.h"
+#include "hid_trace_pure.h"
+
+// ============================================================================
+// HID report trace
+// Fixed ring of the last HID_TRACE_RECORDS reports handed to a transport,
+// stamped with micros(). Platform hid.cpp calls the record hooks right where
+// each report leaves; serial 'i' / !hidtrace dump the ring as base64 between
+// "--- HIDTRACE START ---" / "--- HIDTRACE END ---" for
+// tools/hid_trace_decode.cpp. Format: hid_trace_pure.h.
+// Records come from loop() and the HID emitter (hid_emit.h); both hold
+// hidEmitLock(), and so does the dump (loop()'s serial / NUS handlers).
+// ============================================================================
+
+#if HID_TRACE_RECORDS > 0
+
+// flags: HID_TRACE_BLE / HID_TRACE_USB / HID_TRACE_BLE_FAIL
+void hidTraceKeyboard(uint8_t flags, uint8_t modifier, const uint8_t keycodes[6]);
+void hidTraceMouse(uint8_t flags, uint8_t buttons, int8_t dx, int8_t dy, int8_t wheel);
+void hidTraceConsumer(uint8_t flags, uint16_t usage);
+
+void hidTraceReset();
+
+// Records currently held / records overwritten since the last reset
+uint16_t hidTraceCount();
+uint32_t hidTraceDropped();
+
+// i-th held record, 0 = oldest
+HidTraceRecord hidTraceAt(uint16_t i);
+
+// Write header + records as framed base64 lines (76 chars each)
+void hidTraceDump(void (*writeLine)(const char* line));
+
+#else
+
+static inline void hidTraceKeyboard(uint8_t, uint8_t, const uint8_t*) {}
+static inline void hidTraceMouse(uint8_t, uint8_t, int8_t, int8_t, int8_t) {}
+static inline void hidTraceConsumer(uint8_t, uint16_t) {}
+static inline void hidTraceReset() {}
+static inline uint16_t hidTraceCount() { return 0; }
+static inline uint32_t hidTraceDropped() { return 0; }
+static inline HidTraceRecord hidTraceAt(uint16_t) { return HidTraceRecord(); }
+
+#endif // HID_TRACE_RECORDS
+
+#endif // GHOST_HID_TRACE_H
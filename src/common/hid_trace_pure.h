@@ -0,0 +1,154 @@
+#ifndef GHOST_HID_TRACE_PURE_H
+#define GHOST_HID_TRACE_PURE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================================================
+// HID trace wire format (shared by firmware dump and tools/hid_trace_decode)
+//
+// Dump = 12-byte header + count records, oldest first, all little-endian.
+//   Header:  'G' 'H' 'T' version | record size | reserved | count u16 | dropped u32
+//   Record:  time_us u32 | meta | p0 p1 p2
+//     meta bits 0-2 type, bit 4 sent on BLE, bit 5 sent on USB,
+//     bit 6 BLE notify failed. No transport bits = report had nowhere to go.
+//     Payload by type:
+//       KEYBOARD  modifier, key1, key2
+//       MOUSE     dx, dy, buttons       (wheel == 0)
+//       SCROLL    wheel, buttons, 0
+//       CONSUMER  usage lo, usage hi, 0
+// time_us wraps every ~71.6 min; decoders take deltas modulo 2^32.
+// ============================================================================
+
+#define HID_TRACE_VERSION      1
+#define HID_TRACE_HEADER_SIZE  12
+#define HID_TRACE_RECORD_SIZE  8
+#define HID_TRACE_B64_LINE_MAX 76   // dump line: 57 bytes as base64
+
+enum HidTraceType {
+  HID_TRACE_KEYBOARD = 0,
+  HID_TRACE_MOUSE    = 1,
+  HID_TRACE_SCROLL   = 2,
+  HID_TRACE_CONSUMER = 3,
+  HID_TRACE_TYPE_COUNT
+};
+
+#define HID_TRACE_BLE       0x10
+#define HID_TRACE_USB       0x20
+#define HID_TRACE_BLE_FAIL  0x40
+#define HID_TRACE_FLAG_MASK 0x70
+
+struct HidTraceRecord {
+  uint32_t us;
+  uint8_t meta;
+  uint8_t p[3];
+};
+
+inline uint8_t hid_trace_type(uint8_t meta) { return meta & 0x07; }
+inline uint8_t hid_trace_flags(uint8_t meta) { return meta & HID_TRACE_FLAG_MASK; }
+
+// Mouse reports carry four fields but the firmware never sends wheel together
+// with motion, so a non-zero wheel selects the SCROLL layout
+inline HidTraceRecord hid_trace_mouse_record(uint32_t us, uint8_t flags, uint8_t buttons,
+                                             int8_t dx, int8_t dy, int8_t wheel) {
+  HidTraceRecord r;
+  r.us = us;
+  if (wheel) {
+    r.meta = (uint8_t)(HID_TRACE_SCROLL | (flags & HID_TRACE_FLAG_MASK));
+    r.p[0] = (uint8_t)wheel;
+    r.p[1] = buttons;
+    r.p[2] = 0;
+  } else {
+    r.meta = (uint8_t)(HID_TRACE_MOUSE | (flags & HID_TRACE_FLAG_MASK));
+    r.p[0] = (uint8_t)dx;
+    r.p[1] = (uint8_t)dy;
+    r.p[2] = buttons;
+  }
+  return r;
+}
+
+inline void hid_trace_put_u32(uint8_t* out, uint32_t v) {
+  out[0] = (uint8_t)v;
+  out[1] = (uint8_t)(v >> 8);
+  out[2] = (uint8_t)(v >> 16);
+  out[3] = (uint8_t)(v >> 24);
+}
+
+inline uint32_t hid_trace_get_u32(const uint8_t* in) {
+  return (uint32_t)in[0] | ((uint32_t)in[1] << 8) |
+         ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+inline void hid_trace_put_record(uint8_t* out, const HidTraceRecord& r) {
+  hid_trace_put_u32(out, r.us);
+  out[4] = r.meta;
+  out[5] = r.p[0];
+  out[6] = r.p[1];
+  out[7] = r.p[2];
+}
+
+inline HidTraceRecord hid_trace_get_record(const uint8_t* in) {
+  HidTraceRecord r;
+  r.us = hid_trace_get_u32(in);
+  r.meta = in[4];
+  r.p[0] = in[5];
+  r.p[1] = in[6];
+  r.p[2] = in[7];
+  return r;
+}
+
+inline void hid_trace_put_header(uint8_t* out, uint16_t count, uint32_t dropped) {
+  out[0] = 'G';
+  out[1] = 'H';
+  out[2] = 'T';
+  out[3] = HID_TRACE_VERSION;
+  out[4] = HID_TRACE_RECORD_SIZE;
+  out[5] = 0;
+  out[6] = (uint8_t)count;
+  out[7] = (uint8_t)(count >> 8);
+  hid_trace_put_u32(out + 8, dropped);
+}
+
+// Validates magic, version, record size and that len covers every record
+inline bool hid_trace_get_header(const uint8_t* in, size_t len,
+                                 uint16_t* count, uint32_t* dropped) {
+  if (len < HID_TRACE_HEADER_SIZE) return false;
+  if (in[0] != 'G' || in[1] != 'H' || in[2] != 'T') return false;
+  if (in[3] != HID_TRACE_VERSION || in[4] != HID_TRACE_RECORD_SIZE) return false;
+  uint16_t n = (uint16_t)(in[6] | (in[7] << 8));
+  if (len < HID_TRACE_HEADER_SIZE + (size_t)n * HID_TRACE_RECORD_SIZE) return false;
+  *count = n;
+  *dropped = hid_trace_get_u32(in + 8);
+  return true;
+}
+
+inline int hid_trace_b64_value(char c) {
+  if (c >= 'A' && c <= 'Z') return c - 'A';
+  if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+  if (c >= '0' && c <= '9') return c - '0' + 52;
+  if (c == '+') return 62;
+  if (c == '/') return 63;
+  return -1;
+}
+
+// Decode one dump line (no line ending) into out, which must hold len / 4 * 3
+// bytes. Returns the byte count, or -1 if the line is not base64 — e.g. a
+// status push or log line interleaved with the dump.
+inline int hid_trace_b64_decode_line(const char* line, size_t len, uint8_t* out) {
+  if (len == 0 || len % 4 != 0) return -1;
+  for (size_t i = 0; i < len; i++) {
+    if (hid_trace_b64_value(line[i]) < 0 && line[i] != '=') return -1;
+  }
+  int n = 0;
+  for (size_t i = 0; i < len; i += 4) {
+    int v[4];
+    for (int k = 0; k < 4; k++) v[k] = line[i + k] == '=' ? 0 : hid_trace_b64_value(line[i + k]);
+    uint32_t bits = (uint32_t)(v[0] << 18 | v[1] << 12 | v[2] << 6 | v[3]);
+    out[n++] = (uint8_t)(bits >> 16);
+    if (line[i + 2] != '=') out[n++] = (uint8_t)(bits >> 8);
+    if (line[i + 3] != '=') out[n++] = (uint8_t)bits;
+  }
+  return n;
+}
+
+#endif // GHOST_HID_TRACE_PURE_H
@@ -93,7 +93,7 @@ const MenuItem MENU_ITEMS[MENU_ITEM_COUNT] = {
   { MENU_HEADING, "Mouse",         NULL, FMT_DURATION_MS, 0, 0, 0, 0 },
   { MENU_VALUE,   "Move duration", "Duration of mouse jiggle movement", FMT_DURATION_MS, 500, 90000, 500, SET_MOUSE_JIG },
   { MENU_VALUE,   "Idle duration", "Pause between mouse jiggles", FMT_DURATION_MS, 500, 90000, 500, SET_MOUSE_IDLE },
-  { MENU_VALUE,   "Move style",    "Movement pattern (Bezier=sweep, Brownian=jiggle)", FMT_MOUSE_STYLE, 0, 1, 1, SET_MOUSE_STYLE },
+  { MENU_VALUE,   "Move style",    "Movement pattern (Bezier=sweep, Brownian=jiggle, Reach=point-to-point, Replay=recorded)", FMT_MOUSE_STYLE, 0, MOUSE_STYLE_COUNT - 1, 1, SET_MOUSE_STYLE },
   { MENU_VALUE,   "Move size",     "Mouse movement step size in pixels", FMT_PIXELS, 1, 5, 1, SET_MOUSE_AMP },
   { MENU_VALUE,   "Scroll",        "Random scroll wheel during mouse movement", FMT_ON_OFF, 0, 1, 1, SET_SCROLL },
   { MENU_VALUE,   "Auto-clicks",   "Inject clicks during mouse phases", FMT_ON_OFF, 0, 1, 1, SET_PHANTOM_CLICKS },
@@ -193,7 +193,7 @@ const char* MODE_NAMES[] = { "NORMAL", "MENU", "SLOTS", "NAME", "DECOY", "SCHED"
 const char* PROFILE_NAMES[] = { "LAZY", "NORMAL", "BUSY" };
 const char* PROFILE_NAMES_TITLE[] = { "Lazy", "Normal", "Busy" };
 const char* ANIM_NAMES[] = { "ECG", "EQ", "Ghost", "Matrix", "Radar", "None" };
-const char* MOUSE_STYLE_NAMES[] = { "Bezier", "Brownian" };
+const char* MOUSE_STYLE_NAMES[] = { "Bezier", "Brownian", "Reach", "Replay" };
 const char* SWITCH_KEYS_NAMES[] = { "AltTab", "CmdTab" };
 const char* ON_OFF_NAMES[] = { "Off", "On" };
 const char* KB_SOUND_NAMES[] = { "MX Blue", "MX Brown", "Membrane", "Buckling", "Thock" };
@@ -243,7 +243,9 @@ static const char* const ANIM_DESCS[] = {
 
 static const char* const MOUSE_STYLE_DESCS[] = {
   "Smooth curved sweeps",
-  "Random jitter movement"
+  "Random jitter movement",
+  "Quick aimed moves",
+  "Recorded human moves"
 };
 
 static const char* const SAVER_TIMEOUT_DESCS[] = {
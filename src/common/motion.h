@@ -0,0 +1,72 @@
+#ifndef GHOST_MOTION_H
+#define GHOST_MOTION_H
+
+#include "config.h"
+#include "mouse.h"
+#include "hid_emit_pure.h"
+
+// ============================================================================
+// Motion generator — the one step scheduler behind every mouse motion source
+// A policy says what the next step is; motionTick() owns the
+// MOUSE_MOVE_STEP_MS cadence and queues each step with its due time for the
+// HID emitter (hid_emit.h), which sends it through the report coalescer.
+// The cadence is drift-free: a late loop() catches up on the same step grid
+// (up to MOTION_MAX_LATE_MS) instead of shifting every later step, and steps
+// are planned MOTION_LEAD_MS ahead so a blocking display flush doesn't hold
+// them back. Policies are template arguments, so each call site compiles to a
+// direct (usually inlined) call — no function pointers or virtual dispatch.
+//
+// Policy interface:
+//   static const bool TRACKS_NET
+//     true: steps count into mouseNetX/Y, so the return home undoes them
+//   bool next(unsigned long stepMs, int32_t& dx, int32_t& dy)
+//     stepMs: time since the previous step (MOUSE_MOVE_STEP_MS)
+//     dx, dy: this step's motion, 0 = none (start at 0; may exceed int8 —
+//             the coalescer spreads the excess over further reports)
+//     returns false once the policy has no further steps
+//
+// Instantiated by handleMouseStateMachine() (sweep / reach, Brownian, Replay,
+// return home) and the orchestrator's K+M / M+K swipes.
+// ============================================================================
+
+// Run one scheduler tick. lastStepMs is the caller's step timer (due time of
+// the last planned step; set it to now to start a fresh grid). Returns false
+// if the policy just produced its last step; true if it has more (or no step
+// was due).
+template <typename Policy>
+inline bool motionTick(Policy& policy, unsigned long& lastStepMs, unsigned long now) {
+  uint32_t last = (uint32_t)lastStepMs;
+  uint32_t due;
+  bool more = true;
+  while (more && hid_cadence_next(last, (uint32_t)now, MOUSE_MOVE_STEP_MS,
+                                  MOTION_LEAD_MS, MOTION_MAX_LATE_MS, due)) {
+    int32_t dx = 0, dy = 0;
+    more = policy.next(MOUSE_MOVE_STEP_MS, dx, dy);
+    while (dx != 0 || dy != 0) {
+      int16_t sx = hid_step_sat(dx);
+      int16_t sy = hid_step_sat(dy);
+      queueMouseStep(sx, sy, due, Policy::TRACKS_NET);
+      dx -= sx;
+      dy -= sy;
+    }
+  }
+  lastStepMs = last;
+  return more;
+}
+
+// Constant-direction swipe (orchestrator K+M form swipes, M+K drawing
+// strokes): one (dx, dy) step per tick for as long as the caller keeps it
+// running. Swipes are meant to leave the pointer where they end, so they
+// stay out of the jiggle's net offset.
+struct SwipeMotion {
+  static const bool TRACKS_NET = false;
+  int8_t dx, dy;
+
+  bool next(unsigned long, int32_t& outX, int32_t& outY) const {
+    outX = dx;
+    outY = dy;
+    return true;
+  }
+};
+
+#endif // GHOST_MOTION_H
@@ -1,9 +1,13 @@
 #include "mouse.h"
+#include "motion.h"
 #include "mouse_pure.h"
+#include "mouse_trace_pure.h"
 #include "state.h"
 #include "keys.h"
 #include "timing.h"
 #include "platform_hal.h"
+#include "rng.h"
+#include "bench.h"
 #include <math.h>
 
 // ============================================================================
@@ -11,7 +15,7 @@
 // ============================================================================
 
 void pickNewDirection() {
-  int dir = random(NUM_DIRS);
+  int dir = rngBelow(RNG_MOUSE, NUM_DIRS);
   currentMouseDx = MOUSE_DIRS[dir][0];
   currentMouseDy = MOUSE_DIRS[dir][1];
 }
@@ -24,12 +28,30 @@ enum SweepPhase { SWEEP_PLANNING, SWEEP_MOVING, SWEEP_PAUSING };
 static SweepPhase sweepPhase;
 
 // Bezier control points (fixed-point: 8 fractional bits for sub-pixel accuracy)
-static int32_t bzP0x, bzP0y;   // start
-static int32_t bzP1x, bzP1y;   // control
-static int32_t bzP2x, bzP2y;   // end
-static int32_t bzLastX, bzLastY; // last evaluated position (fractional)
+struct BezierCurve {
+  int32_t p0x, p0y;       // start
+  int32_t p1x, p1y;       // control
+  int32_t p2x, p2y;       // end
+  int32_t lastX, lastY;   // last evaluated position (fractional)
+};
+
+// A whole sweep, evaluated up front: the whole-pixel delta for every step.
+// Two plans double-buffer: the next sweep is planned into the spare one
+// during SWEEP_PAUSING, so a MOVING step is only a dequeue.
+struct SweepPlan {
+  int8_t dx[SWEEP_MAX_STEPS];
+  int8_t dy[SWEEP_MAX_STEPS];
+  uint16_t stepCount;
+};
+static SweepPlan sweepPlans[2];
+
+// Sub-pixel residue shared by sweep / reach planning and Brownian steps.
+// Styles don't mix within a jiggle and plans are made in play order, so one
+// carry runs through every step, sweep and jiggle.
+static MouseSubpixel motionCarry;
+static uint8_t sweepActive;        // plan being dequeued
+static bool sweepNextReady;        // sweepPlans[sweepActive ^ 1] holds the next sweep
 
-static uint16_t sweepStepCount;    // total steps for this sweep
 static uint16_t sweepStepCurrent;  // current step index
 static unsigned long sweepPauseStart;
 static unsigned long sweepPauseDuration;
@@ -37,10 +59,10 @@ static unsigned long sweepPauseDuration;
 // Pick a random sweep radius with weighted distribution:
 // ~40% small (20-60px), ~40% medium (60-180px), ~20% large (150-350px)
 static int16_t randomSweepRadius() {
-  int r = random(100);
-  if (r < 40)      return 20 + random(41);    // 20-60px
-  else if (r < 80) return 60 + random(121);   // 60-180px
-  else              return 150 + random(201);  // 150-350px
+  int r = rngBelow(RNG_MOUSE, 100);
+  if (r < 40)      return 20 + rngBelow(RNG_MOUSE, 41);    // 20-60px
+  else if (r < 80) return 60 + rngBelow(RNG_MOUSE, 121);   // 60-180px
+  else              return 150 + rngBelow(RNG_MOUSE, 201);  // 150-350px
 }
 
 // Alpha-max-beta-min integer distance approximation (avoids sqrt/float)
@@ -52,6 +74,7 @@ static int16_t approxDist(int16_t dx, int16_t dy) {
   else         return ay + (ax * 3 / 8);
 }
 
+#if !GHOST_MOTION_FIXED
 // Map time progress [0..1] through trapezoidal velocity profile
 // Accel 20%, cruise 60%, decel 20%
 // Returns Bezier t parameter [0..1]
@@ -79,18 +102,74 @@ static float timeToParam(float progress) {
   }
   return t;
 }
+#endif
+
+// Curve position (fixed-point) at a step, through the trapezoidal profile
+static void bezierPoint(const BezierCurve& c, uint16_t step, uint16_t stepCount,
+                        int32_t& curX, int32_t& curY) {
+  // Quadratic Bezier: B(t) = (1-t)^2*P0 + 2(1-t)t*P1 + t^2*P2
+#if GHOST_MOTION_FIXED
+  uint32_t t = mouse_time_to_param_q16(mouse_progress_q16(step, stepCount));
+  curX = mouse_bezier_eval_q16(c.p0x, c.p1x, c.p2x, t);
+  curY = mouse_bezier_eval_q16(c.p0y, c.p1y, c.p2y, t);
+#else
+  float progress = (float)step / (float)stepCount;
+  float t = timeToParam(progress);
+  curX = mouse_bezier_eval(c.p0x, c.p1x, c.p2x, t);
+  curY = mouse_bezier_eval(c.p0y, c.p1y, c.p2y, t);
+#endif
+}
+
+// Advance one step along the curve; returns the whole pixels now due
+static void bezierStepDelta(BezierCurve& c, uint16_t step, uint16_t stepCount,
+                            MouseSubpixel& carry, int8_t& dx, int8_t& dy) {
+  int32_t curX, curY;
+  bezierPoint(c, step, stepCount, curX, curY);
+
+  // Delta from last position (still in fixed-point)
+  int32_t deltaX = curX - c.lastX;
+  int32_t deltaY = curY - c.lastY;
+  c.lastX = curX;
+  c.lastY = curY;
 
-// Plan a new Bezier sweep from current position
-static void planNextSweep() {
+  // Whole pixels out, fraction carried to the next step
+  mouse_subpx_take(carry, deltaX, deltaY, dx, dy);
+}
+
+// Curve position (fixed-point) at a Q16 curve parameter
+static void bezierAtQ16(const BezierCurve& c, uint32_t t, int32_t& curX, int32_t& curY) {
+#if GHOST_MOTION_FIXED
+  curX = mouse_bezier_eval_q16(c.p0x, c.p1x, c.p2x, t);
+  curY = mouse_bezier_eval_q16(c.p0y, c.p1y, c.p2y, t);
+#else
+  float tf = (float)t / (float)MOUSE_Q16_ONE;
+  curX = mouse_bezier_eval(c.p0x, c.p1x, c.p2x, tf);
+  curY = mouse_bezier_eval(c.p0y, c.p1y, c.p2y, tf);
+#endif
+}
+
+// Pick the next sweep target from the current net position (where the mouse
+// will be when the plan starts): random radius and angle, clamped to the
+// drift limit, with a perpendicular control point for a natural arc.
+// The target is the curve's P2.
+static void pickSweepCurve(BezierCurve& c) {
   int16_t radius = randomSweepRadius();
   int16_t driftLimit = radius * SWEEP_DRIFT_FACTOR;
 
   // Random target angle and distance
-  float angle = (float)random(360) * PI / 180.0f;
-  int16_t dist = radius / 2 + random(radius);
+#if GHOST_MOTION_FIXED
+  int16_t angleDeg = (int16_t)rngBelow(RNG_MOUSE, 360);
+  int16_t dist = radius / 2 + rngBelow(RNG_MOUSE, radius);
+
+  int16_t targetX = (int16_t)(mouse_cos_q15(angleDeg) * dist / MOUSE_Q15_ONE);
+  int16_t targetY = (int16_t)(mouse_sin_q15(angleDeg) * dist / MOUSE_Q15_ONE);
+#else
+  float angle = (float)rngBelow(RNG_MOUSE, 360) * PI / 180.0f;
+  int16_t dist = radius / 2 + rngBelow(RNG_MOUSE, radius);
 
   int16_t targetX = (int16_t)(cosf(angle) * dist);
   int16_t targetY = (int16_t)(sinf(angle) * dist);
+#endif
 
   // Apply as offset from current net position, then clamp to drift limit
   int16_t absX = (int16_t)(mouseNetX + targetX);
@@ -105,59 +184,365 @@ static void planNextSweep() {
   int16_t dy = absY - (int16_t)mouseNetY;
 
   // Perpendicular control point offset for natural curve
-  int16_t perpX = -dy / 3 + (int16_t)random(-radius / 4, radius / 4 + 1);
-  int16_t perpY =  dx / 3 + (int16_t)random(-radius / 4, radius / 4 + 1);
+  int16_t perpX = -dy / 3 + (int16_t)rngRange(RNG_MOUSE, -radius / 4, radius / 4 + 1);
+  int16_t perpY =  dx / 3 + (int16_t)rngRange(RNG_MOUSE, -radius / 4, radius / 4 + 1);
 
   // Set Bezier points (shifted left 8 bits for fractional precision)
-  bzP0x = 0;
-  bzP0y = 0;
-  bzP1x = (int32_t)(dx / 2 + perpX) << 8;
-  bzP1y = (int32_t)(dy / 2 + perpY) << 8;
-  bzP2x = (int32_t)dx << 8;
-  bzP2y = (int32_t)dy << 8;
-  bzLastX = 0;
-  bzLastY = 0;
+  c.p0x = 0;
+  c.p0y = 0;
+  c.p1x = (int32_t)(dx / 2 + perpX) << 8;
+  c.p1y = (int32_t)(dy / 2 + perpY) << 8;
+  c.p2x = (int32_t)dx << 8;
+  c.p2y = (int32_t)dy << 8;
+  c.lastX = 0;
+  c.lastY = 0;
+}
+
+// Plan a new Bezier sweep and evaluate every step into plan
+static void planNextSweep(SweepPlan& plan, MouseSubpixel& carry) {
+  BezierCurve c;
+  pickSweepCurve(c);
+  int16_t dx = (int16_t)(c.p2x >> 8);
+  int16_t dy = (int16_t)(c.p2y >> 8);
 
   // Duration based on distance and random speed
   int16_t totalDist = approxDist(dx, dy);
   if (totalDist < 5) totalDist = 5;  // minimum distance
-  int16_t speed = SWEEP_SPEED_MIN + random(SWEEP_SPEED_MAX - SWEEP_SPEED_MIN + 1);
+  int16_t speed = SWEEP_SPEED_MIN + rngBelow(RNG_MOUSE, SWEEP_SPEED_MAX - SWEEP_SPEED_MIN + 1);
   unsigned long durationMs = (unsigned long)totalDist * 1000UL / speed;
-  if (durationMs < 150) durationMs = 150;
-  if (durationMs > 3000) durationMs = 3000;
+  if (durationMs < SWEEP_DURATION_MIN_MS) durationMs = SWEEP_DURATION_MIN_MS;
+  if (durationMs > SWEEP_DURATION_MAX_MS) durationMs = SWEEP_DURATION_MAX_MS;
+
+  plan.stepCount = (uint16_t)(durationMs / MOUSE_MOVE_STEP_MS);
+  if (plan.stepCount < 2) plan.stepCount = 2;
 
-  sweepStepCount = (uint16_t)(durationMs / MOUSE_MOVE_STEP_MS);
-  if (sweepStepCount < 2) sweepStepCount = 2;
-  sweepStepCurrent = 0;
+  for (uint16_t i = 0; i < plan.stepCount; i++) {
+    bezierStepDelta(c, i + 1, plan.stepCount, carry, plan.dx[i], plan.dy[i]);
+  }
 }
 
-// Evaluate Bezier at current step, send mouse delta, advance
-static void evaluateBezierStep() {
-  sweepStepCurrent++;
-  float progress = (float)sweepStepCurrent / (float)sweepStepCount;
-  float t = timeToParam(progress);
+// Append one minimum-jerk move along c to plan. Consecutive moves chain
+// (each starts where the last ended), so with the carry the plan's steps sum
+// to the final curve's end to within the residue.
+static void appendReach(SweepPlan& plan, const BezierCurve& c, uint16_t steps,
+                        MouseSubpixel& carry) {
+  int32_t prevX = c.p0x, prevY = c.p0y;
+  for (uint16_t i = 1; i <= steps && plan.stepCount < SWEEP_MAX_STEPS; i++) {
+    int32_t curX, curY;
+    bezierAtQ16(c, mouse_min_jerk_q16(mouse_progress_q16(i, steps)), curX, curY);
+    mouse_subpx_take(carry, curX - prevX, curY - prevY,
+                     plan.dx[plan.stepCount], plan.dy[plan.stepCount]);
+    plan.stepCount++;
+    prevX = curX;
+    prevY = curY;
+  }
+}
 
-  // Quadratic Bezier: B(t) = (1-t)^2*P0 + 2(1-t)t*P1 + t^2*P2
-  int32_t curX = mouse_bezier_eval(bzP0x, bzP1x, bzP2x, t);
-  int32_t curY = mouse_bezier_eval(bzP0y, bzP1y, bzP2y, t);
+// Plan a reach (mouseStyle 2): same target choice as a sweep, but a flatter
+// arc with a minimum-jerk speed profile and Fitts' law duration for a random
+// target width. Sometimes it overshoots by a few percent and a short second
+// move corrects back onto the target.
+static void planNextReach(SweepPlan& plan, MouseSubpixel& carry) {
+  BezierCurve c;
+  pickSweepCurve(c);
+  // Reaches are straighter than sweeps — halve the bow
+  int32_t midX = c.p2x / 2, midY = c.p2y / 2;
+  c.p1x = midX + (c.p1x - midX) / 2;
+  c.p1y = midY + (c.p1y - midY) / 2;
 
-  // Delta from last position (still in fixed-point)
-  int32_t deltaX = curX - bzLastX;
-  int32_t deltaY = curY - bzLastY;
-  bzLastX = curX;
-  bzLastY = curY;
+  int16_t dx = (int16_t)(c.p2x >> 8);
+  int16_t dy = (int16_t)(c.p2y >> 8);
+  uint32_t dist = (uint32_t)approxDist(dx, dy);
+  if (dist < 5) dist = 5;
+  uint32_t width = REACH_WIDTH_MIN + rngBelow(RNG_MOUSE, REACH_WIDTH_MAX - REACH_WIDTH_MIN + 1);
+  uint32_t moveMs = mouse_fitts_ms(dist, width, REACH_FITTS_A_MS, REACH_FITTS_B_MS);
+
+  // Overshoot: scale the primary move past the target, then correct
+  BezierCurve fix = {};
+  uint32_t fixMs = 0;
+  if ((int)rngBelow(RNG_MOUSE, 100) < REACH_OVERSHOOT_PCT) {
+    int32_t pct = REACH_OVERSHOOT_MIN + (int32_t)rngBelow(RNG_MOUSE, REACH_OVERSHOOT_MAX - REACH_OVERSHOOT_MIN + 1);
+    fix.p2x = c.p2x;
+    fix.p2y = c.p2y;
+    c.p1x = c.p1x * (100 + pct) / 100;
+    c.p1y = c.p1y * (100 + pct) / 100;
+    c.p2x = c.p2x * (100 + pct) / 100;
+    c.p2y = c.p2y * (100 + pct) / 100;
+    fix.p0x = c.p2x;
+    fix.p0y = c.p2y;
+    fix.p1x = (fix.p0x + fix.p2x) / 2;
+    fix.p1y = (fix.p0y + fix.p2y) / 2;
+    fixMs = mouse_fitts_ms(dist * (uint32_t)pct / 100 + 1, REACH_WIDTH_MIN,
+                           REACH_FITTS_A_MS, REACH_FITTS_B_MS);
+    if (fixMs < SWEEP_DURATION_MIN_MS) fixMs = SWEEP_DURATION_MIN_MS;
+  }
 
-  // Convert from fixed-point to integer pixels (round half away from zero)
-  int8_t dx = mouse_fp8_round(deltaX);
-  int8_t dy = mouse_fp8_round(deltaY);
+  if (moveMs < SWEEP_DURATION_MIN_MS) moveMs = SWEEP_DURATION_MIN_MS;
+  if (moveMs + fixMs > SWEEP_DURATION_MAX_MS) moveMs = SWEEP_DURATION_MAX_MS - fixMs;
 
-  if (dx != 0 || dy != 0) {
-    sendMouseMove(dx, dy);
+  plan.stepCount = 0;
+  appendReach(plan, c, (uint16_t)(moveMs / MOUSE_MOVE_STEP_MS), carry);
+  if (fixMs) appendReach(plan, fix, (uint16_t)(fixMs / MOUSE_MOVE_STEP_MS), carry);
+}
+
+// Plan the next move for the active style (Bezier sweep or reach)
+static void planNextMove(SweepPlan& plan) {
+  if (settings.mouseStyle == MOUSE_STYLE_REACH) planNextReach(plan, motionCarry);
+  else planNextSweep(plan, motionCarry);
+}
+
+// Plan the way home: one curved sweep from the current net offset back to
+// the origin, at top sweep speed and never longer than RETURN_DURATION_MAX_MS.
+// Steps are differences of whole-pixel positions along the curve, so they
+// sum to exactly -net (a step past the int8 range carries into the next
+// one). No RNG draws — the bow side alternates with each jiggle.
+static void planReturnHome(SweepPlan& plan) {
+  int32_t dx = -mouseNetX;
+  int32_t dy = -mouseNetY;
+  int32_t bow = (mouseJiggleCount & 1) ? RETURN_BOW_DIVISOR : -RETURN_BOW_DIVISOR;
+
+  BezierCurve c;
+  c.p0x = 0;
+  c.p0y = 0;
+  c.p1x = (dx / 2 - dy / bow) << 8;
+  c.p1y = (dy / 2 + dx / bow) << 8;
+  c.p2x = dx << 8;
+  c.p2y = dy << 8;
+
+  int32_t ax = abs(dx), ay = abs(dy);
+  uint32_t dist = (uint32_t)(ax > ay ? ax + ay * 3 / 8 : ay + ax * 3 / 8);
+  unsigned long durationMs = dist * 1000UL / SWEEP_SPEED_MAX;
+  if (durationMs < SWEEP_DURATION_MIN_MS) durationMs = SWEEP_DURATION_MIN_MS;
+  if (durationMs > RETURN_DURATION_MAX_MS) durationMs = RETURN_DURATION_MAX_MS;
+  plan.stepCount = (uint16_t)(durationMs / MOUSE_MOVE_STEP_MS);
+
+  int32_t doneX = 0, doneY = 0;  // whole pixels planned so far
+  for (uint16_t i = 0; i < plan.stepCount; i++) {
+    int32_t curX, curY;
+    bezierPoint(c, i + 1, plan.stepCount, curX, curY);
+    plan.dx[i] = mouse_coalesce_clamp(mouse_fp8_to_px(curX) - doneX);
+    plan.dy[i] = mouse_coalesce_clamp(mouse_fp8_to_px(curY) - doneY);
+    doneX += plan.dx[i];
+    doneY += plan.dy[i];
+  }
+}
+
+// ============================================================================
+// Report coalescing — steps wait in the timed queue until due, then go to
+// the coalescer, which sends once per transport interval
+// (hidReportIntervalMs()). Both are drained by the HID emitter (hid_emit.h),
+// not by loop(). mouseNetX/Y count a step when it is planned, so
+// return-to-origin stays exact however the steps are timed or batched.
+// ============================================================================
+
+static HidStepQueue stepQueue;
+static MouseCoalescer moveQueue;
+
+void flushQueuedMouseMoves(unsigned long now) {
+  int16_t sx, sy;
+  while (hid_step_pop_due(stepQueue, (uint32_t)now, sx, sy)) {
+    mouse_coalesce_add(moveQueue, sx, sy);
+  }
+  int8_t dx, dy, dw;
+  if (mouse_coalesce_take(moveQueue, (uint32_t)now, hidReportIntervalMs(), dx, dy, dw)) {
+    if (dw != 0) sendMouseMoveScroll(dx, dy, dw);
+    else         sendMouseMove(dx, dy);
+  }
+}
+
+bool mouseEmitDeadline(unsigned long now, unsigned long& dueMs) {
+  bool any = false;
+  uint32_t due = 0, next;
+  if (hid_step_next_due(stepQueue, next)) hid_deadline_fold(any, due, next);
+  if (mouse_coalesce_pending(moveQueue)) {
+    hid_deadline_fold(any, due, moveQueue.sent ? moveQueue.lastSendMs + hidReportIntervalMs()
+                                               : (uint32_t)now);
+  }
+  if (any) dueMs = due;
+  return any;
+}
+
+void queueMouseStep(int16_t dx, int16_t dy, unsigned long dueMs, bool trackNet) {
+  if (trackNet) {
     mouseNetX += dx;
     mouseNetY += dy;
   }
+  hid_step_push(stepQueue, (uint32_t)dueMs, dx, dy);
+}
+
+// ============================================================================
+// Scroll — one detent per injection, queued as wheel units so it shares a
+// report with the move step of the same tick. With a hi-res wheel
+// (hidScrollUnits() > 1) the detent is eased in over SCROLL_RAMP_STEPS
+// steps on the minimum-jerk profile instead of landing as one jump.
+// ============================================================================
+
+static int8_t scrollRampUnits;     // signed units of the detent in flight, 0 = none
+static int8_t scrollRampQueued;    // units queued so far
+static uint8_t scrollRampStep;
+static unsigned long lastScrollStep;
+
+static void finishScrollRamp() {
+  if (scrollRampUnits == 0) return;
+  mouse_coalesce_add_wheel(moveQueue, scrollRampUnits - scrollRampQueued);
+  scrollRampUnits = 0;
+}
+
+static void startScrollDetent(int8_t dir) {
+  stats.totalMouseClicks++;
+  statsDirty = true;
+  finishScrollRamp();  // intervals are seconds apart — only a safety net
+  uint8_t units = hidScrollUnits();
+  if (units <= 1) {
+    mouse_coalesce_add_wheel(moveQueue, dir);
+    return;
+  }
+  scrollRampUnits = (int8_t)(dir * units);
+  scrollRampQueued = 0;
+  scrollRampStep = 0;
+}
+
+// Queue this tick's share of the ramp (called once per MOUSE_MOVE_STEP_MS)
+static void stepScrollRamp() {
+  if (scrollRampUnits == 0) return;
+  scrollRampStep++;
+  uint32_t s = mouse_min_jerk_q16((uint32_t)scrollRampStep * MOUSE_Q16_ONE / SCROLL_RAMP_STEPS);
+  int32_t mag = (int32_t)(((uint32_t)abs(scrollRampUnits) * s + MOUSE_Q16_ONE / 2) >> 16);
+  int8_t target = (int8_t)(scrollRampUnits < 0 ? -mag : mag);
+  mouse_coalesce_add_wheel(moveQueue, target - scrollRampQueued);
+  scrollRampQueued = target;
+  if (scrollRampStep >= SCROLL_RAMP_STEPS) scrollRampUnits = 0;
+}
+
+void discardQueuedMouseMoves() {
+  stepQueue = HidStepQueue();
+  moveQueue = MouseCoalescer();
+  motionCarry = MouseSubpixel();
+  scrollRampUnits = 0;
 }
 
+// ============================================================================
+// Replay style — a recorded human trace streamed from flash through the
+// decoder window, at a random time scale and mirroring per trace. Steps go
+// through motionTick(), so mouseNetX/Y (and the return home) stay exact.
+// With no valid trace stored, the jiggle falls back to Bezier sweeps.
+// ============================================================================
+
+static MouseTraceReader traceReader;
+static bool traceActive;                 // replaying this jiggle
+static uint16_t traceScalePct;           // wall time = trace time * pct / 100
+static int8_t traceMirrorX, traceMirrorY;
+static uint32_t traceWallMs;             // wall time played of this trace
+static uint32_t traceNextMs;             // trace time of the pending sample
+static int32_t tracePendX, tracePendY;
+static bool tracePending;
+
+static uint16_t readTraceSlot(void* ctx, uint32_t offset, uint8_t* buf, uint16_t len) {
+  return mouseTraceRead((uint8_t)(uintptr_t)ctx, offset, buf, len);
+}
+
+// Open a random stored trace. False if no slot holds a valid one.
+static bool startTracePlayback() {
+  uint8_t slots[MOUSE_TRACE_SLOTS];
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < MOUSE_TRACE_SLOTS; i++) {
+    if (mouseTraceSize(i) > MOUSE_TRACE_HEADER_SIZE) slots[count++] = i;
+  }
+  if (count == 0) return false;
+  uint8_t slot = slots[rngBelow(RNG_MOUSE, count)];
+  if (!mouse_trace_open(traceReader, readTraceSlot, (void*)(uintptr_t)slot, NULL)) return false;
+  traceScalePct = (uint16_t)rngRange(RNG_MOUSE, MOUSE_TRACE_SCALE_MIN_PCT, MOUSE_TRACE_SCALE_MAX_PCT + 1);
+  uint32_t mirror = rngBelow(RNG_MOUSE, 4);
+  traceMirrorX = (mirror & 1) ? -1 : 1;
+  traceMirrorY = (mirror & 2) ? -1 : 1;
+  traceWallMs = 0;
+  traceNextMs = 0;
+  tracePending = false;
+  return true;
+}
+
+// Replay policy: every sample due by this tick, summed into one step
+struct TraceMotion {
+  static const bool TRACKS_NET = true;
+
+  bool next(unsigned long stepMs, int32_t& sumX, int32_t& sumY) {
+    traceWallMs += stepMs;
+    uint32_t traceMs = traceWallMs * 100 / traceScalePct;
+    for (;;) {
+      if (!tracePending) {
+        uint32_t dt;
+        int32_t dx, dy;
+        if (!mouse_trace_next(traceReader, dt, dx, dy)) return false;
+        traceNextMs += dt;
+        tracePendX = dx * traceMirrorX;
+        tracePendY = dy * traceMirrorY;
+        tracePending = true;
+      }
+      if (traceNextMs > traceMs) return true;
+      // A fast flick can exceed int8 in one tick — the coalescer splits it
+      sumX += tracePendX;
+      sumY += tracePendY;
+      tracePending = false;
+    }
+  }
+};
+
+// Sweep / reach policy: dequeue the active plan's next step.
+// Returns false after the plan's last step.
+struct PlanMotion {
+  static const bool TRACKS_NET = true;
+
+  bool next(unsigned long, int32_t& dx, int32_t& dy) {
+    const SweepPlan& plan = sweepPlans[sweepActive];
+    dx = plan.dx[sweepStepCurrent];
+    dy = plan.dy[sweepStepCurrent];
+    sweepStepCurrent++;
+    return sweepStepCurrent < plan.stepCount;
+  }
+};
+
+// Return policy: the planned curve home, then straight steps if the offset
+// was too large for int8 steps in the time bound (or the net moved under
+// the plan)
+struct ReturnMotion {
+  static const bool TRACKS_NET = true;
+
+  bool next(unsigned long stepMs, int32_t& dx, int32_t& dy) {
+    if (sweepStepCurrent < sweepPlans[sweepActive].stepCount) {
+      PlanMotion().next(stepMs, dx, dy);
+    } else {
+      dx = mouse_return_step(mouseNetX);
+      dy = mouse_return_step(mouseNetY);
+    }
+    return true;
+  }
+};
+
+// Brownian policy: random-walk direction, sine-eased amplitude over the jiggle
+struct BrownianMotion {
+  static const bool TRACKS_NET = true;
+  unsigned long elapsed;
+
+  bool next(unsigned long, int32_t& dx, int32_t& dy) {
+    if (rngBelow(RNG_MOUSE, 100) < 15) pickNewDirection();
+    // Ease-in-out: sine curve ramps amplitude 0 -> peak -> 0. The amplitude
+    // stays fractional; the carry turns it into whole pixels when due.
+#if GHOST_MOTION_FIXED
+    int32_t ampFp = mouse_brownian_amp_fp8_q16(settings.mouseAmplitude,
+                                               mouse_progress_q16(elapsed, currentMouseJiggle));
+#else
+    float progress = (float)elapsed / (float)currentMouseJiggle;
+    float amp = mouse_brownian_amp(settings.mouseAmplitude, progress);
+    int32_t ampFp = amp > 0.0f ? (int32_t)(amp * 256.0f + 0.5f) : 0;
+#endif
+    int8_t sx, sy;
+    mouse_subpx_take(motionCarry, currentMouseDx * ampFp, currentMouseDy * ampFp, sx, sy);
+    dx = sx;
+    dy = sy;
+    return true;
+  }
+};
+
 // ============================================================================
 // Main state machine
 // ============================================================================
@@ -174,8 +559,10 @@ void handleMouseStateMachine(unsigned long now) {
         mouseNetX = 0;
         mouseNetY = 0;
         lastScrollTime = now;
-        nextScrollInterval = random(SCROLL_INTERVAL_MIN_MS, SCROLL_INTERVAL_MAX_MS + 1);
+        nextScrollInterval = rngRange(RNG_MOUSE, SCROLL_INTERVAL_MIN_MS, SCROLL_INTERVAL_MAX_MS + 1);
         sweepPhase = SWEEP_PLANNING;  // Bezier starts fresh
+        sweepNextReady = false;
+        traceActive = settings.mouseStyle == MOUSE_STYLE_REPLAY && startTracePlayback();
         pickNewDirection();            // Brownian needs initial direction
         scheduleNextMouseState();
         markDisplayDirty();
@@ -186,70 +573,93 @@ void handleMouseStateMachine(unsigned long now) {
     case MOUSE_JIGGLING:
       // Random scroll injection (applies to both Bezier and Brownian)
       if (settings.scrollEnabled && (now - lastScrollTime >= nextScrollInterval)) {
-        sendMouseScroll(random(2) ? 1 : -1);
+        startScrollDetent(rngBelow(RNG_MOUSE, 2) ? 1 : -1);
         lastScrollTime = now;
-        nextScrollInterval = random(SCROLL_INTERVAL_MIN_MS, SCROLL_INTERVAL_MAX_MS + 1);
+        lastScrollStep = now - MOUSE_MOVE_STEP_MS;  // first ramp step rides this tick
+        nextScrollInterval = rngRange(RNG_MOUSE, SCROLL_INTERVAL_MIN_MS, SCROLL_INTERVAL_MAX_MS + 1);
+      }
+      if (scrollRampUnits != 0 && now - lastScrollStep >= MOUSE_MOVE_STEP_MS) {
+        stepScrollRamp();
+        lastScrollStep = now;
       }
       if (elapsed >= currentMouseJiggle) {
         mouseState = MOUSE_RETURNING;
         lastMouseStateChange = now;
         lastMouseStep = now;
+        // The jiggle is over, so both sweep buffers are free
+        sweepActive = 0;
+        sweepNextReady = false;
+        sweepStepCurrent = 0;
+        planReturnHome(sweepPlans[sweepActive]);
         markDisplayDirty();
         pushSerialStatus();
-      } else if (settings.mouseStyle == 0) {
-        // ---- Bezier sweep mode ----
+      } else if (traceActive) {
+        // ---- Replay mode (streamed recorded trace) ----
+        TraceMotion trace;
+        if (!motionTick(trace, lastMouseStep, now)) {
+          // Trace over — go straight on with another (or sweeps if it won't open)
+          traceActive = startTracePlayback();
+        }
+      } else if (settings.mouseStyle != MOUSE_STYLE_BROWNIAN) {
+        // ---- Bezier sweep / reach mode (pre-planned steps) ----
         switch (sweepPhase) {
           case SWEEP_PLANNING:
-            planNextSweep();
+            if (sweepNextReady) {
+              // Planned during the pause — just swap buffers
+              sweepActive ^= 1;
+              sweepNextReady = false;
+            } else {
+              // First sweep of this jiggle — later ones are planned while pausing
+              sweepActive = 0;
+              planNextMove(sweepPlans[sweepActive]);
+            }
+            sweepStepCurrent = 0;
             sweepPhase = SWEEP_MOVING;
             break;
 
-          case SWEEP_MOVING:
-            if (now - lastMouseStep >= MOUSE_MOVE_STEP_MS) {
-              evaluateBezierStep();
-              lastMouseStep = now;
-              if (sweepStepCurrent >= sweepStepCount) {
-                // Sweep complete — enter pause
-                sweepPhase = SWEEP_PAUSING;
-                unsigned long pauseLen;
-                if ((int)random(100) < SWEEP_LONG_PAUSE_PCT) {
-                  pauseLen = SWEEP_PAUSE_MAX_MS + random(SWEEP_LONG_PAUSE_MS - SWEEP_PAUSE_MAX_MS + 1);
-                } else {
-                  pauseLen = SWEEP_PAUSE_MIN_MS + random(SWEEP_PAUSE_MAX_MS - SWEEP_PAUSE_MIN_MS + 1);
-                }
-                sweepPauseStart = now;
-                sweepPauseDuration = pauseLen;
+          case SWEEP_MOVING: {
+            PlanMotion sweep;
+            if (!motionTick(sweep, lastMouseStep, now)) {
+              // Sweep complete — enter pause
+              sweepPhase = SWEEP_PAUSING;
+              unsigned long pauseLen;
+              if ((int)rngBelow(RNG_MOUSE, 100) < SWEEP_LONG_PAUSE_PCT) {
+                pauseLen = SWEEP_PAUSE_MAX_MS + rngBelow(RNG_MOUSE, SWEEP_LONG_PAUSE_MS - SWEEP_PAUSE_MAX_MS + 1);
+              } else {
+                pauseLen = SWEEP_PAUSE_MIN_MS + rngBelow(RNG_MOUSE, SWEEP_PAUSE_MAX_MS - SWEEP_PAUSE_MIN_MS + 1);
               }
+              sweepPauseStart = now;
+              sweepPauseDuration = pauseLen;
             }
             break;
+          }
 
           case SWEEP_PAUSING:
+            if (!sweepNextReady) {
+              // Net position is final now — plan the next sweep off the step path
+              planNextMove(sweepPlans[sweepActive ^ 1]);
+              sweepNextReady = true;
+            }
             if (now - sweepPauseStart >= sweepPauseDuration) {
-              sweepPhase = SWEEP_PLANNING;  // Plan next sweep
+              sweepPhase = SWEEP_PLANNING;  // Hand off to the planned sweep
             }
             break;
         }
       } else {
         // ---- Brownian mode (original) ----
-        if (now - lastMouseStep >= MOUSE_MOVE_STEP_MS) {
-          if (random(100) < 15) pickNewDirection();
-          // Ease-in-out: sine curve ramps amplitude 0 -> peak -> 0
-          float progress = (float)elapsed / (float)currentMouseJiggle;
-          int8_t amp = (int8_t)(mouse_brownian_amp(settings.mouseAmplitude, progress) + 0.5f);
-          if (amp > 0) {
-            int8_t dx = currentMouseDx * amp;
-            int8_t dy = currentMouseDy * amp;
-            sendMouseMove(dx, dy);
-            mouseNetX += dx;
-            mouseNetY += dy;
-          }
-          lastMouseStep = now;
-        }
+        BrownianMotion brownian = { elapsed };
+        motionTick(brownian, lastMouseStep, now);
       }
       break;
 
     case MOUSE_RETURNING:
-      if (mouseNetX == 0 && mouseNetY == 0) {
+      // A detent still ramping finishes at its own pace alongside the return
+      if (scrollRampUnits != 0 && now - lastScrollStep >= MOUSE_MOVE_STEP_MS) {
+        stepScrollRamp();
+        lastScrollStep = now;
+      }
+      if (mouseNetX == 0 && mouseNetY == 0 && scrollRampUnits == 0
+          && !hid_step_pending(stepQueue) && !mouse_coalesce_pending(moveQueue)) {
         mouseState = MOUSE_IDLE;
         lastMouseStateChange = now;
         scheduleNextMouseState();
@@ -261,12 +671,128 @@ void handleMouseStateMachine(unsigned long now) {
           easterEggActive = true;
           easterEggFrame = 0;
         }
-      } else if (now - lastMouseStep >= MOUSE_MOVE_STEP_MS) {
-        int8_t dx = mouse_return_step(mouseNetX); mouseNetX += dx;
-        int8_t dy = mouse_return_step(mouseNetY); mouseNetY += dy;
-        if (dx != 0 || dy != 0) sendMouseMove(dx, dy);
-        lastMouseStep = now;
+      } else if (mouseNetX != 0 || mouseNetY != 0) {
+        ReturnMotion home;
+        motionTick(home, lastMouseStep, now);
+      }
+      break;
+  }
+}
+
+// Mirrors handleMouseStateMachine(): the earliest time any of its checks
+// passes. A state that acts on the next pass reports now.
+bool mouseStateDeadline(unsigned long now, unsigned long& dueMs) {
+  bool any = false;
+  uint32_t due = 0;
+  uint32_t stepAt = hid_cadence_plan_at((uint32_t)lastMouseStep, MOUSE_MOVE_STEP_MS, MOTION_LEAD_MS);
+
+  switch (mouseState) {
+    case MOUSE_IDLE:
+      hid_deadline_fold(any, due, (uint32_t)(lastMouseStateChange + currentMouseIdle));
+      break;
+
+    case MOUSE_JIGGLING:
+      hid_deadline_fold(any, due, (uint32_t)(lastMouseStateChange + currentMouseJiggle));
+      if (settings.scrollEnabled) {
+        hid_deadline_fold(any, due, (uint32_t)(lastScrollTime + nextScrollInterval));
+      }
+      if (scrollRampUnits != 0) {
+        hid_deadline_fold(any, due, (uint32_t)(lastScrollStep + MOUSE_MOVE_STEP_MS));
+      }
+      if (traceActive || settings.mouseStyle == MOUSE_STYLE_BROWNIAN) {
+        hid_deadline_fold(any, due, stepAt);
+      } else if (sweepPhase == SWEEP_MOVING) {
+        hid_deadline_fold(any, due, stepAt);
+      } else if (sweepPhase == SWEEP_PAUSING && sweepNextReady) {
+        hid_deadline_fold(any, due, (uint32_t)(sweepPauseStart + sweepPauseDuration));
+      } else {
+        hid_deadline_fold(any, due, (uint32_t)now);  // plan or hand off a sweep
+      }
+      break;
+
+    case MOUSE_RETURNING:
+      if (scrollRampUnits != 0) {
+        hid_deadline_fold(any, due, (uint32_t)(lastScrollStep + MOUSE_MOVE_STEP_MS));
+      }
+      if (mouseNetX != 0 || mouseNetY != 0) {
+        hid_deadline_fold(any, due, stepAt);
+      } else if (scrollRampUnits == 0) {
+        // Home once the emitter has sent the last steps
+        unsigned long emitDue;
+        hid_deadline_fold(any, due, mouseEmitDeadline(now, emitDue) ? (uint32_t)emitDue
+                                                                     : (uint32_t)now);
       }
       break;
   }
+
+  if (any) dueMs = due;
+  return any;
+}
+
+// ============================================================================
+// Micro-benchmark hooks (bench.h) — plans, curves and the sub-pixel carry
+// are bench-owned, so a !bench run mid-sweep does not disturb the live
+// movement. Draws from RNG_MOUSE are not rewound.
+// ============================================================================
+
+#if GHOST_BENCH
+
+static SweepPlan benchPlan;
+static MouseSubpixel benchCarry;
+
+uint32_t benchTimeToParam(uint32_t ops) {
+#if GHOST_MOTION_FIXED
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    acc += mouse_time_to_param_q16((i % 1024) << 6);
+  }
+  return acc;
+#else
+  float acc = 0.0f;
+  for (uint32_t i = 0; i < ops; i++) {
+    acc += timeToParam((float)(i % 1024) / 1024.0f);
+  }
+  return (uint32_t)acc;
+#endif
+}
+
+uint32_t benchPlanNextSweep(uint32_t ops) {
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    planNextSweep(benchPlan, benchCarry);
+    acc += benchPlan.stepCount + (uint8_t)benchPlan.dx[0];
+  }
+  return acc;
+}
+
+uint32_t benchPlanNextReach(uint32_t ops) {
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    planNextReach(benchPlan, benchCarry);
+    acc += benchPlan.stepCount + (uint8_t)benchPlan.dx[0];
+  }
+  return acc;
 }
+
+uint32_t benchBezierStep(uint32_t ops) {
+  BezierCurve c;
+  uint16_t step = 0, stepCount = 0;
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    if (step >= stepCount) {
+      // Fixed 200x-120px curve over 100 steps
+      c.p0x = c.p0y = 0;
+      c.p1x = 60 << 8;  c.p1y = -(90 << 8);
+      c.p2x = 200 << 8; c.p2y = -(120 << 8);
+      c.lastX = c.lastY = 0;
+      stepCount = 100;
+      step = 0;
+    }
+    int8_t dx, dy;
+    bezierStepDelta(c, ++step, stepCount, benchCarry, dx, dy);
+    acc += (uint8_t)dx + (uint8_t)dy;
+  }
+  return acc;
+}
+
+#endif // GHOST_BENCH
@@ -4,6 +4,17 @@
 #include "config.h"
 
 void handleMouseStateMachine(unsigned long now);
+bool mouseStateDeadline(unsigned long now, unsigned long& dueMs);  // next time handleMouseStateMachine() has work
 void pickNewDirection();
+void discardQueuedMouseMoves();  // drop planned and coalesced steps (and sub-pixel residue) not yet sent
+
+// HID emitter side (hid_emit.h): move due steps into the coalescer and send
+// once the interval is up; earliest time that has work (false = nothing queued)
+void flushQueuedMouseMoves(unsigned long now);
+bool mouseEmitDeadline(unsigned long now, unsigned long& dueMs);
+
+// Plan one step for dueMs (motion.h); trackNet counts it into mouseNetX/Y
+// for the return home
+void queueMouseStep(int16_t dx, int16_t dy, unsigned long dueMs, bool trackNet);
 
 #endif // GHOST_MOUSE_H
@@ -16,6 +16,12 @@ inline int8_t mouse_fp8_round(int32_t fp) {
   return -(int8_t)((-fp + 128) >> 8);
 }
 
+// Same rounding for whole positions, which can exceed the int8 step range
+inline int32_t mouse_fp8_to_px(int32_t fp) {
+  if (fp >= 0) return (fp + 128) >> 8;
+  return -((-fp + 128) >> 8);
+}
+
 // Single return-phase step: moves net displacement toward zero by at most 5 units.
 // Guaranteed to converge: each call strictly reduces |net| until net == 0.
 inline int8_t mouse_return_step(int32_t net) {
@@ -36,4 +42,216 @@ inline int32_t mouse_bezier_eval(int32_t p0, int32_t p1, int32_t p2, float t) {
   return (int32_t)(omt * omt * (float)p0 + 2.0f * omt * t * (float)p1 + t * t * (float)p2);
 }
 
+// ============================================================================
+// Fixed-point motion (GHOST_MOTION_FIXED) — integer-only equivalents of the
+// float path above for cores without an FPU. Q15 trig (32768 = 1.0), Q16
+// time/curve parameter (65536 = 1.0); positions stay in the 8-bit fractional
+// format mouse_fp8_round() consumes.
+// ============================================================================
+
+#define MOUSE_Q15_ONE 32768
+#define MOUSE_Q16_ONE 65536
+
+// sin(deg) in Q15 for any integer angle in degrees
+inline int32_t mouse_sin_q15(int32_t deg) {
+  // sin(0..90 deg), one entry per degree
+  static const uint16_t SIN_Q15[91] = {
+        0,   572,  1144,  1715,  2286,  2856,  3425,  3993,  4560,  5126,
+     5690,  6252,  6813,  7371,  7927,  8481,  9032,  9580, 10126, 10668,
+    11207, 11743, 12275, 12803, 13328, 13848, 14365, 14876, 15384, 15886,
+    16384, 16877, 17364, 17847, 18324, 18795, 19261, 19720, 20174, 20622,
+    21063, 21498, 21926, 22348, 22763, 23170, 23571, 23965, 24351, 24730,
+    25102, 25466, 25822, 26170, 26510, 26842, 27166, 27482, 27789, 28088,
+    28378, 28660, 28932, 29197, 29452, 29698, 29935, 30163, 30382, 30592,
+    30792, 30983, 31164, 31336, 31499, 31651, 31795, 31928, 32052, 32166,
+    32270, 32365, 32449, 32524, 32588, 32643, 32688, 32723, 32748, 32763,
+    32768
+  };
+
+  deg %= 360;
+  if (deg < 0) deg += 360;
+  if (deg <= 90)  return  SIN_Q15[deg];
+  if (deg <= 180) return  SIN_Q15[180 - deg];
+  if (deg <= 270) return -(int32_t)SIN_Q15[deg - 180];
+  return -(int32_t)SIN_Q15[360 - deg];
+}
+
+inline int32_t mouse_cos_q15(int32_t deg) {
+  return mouse_sin_q15(deg + 90);
+}
+
+// num/den in Q16 (num <= den), without a 64-bit divide: both are shifted
+// down until den fits 16 bits, so (num << 16) cannot overflow
+inline uint32_t mouse_progress_q16(uint32_t num, uint32_t den) {
+  if (den == 0 || num >= den) return MOUSE_Q16_ONE;
+  while (den > 0xFFFF) {
+    num >>= 1;
+    den >>= 1;
+  }
+  return (num << 16) / den;
+}
+
+// Trapezoidal velocity profile (accel 20%, cruise 60%, decel 20%): time
+// progress -> Bezier parameter, both Q16. Same curve as the float
+// timeToParam() in mouse.cpp: t = 3.125p^2, 0.125 + 1.25(p - 0.2),
+// 1 - 3.125(1 - p)^2.
+inline uint32_t mouse_time_to_param_q16(uint32_t p) {
+  if (p >= MOUSE_Q16_ONE) return MOUSE_Q16_ONE;
+  if (p * 5 < MOUSE_Q16_ONE) {
+    return (uint32_t)(((uint64_t)p * p * 25) >> 19);
+  }
+  if (p * 5 < 4 * MOUSE_Q16_ONE) {
+    return 8192 + (p * 5 - MOUSE_Q16_ONE) / 4;
+  }
+  uint32_t r = MOUSE_Q16_ONE - p;
+  return MOUSE_Q16_ONE - (uint32_t)(((uint64_t)r * r * 25) >> 19);
+}
+
+// Quadratic Bezier with a Q16 parameter. Weights are Q32 and products are
+// 32x32->64 multiplies (a single mul/mulh pair on RV32IM).
+inline int32_t mouse_bezier_eval_q16(int32_t p0, int32_t p1, int32_t p2, uint32_t t) {
+  if (t >= MOUSE_Q16_ONE) return p2;
+  uint32_t omt = MOUSE_Q16_ONE - t;
+  int64_t sum = (int64_t)((uint64_t)omt * omt) * p0
+              + (int64_t)(2 * (uint64_t)omt * t) * p1
+              + (int64_t)((uint64_t)t * t) * p2;
+  // Truncate toward zero, as the float path's (int32_t) cast does
+  return (int32_t)(sum >= 0 ? sum >> 32 : -((-sum) >> 32));
+}
+
+// Minimum-jerk position profile s = 10p^3 - 15p^4 + 6p^5, Q16 in and out.
+// Zero velocity and acceleration at both ends; peak speed 1.875x average.
+inline uint32_t mouse_min_jerk_q16(uint32_t p) {
+  if (p >= MOUSE_Q16_ONE) return MOUSE_Q16_ONE;
+  uint64_t p2 = (uint64_t)p * p;                                 // Q32
+  uint64_t p3 = (p2 * p) >> 16;                                  // Q32
+  uint64_t inner = ((10ULL << 32) - ((15ULL * p) << 16) + 6 * p2) >> 16;  // Q16, >= 1.0
+  return (uint32_t)((p3 * inner + (1ULL << 31)) >> 32);
+}
+
+// log2(x) in Q8 for x >= 1: exact integer part, linear mantissa (error < 0.09)
+inline uint32_t mouse_log2_q8(uint32_t x) {
+  if (x <= 1) return 0;
+  uint32_t ip = 0;
+  while (x >> (ip + 1)) ip++;
+  uint32_t frac = ip >= 8 ? (x >> (ip - 8)) & 0xFF : (x << (8 - ip)) & 0xFF;
+  return (ip << 8) | frac;
+}
+
+// Fitts' law movement time: a + b * log2(dist / width + 1), in ms
+inline uint32_t mouse_fitts_ms(uint32_t dist, uint32_t width, uint16_t aMs, uint16_t bMs) {
+  if (width == 0) width = 1;
+  uint32_t bits = mouse_log2_q8(dist + width) - mouse_log2_q8(width);
+  return aMs + ((uint32_t)bMs * bits) / 256;
+}
+
+// sin(pi * progress) for progress in Q16, as Q15 (0 outside [0, 1)).
+// Interpolates the quarter-wave table at 1/256 degree.
+inline int32_t mouse_half_sine_q15(uint32_t progress) {
+  if (progress >= MOUSE_Q16_ONE) return 0;
+  uint32_t deg8 = (progress * 180) >> 8;   // degrees, 8 fractional bits
+  uint32_t deg = deg8 >> 8;
+  uint32_t frac = deg8 & 0xFF;
+  int32_t s0 = mouse_sin_q15((int32_t)deg);
+  int32_t s1 = mouse_sin_q15((int32_t)deg + 1);
+  int32_t s = s0 + (((s1 - s0) * (int32_t)frac) >> 8);
+  return s < 0 ? 0 : s;
+}
+
+// Brownian amplitude for progress (Q16), rounded to whole pixels the way the
+// float caller does ((int8_t)(amp + 0.5f))
+inline int8_t mouse_brownian_amp_q16(uint8_t amplitude, uint32_t progress) {
+  uint32_t s = (uint32_t)mouse_half_sine_q15(progress);
+  return (int8_t)(((uint32_t)amplitude * s + MOUSE_Q15_ONE / 2) >> 15);
+}
+
+// Same amplitude unrounded, in fp8 (1/256 px) for mouse_subpx_take()
+inline int32_t mouse_brownian_amp_fp8_q16(uint8_t amplitude, uint32_t progress) {
+  uint32_t s = (uint32_t)mouse_half_sine_q15(progress);
+  return (int32_t)(((uint32_t)amplitude * s + 64) >> 7);
+}
+
+// ============================================================================
+// Sub-pixel error diffusion — motion is computed in fp8 and only whole
+// pixels leave. The residue carries into the next step (and the next sweep)
+// instead of being rounded away per step. Nothing is sent until one axis
+// owes a whole pixel; the other axis then rides along, rounded, so slow or
+// shallow motion costs one report per pixel rather than one per step, and
+// the sent path stays within a pixel of the fractional one.
+// ============================================================================
+
+struct MouseSubpixel {
+  int32_t remX, remY;     // fp8 motion owed but not yet sent
+};
+
+inline int8_t mouse_subpx_axis(int32_t& rem) {
+  int32_t px = mouse_fp8_to_px(rem);
+  if (px > 127) px = 127;                  // the excess stays owed
+  if (px < -127) px = -127;
+  rem -= px * 256;
+  return (int8_t)px;
+}
+
+// Add an fp8 delta; take out the whole pixels due (0, 0 until one is)
+inline void mouse_subpx_take(MouseSubpixel& a, int32_t fpX, int32_t fpY, int8_t& dx, int8_t& dy) {
+  a.remX += fpX;
+  a.remY += fpY;
+  if (a.remX > -256 && a.remX < 256 && a.remY > -256 && a.remY < 256) {
+    dx = 0;
+    dy = 0;
+    return;
+  }
+  dx = mouse_subpx_axis(a.remX);
+  dy = mouse_subpx_axis(a.remY);
+}
+
+// ============================================================================
+// Report coalescing — mouse steps are queued and sent at most once per
+// transport interval (BLE connection event / USB poll). A report carries at
+// most +/-127 per axis; anything beyond stays queued for the next interval,
+// so the sum of sent deltas always equals the sum queued.
+// ============================================================================
+
+struct MouseCoalescer {
+  int32_t pendX, pendY;   // queued, not yet sent
+  int32_t pendW;          // queued wheel units (hidScrollUnits() scale)
+  uint32_t lastSendMs;
+  bool sent;              // lastSendMs is valid
+};
+
+inline void mouse_coalesce_add(MouseCoalescer& c, int32_t dx, int32_t dy) {
+  c.pendX += dx;
+  c.pendY += dy;
+}
+
+inline void mouse_coalesce_add_wheel(MouseCoalescer& c, int8_t dw) {
+  c.pendW += dw;
+}
+
+inline bool mouse_coalesce_pending(const MouseCoalescer& c) {
+  return c.pendX != 0 || c.pendY != 0 || c.pendW != 0;
+}
+
+inline int8_t mouse_coalesce_clamp(int32_t v) {
+  return (int8_t)(v > 127 ? 127 : (v < -127 ? -127 : v));
+}
+
+// Take the next report if one is due. Returns false (dx/dy/dw untouched) when
+// nothing is queued or the last report went out less than intervalMs ago.
+// Wheel rides in the same report as the move.
+inline bool mouse_coalesce_take(MouseCoalescer& c, uint32_t now, uint16_t intervalMs,
+                                int8_t& dx, int8_t& dy, int8_t& dw) {
+  if (!mouse_coalesce_pending(c)) return false;
+  if (c.sent && now - c.lastSendMs < intervalMs) return false;
+  dx = mouse_coalesce_clamp(c.pendX);
+  dy = mouse_coalesce_clamp(c.pendY);
+  dw = mouse_coalesce_clamp(c.pendW);
+  c.pendX -= dx;
+  c.pendY -= dy;
+  c.pendW -= dw;
+  c.lastSendMs = now;
+  c.sent = true;
+  return true;
+}
+
 #endif // GHOST_MOUSE_PURE_H
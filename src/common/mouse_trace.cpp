@@ -0,0 +1,54 @@
+#include <Arduino.h>
+#include "mouse_trace.h"
+#include "mouse_trace_pure.h"
+#include "hid_trace_pure.h"
+#include "platform_hal.h"
+
+// ============================================================================
+// Recorded mouse trace upload — text protocol handlers
+// ============================================================================
+
+void mouseTraceQuery(void (*writeLine)(const char* line)) {
+  char buf[96];
+  int len = snprintf(buf, sizeof(buf), "!mtraces|max=%u", (unsigned)MOUSE_TRACE_MAX_BYTES);
+  for (uint8_t i = 0; i < MOUSE_TRACE_SLOTS && len < (int)sizeof(buf); i++) {
+    len += snprintf(buf + len, sizeof(buf) - len, "|s%u=%lu", (unsigned)i,
+                    (unsigned long)mouseTraceSize(i));
+  }
+  writeLine(buf);
+}
+
+void mouseTraceAction(const char* cmd, void (*writeLine)(const char* line)) {
+  if (strncmp(cmd, "erase:", 6) == 0) {
+    uint8_t slot = (uint8_t)atoi(cmd + 6);
+    if (slot >= MOUSE_TRACE_SLOTS) { writeLine("-err:invalid slot"); return; }
+    mouseTraceErase(slot);
+    writeLine("+ok");
+    return;
+  }
+  if (cmd[0] != ':') { writeLine("-err:unknown action"); return; }
+
+  // :<slot>:<offset>:<base64>
+  char* end;
+  unsigned long slot = strtoul(cmd + 1, &end, 10);
+  if (*end != ':' || slot >= MOUSE_TRACE_SLOTS) { writeLine("-err:invalid slot"); return; }
+  unsigned long offset = strtoul(end + 1, &end, 10);
+  if (*end != ':') { writeLine("-err:invalid offset"); return; }
+  const char* b64 = end + 1;
+  size_t b64Len = strlen(b64);
+
+  static uint8_t chunk[384];  // static — a full 512-byte line decodes to < 384 bytes
+  if (b64Len / 4 * 3 > sizeof(chunk)) { writeLine("-err:chunk too large"); return; }
+  int n = hid_trace_b64_decode_line(b64, b64Len, chunk);
+  if (n <= 0) { writeLine("-err:invalid base64"); return; }
+  if (offset == 0 && (n < MOUSE_TRACE_HEADER_SIZE || chunk[0] != 'G' || chunk[1] != 'M'
+                      || chunk[2] != 'R' || chunk[3] != MOUSE_TRACE_VERSION)) {
+    writeLine("-err:not a mouse trace");
+    return;
+  }
+  if (!mouseTraceWrite((uint8_t)slot, (uint32_t)offset, chunk, (uint16_t)n)) {
+    writeLine("-err:write failed");
+    return;
+  }
+  writeLine("+ok");
+}
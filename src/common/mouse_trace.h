@@ -0,0 +1,20 @@
+#ifndef GHOST_MOUSE_TRACE_H
+#define GHOST_MOUSE_TRACE_H
+
+#include "config.h"
+
+// ============================================================================
+// Recorded mouse trace upload (text protocol, serial or BLE UART)
+//   ?mtraces                       !mtraces|max=<bytes>|s0=<bytes>|s1=...
+//   !mtrace:<slot>:<offset>:<b64>  append a chunk; offset 0 starts the slot over
+//   !mtraceerase:<slot>            empty a slot
+// tools/mouse_trace_pack.cpp --lines prints the !mtrace lines for a capture.
+// Storage is per platform (platform_hal.h); format in mouse_trace_pure.h.
+// ============================================================================
+
+void mouseTraceQuery(void (*writeLine)(const char* line));
+
+// cmd is the action after "!mtrace" (":<slot>:..." or "erase:<slot>")
+void mouseTraceAction(const char* cmd, void (*writeLine)(const char* line));
+
+#endif // GHOST_MOUSE_TRACE_H
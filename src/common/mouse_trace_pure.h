@@ -0,0 +1,182 @@
+#ifndef GHOST_MOUSE_TRACE_PURE_H
+#define GHOST_MOUSE_TRACE_PURE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// ============================================================================
+// Recorded mouse trace format (mouseStyle 3, "Replay")
+// Real mouse captures converted by tools/mouse_trace_pack.cpp and streamed
+// back from flash through a small fixed window — never loaded whole.
+//
+// Header (8 bytes):
+//   0  'G' 'M' 'R'  magic
+//   3  version (MOUSE_TRACE_VERSION)
+//   4  u32 LE       duration (ms) — sum of every sample's dt
+// Then tokens until end of file:
+//   varint(dt << 1 | run)  [varint(repeat - 2) if run]  zz(dx)  zz(dy)
+// A sample moves by (dx, dy) dt ms after the previous one. A run token
+// repeats the same sample `repeat` times — holds and constant-velocity
+// stretches cost one token. zz() is zigzag + LEB128 varint.
+// Pure header — no Arduino dependencies (unit-tested on host).
+// ============================================================================
+
+#define MOUSE_TRACE_VERSION      1
+#define MOUSE_TRACE_HEADER_SIZE  8
+#define MOUSE_TRACE_TOKEN_MAX    20   // 4 varints of <= 5 bytes
+#define MOUSE_TRACE_WINDOW       64   // decoder read-ahead (bytes)
+#define MOUSE_TRACE_SLOTS        4    // stored traces
+#define MOUSE_TRACE_MAX_BYTES    3072 // per slot, header included
+
+struct MouseTraceSample {
+  uint32_t dtMs;
+  int16_t dx, dy;
+};
+
+// ---- Varints ----
+
+inline uint32_t mouse_trace_zigzag(int32_t v) {
+  return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31);
+}
+
+inline int32_t mouse_trace_unzigzag(uint32_t v) {
+  return (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+}
+
+// Writes v at out (room for 5 bytes), returns the byte count
+inline uint8_t mouse_trace_put_varint(uint8_t* out, uint32_t v) {
+  uint8_t n = 0;
+  while (v >= 0x80) {
+    out[n++] = (uint8_t)(v | 0x80);
+    v >>= 7;
+  }
+  out[n++] = (uint8_t)v;
+  return n;
+}
+
+// Reads a varint from in[0..len). Returns bytes used, 0 if truncated or
+// longer than 5 bytes.
+inline uint8_t mouse_trace_get_varint(const uint8_t* in, size_t len, uint32_t& v) {
+  v = 0;
+  for (uint8_t n = 0; n < 5 && n < len; n++) {
+    v |= (uint32_t)(in[n] & 0x7F) << (7 * n);
+    if (!(in[n] & 0x80)) return (uint8_t)(n + 1);
+  }
+  return 0;
+}
+
+// ---- Encoder (host tool, tests) ----
+
+// Encode n samples into out. Returns the byte count, or 0 if cap is too small.
+inline size_t mouse_trace_encode(const MouseTraceSample* s, size_t n, uint8_t* out, size_t cap) {
+  if (cap < MOUSE_TRACE_HEADER_SIZE) return 0;
+  uint32_t duration = 0;
+  for (size_t i = 0; i < n; i++) duration += s[i].dtMs;
+  out[0] = 'G'; out[1] = 'M'; out[2] = 'R'; out[3] = MOUSE_TRACE_VERSION;
+  for (uint8_t b = 0; b < 4; b++) out[4 + b] = (uint8_t)(duration >> (8 * b));
+
+  size_t len = MOUSE_TRACE_HEADER_SIZE;
+  size_t i = 0;
+  while (i < n) {
+    size_t repeat = 1;
+    while (i + repeat < n && repeat < 0x7FFFFFFF
+           && s[i + repeat].dtMs == s[i].dtMs
+           && s[i + repeat].dx == s[i].dx && s[i + repeat].dy == s[i].dy) {
+      repeat++;
+    }
+    uint8_t tok[MOUSE_TRACE_TOKEN_MAX];
+    uint8_t t = mouse_trace_put_varint(tok, (s[i].dtMs << 1) | (repeat > 1 ? 1u : 0u));
+    if (repeat > 1) t += mouse_trace_put_varint(tok + t, (uint32_t)(repeat - 2));
+    t += mouse_trace_put_varint(tok + t, mouse_trace_zigzag(s[i].dx));
+    t += mouse_trace_put_varint(tok + t, mouse_trace_zigzag(s[i].dy));
+    if (len + t > cap) return 0;
+    memcpy(out + len, tok, t);
+    len += t;
+    i += repeat;
+  }
+  return len;
+}
+
+// ---- Streaming decoder ----
+
+// Reads up to len bytes at offset; returns the count (0 = end of trace)
+typedef uint16_t (*MouseTraceSource)(void* ctx, uint32_t offset, uint8_t* buf, uint16_t len);
+
+struct MouseTraceReader {
+  MouseTraceSource read;
+  void* ctx;
+  uint8_t win[MOUSE_TRACE_WINDOW];
+  uint16_t pos, len;       // unread bytes are win[pos..len)
+  uint32_t fileOff;        // source offset of win[len]
+  bool eof;                // source returned 0
+  uint32_t runLeft;        // repeats of the current sample still to emit
+  uint32_t runDt;
+  int32_t runDx, runDy;
+};
+
+// Keep at least MOUSE_TRACE_TOKEN_MAX bytes buffered while the source has more
+inline void mouse_trace_fill(MouseTraceReader& r) {
+  if (r.eof || r.len - r.pos >= MOUSE_TRACE_TOKEN_MAX) return;
+  uint16_t keep = (uint16_t)(r.len - r.pos);
+  memmove(r.win, r.win + r.pos, keep);
+  r.pos = 0;
+  r.len = keep;
+  while (!r.eof && r.len < MOUSE_TRACE_WINDOW) {
+    uint16_t got = r.read(r.ctx, r.fileOff, r.win + r.len, (uint16_t)(MOUSE_TRACE_WINDOW - r.len));
+    if (got == 0) r.eof = true;
+    r.len = (uint16_t)(r.len + got);
+    r.fileOff += got;
+  }
+}
+
+// Validate the header and position at the first token. durationMs may be NULL.
+inline bool mouse_trace_open(MouseTraceReader& r, MouseTraceSource read, void* ctx,
+                             uint32_t* durationMs) {
+  r.read = read;
+  r.ctx = ctx;
+  r.pos = r.len = 0;
+  r.fileOff = 0;
+  r.eof = false;
+  r.runLeft = 0;
+  mouse_trace_fill(r);
+  if (r.len < MOUSE_TRACE_HEADER_SIZE) return false;
+  const uint8_t* h = r.win;
+  if (h[0] != 'G' || h[1] != 'M' || h[2] != 'R' || h[3] != MOUSE_TRACE_VERSION) return false;
+  if (durationMs) {
+    *durationMs = (uint32_t)h[4] | (uint32_t)h[5] << 8 | (uint32_t)h[6] << 16 | (uint32_t)h[7] << 24;
+  }
+  r.pos = MOUSE_TRACE_HEADER_SIZE;
+  return true;
+}
+
+// Next sample. False at end of trace or on a truncated token.
+inline bool mouse_trace_next(MouseTraceReader& r, uint32_t& dtMs, int32_t& dx, int32_t& dy) {
+  if (r.runLeft == 0) {
+    mouse_trace_fill(r);
+    const uint8_t* p = r.win + r.pos;
+    size_t avail = r.len - r.pos;
+    if (avail == 0) return false;
+    uint32_t tag, repeat = 0, zx, zy;
+    uint8_t n = mouse_trace_get_varint(p, avail, tag), used = n;
+    if (n && (tag & 1)) { n = mouse_trace_get_varint(p + used, avail - used, repeat); used += n; }
+    if (n) { n = mouse_trace_get_varint(p + used, avail - used, zx); used += n; }
+    if (n) { n = mouse_trace_get_varint(p + used, avail - used, zy); used += n; }
+    if (!n) {
+      r.pos = r.len;  // corrupt tail — stop here
+      return false;
+    }
+    r.pos = (uint16_t)(r.pos + used);
+    r.runDt = tag >> 1;
+    r.runDx = mouse_trace_unzigzag(zx);
+    r.runDy = mouse_trace_unzigzag(zy);
+    r.runLeft = (tag & 1) ? repeat + 2 : 1;
+  }
+  r.runLeft--;
+  dtMs = r.runDt;
+  dx = r.runDx;
+  dy = r.runDy;
+  return true;
+}
+
+#endif // GHOST_MOUSE_TRACE_PURE_H
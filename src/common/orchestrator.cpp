@@ -3,9 +3,14 @@
 #include "keys.h"
 #include "platform_hal.h"
 #include "mouse.h"
+#include "motion.h"
 #include "timing.h"
 #include "settings.h"
 #include "schedule.h"
+#include "rng.h"
+#include "alias_pure.h"
+#include "day_timeline_pure.h"
+#include "bench.h"
 
 // ============================================================================
 // HELPERS
@@ -30,21 +35,21 @@ static const WorkModeDef& currentWorkMode() {
 // Random in range [lo, hi] (inclusive)
 static uint32_t randRange(uint32_t lo, uint32_t hi) {
   if (lo >= hi) return lo;
-  return lo + random(hi - lo + 1);
+  return lo + rngBelow(RNG_ORCH, hi - lo + 1);
 }
 
 // Apply ±20% randomness to a duration
 static unsigned long jitter(unsigned long base) {
   if (base == 0) return 0;
   long variation = (long)base * RANDOMNESS_PERCENT / 100;
-  return (unsigned long)max(1L, (long)base + random(-variation, variation + 1));
+  return (unsigned long)max(1L, (long)base + rngRange(RNG_ORCH, -variation, variation + 1));
 }
 
 // Scale a duration by job performance level (compressed curve).
 // scaleUp=true:  active durations (typing, mousing) — higher level = longer activity
 // scaleUp=false: idle durations (gaps, delays) — higher level = shorter idle
 // level 8 ≈ 1x, level 11 → 1.4x active / 0.71x idle
-static unsigned long scaleByPerformance(unsigned long value, bool scaleUp) {
+unsigned long scaleByPerformance(unsigned long value, bool scaleUp) {
   uint8_t level = settings.jobPerformance;
   if (scaleUp) {
     return (uint64_t)value * level * 7 / 55;  // level 0→0, level 11→1.4x
@@ -83,19 +88,44 @@ static uint16_t totalNonLunchMinutes() {
   return (total > 0) ? total : 1;  // guard against division by zero
 }
 
-// Scaled block duration in minutes for the given block index.
-// Non-lunch blocks scale proportionally to fill shiftDuration.
-// Lunch blocks use settings.lunchDuration (or 0 if lunch disabled).
-static uint16_t scaledBlockDurationMin(uint8_t blockIdx) {
+// Scaled block boundaries for the current template (day_timeline_pure.h).
+// Non-lunch blocks scale proportionally to fill shiftDuration; lunch blocks
+// use settings.lunchDuration (or 0 if lunch disabled). Rebuilt only when the
+// job, shift or lunch length changes, or sim data is reloaded.
+static DayTimeline<MAX_DAY_BLOCKS> timeline;
+static bool timelineStale = true;
+static uint8_t timelineJob;
+static uint16_t timelineShift;
+static uint8_t timelineLunch;
+
+static const DayTimeline<MAX_DAY_BLOCKS>& dayTimeline() {
+  if (!timelineStale && timelineJob == settings.jobSimulation &&
+      timelineShift == settings.shiftDuration && timelineLunch == settings.lunchDuration) {
+    return timeline;
+  }
   const DayTemplate& tmpl = currentTemplate();
-  if (blockIdx >= tmpl.numBlocks) return 0;
-  const TimeBlock& block = tmpl.blocks[blockIdx];
-
-  if (block.isLunch) {
-    return lunchEnabled() ? settings.lunchDuration : 0;
+  uint16_t nonLunch = totalNonLunchMinutes();
+  uint16_t dur[MAX_DAY_BLOCKS];
+  for (uint8_t i = 0; i < tmpl.numBlocks && i < MAX_DAY_BLOCKS; i++) {
+    const TimeBlock& block = tmpl.blocks[i];
+    if (block.isLunch) {
+      dur[i] = lunchEnabled() ? settings.lunchDuration : 0;
+    } else {
+      // block.dur * shiftDuration / totalNonLunch (uint32_t intermediate)
+      dur[i] = (uint16_t)((uint32_t)block.durationMinutes * settings.shiftDuration / nonLunch);
+    }
   }
-  // Scale non-lunch: block.dur * shiftDuration / totalNonLunch (uint32_t intermediate)
-  return (uint16_t)((uint32_t)block.durationMinutes * settings.shiftDuration / totalNonLunchMinutes());
+  timeline_build(timeline, dur, tmpl.numBlocks);
+  timelineJob = settings.jobSimulation;
+  timelineShift = settings.shiftDuration;
+  timelineLunch = settings.lunchDuration;
+  timelineStale = false;
+  return timeline;
+}
+
+// Scaled block duration in minutes for the given block index
+static uint16_t scaledBlockDurationMin(uint8_t blockIdx) {
+  return timeline_duration(dayTimeline(), blockIdx);
 }
 
 // Pick a random cardinal/diagonal direction for micro-movements
@@ -104,41 +134,74 @@ static void pickSwipeDirection(int8_t& dx, int8_t& dy) {
   static const int8_t dirs[][2] = {
     {0,-1}, {1,-1}, {1,0}, {1,1}, {0,1}, {-1,1}, {-1,0}, {-1,-1}
   };
-  uint8_t d = random(8);
+  uint8_t d = rngBelow(RNG_ORCH, 8);
   dx = dirs[d][0];
   dy = dirs[d][1];
 }
 
 // ============================================================================
 // WEIGHTED RANDOM SELECTION
+// Alias tables (alias_pure.h) built by rebuildSimSamplers(), so a draw is
+// one RNG call whatever the pool size
 // ============================================================================
 
-// Select a work mode from a block's weighted pool
-static WorkModeId selectWeightedMode(const TimeBlock& block) {
-  uint16_t totalWeight = 0;
-  for (uint8_t i = 0; i < block.numModes; i++) {
-    totalWeight += block.modes[i].weight;
+// Phase outcomes after IDLE or SWITCHING: ~20% idle again, else 8% K+M,
+// 4% M+K and the remaining 88% split by kbPercent
+#define NEXT_PHASE_OUTCOMES 5
+static const ActivityPhase NEXT_PHASES[NEXT_PHASE_OUTCOMES] = {
+  PHASE_IDLE, PHASE_KB_MOUSE, PHASE_MOUSE_KB, PHASE_TYPING, PHASE_MOUSING
+};
+
+static AliasTable<MAX_BLOCK_MODES> blockModeSampler[JOB_SIM_COUNT][MAX_DAY_BLOCKS];
+static AliasTable<PROFILE_COUNT> profileSampler[WMODE_COUNT];
+static AliasTable<NEXT_PHASE_OUTCOMES> nextPhaseSampler[WMODE_COUNT];
+
+void rebuildSimSamplers() {
+  timelineStale = true;
+  uint32_t w[MAX_BLOCK_MODES];
+  for (uint8_t j = 0; j < JOB_SIM_COUNT; j++) {
+    const DayTemplate& tmpl = DAY_TEMPLATES[j];
+    for (uint8_t b = 0; b < tmpl.numBlocks && b < MAX_DAY_BLOCKS; b++) {
+      const TimeBlock& block = tmpl.blocks[b];
+      for (uint8_t i = 0; i < block.numModes; i++) w[i] = block.modes[i].weight;
+      alias_build(blockModeSampler[j][b], w, block.numModes);
+    }
   }
-  if (totalWeight == 0) return WMODE_EMAIL_READ;  // fallback
-
-  uint16_t roll = random(totalWeight);
-  uint16_t cumulative = 0;
-  for (uint8_t i = 0; i < block.numModes; i++) {
-    cumulative += block.modes[i].weight;
-    if (roll < cumulative) return block.modes[i].modeId;
+  for (uint8_t m = 0; m < WMODE_COUNT; m++) {
+    const WorkModeDef& mode = workModes[m];
+    uint32_t pw[PROFILE_COUNT] = {
+      mode.profileWeights.lazyPct, mode.profileWeights.normalPct, mode.profileWeights.busyPct
+    };
+    alias_build(profileSampler[m], pw, PROFILE_COUNT);
+
+    // Parts per million: 20% idle, then of the 80% left 8% / 4% / 88%
+    uint8_t kb = (mode.kbPercent > 100) ? 100 : mode.kbPercent;
+    uint32_t phw[NEXT_PHASE_OUTCOMES] = {
+      200000, 64000, 32000, 7040u * kb, 7040u * (100 - kb)
+    };
+    alias_build(nextPhaseSampler[m], phw, NEXT_PHASE_OUTCOMES);
   }
-  return block.modes[0].modeId;  // safety fallback
+}
+
+static uint8_t modeIndex(const WorkModeDef& mode) {
+  return (mode.id < WMODE_COUNT) ? mode.id : 0;
+}
+
+// Select a work mode from the current template's weighted pool for a block
+static WorkModeId selectWeightedMode(uint8_t blockIdx) {
+  const DayTemplate& tmpl = currentTemplate();
+  if (blockIdx >= tmpl.numBlocks) blockIdx = 0;
+  uint8_t job = (settings.jobSimulation < JOB_SIM_COUNT) ? settings.jobSimulation : 0;
+  const AliasTable<MAX_BLOCK_MODES>& t = blockModeSampler[job][blockIdx];
+  if (t.count == 0) return WMODE_EMAIL_READ;  // fallback: no weight
+  return tmpl.blocks[blockIdx].modes[alias_pick(t, rngNext(RNG_ORCH))].modeId;
 }
 
 // Select auto-profile from work mode's profile weights
 static Profile selectAutoProfile(const WorkModeDef& mode) {
-  uint16_t total = mode.profileWeights.lazyPct + mode.profileWeights.normalPct + mode.profileWeights.busyPct;
-  if (total == 0) return PROFILE_NORMAL;
-
-  uint16_t roll = random(total);
-  if (roll < mode.profileWeights.lazyPct) return PROFILE_LAZY;
-  if (roll < mode.profileWeights.lazyPct + mode.profileWeights.normalPct) return PROFILE_NORMAL;
-  return PROFILE_BUSY;
+  const AliasTable<PROFILE_COUNT>& t = profileSampler[modeIndex(mode)];
+  if (t.count == 0) return PROFILE_NORMAL;
+  return (Profile)alias_pick(t, rngNext(RNG_ORCH));
 }
 
 // ============================================================================
@@ -147,21 +210,14 @@ static Profile selectAutoProfile(const WorkModeDef& mode) {
 
 // Select next activity phase based on KB:MS ratio with idle interleaving
 static ActivityPhase selectNextPhase(const WorkModeDef& mode, ActivityPhase current) {
-  // ~20% chance of idle phase
-  if (random(100) < 20) return PHASE_IDLE;
-
-  // Active phases transition through SWITCHING
+  // Active phases: ~20% chance of idle, else transition through SWITCHING
   if (current == PHASE_TYPING || current == PHASE_MOUSING ||
       current == PHASE_KB_MOUSE || current == PHASE_MOUSE_KB) {
-    return PHASE_SWITCHING;
+    return (rngBelow(RNG_ORCH, 100) < 20) ? PHASE_IDLE : PHASE_SWITCHING;
   }
 
-  // After IDLE or SWITCHING: pick next active phase
-  // 8% K+M, 4% M+K, remaining 88% split by kbPercent
-  uint8_t roll = random(100);
-  if (roll < 8) return PHASE_KB_MOUSE;
-  if (roll < 12) return PHASE_MOUSE_KB;
-  return (random(100) < mode.kbPercent) ? PHASE_TYPING : PHASE_MOUSING;
+  // After IDLE or SWITCHING: one draw over idle and the active phases
+  return NEXT_PHASES[alias_pick(nextPhaseSampler[modeIndex(mode)], rngNext(RNG_ORCH))];
 }
 
 // Calculate phase duration from current work mode and profile
@@ -248,8 +304,7 @@ static void startBlock(uint8_t blockIdx, unsigned long now) {
 }
 
 static void startMode(unsigned long now) {
-  const TimeBlock& block = currentBlock();
-  orch.modeId = selectWeightedMode(block);
+  orch.modeId = selectWeightedMode(orch.blockIdx);
   orch.modeStartMs = now;
   orch.scrollPos[1] = 0; orch.scrollDir[1] = 1; orch.scrollTimer[1] = now;
 
@@ -270,12 +325,14 @@ static void startMode(unsigned long now) {
   );
 
   // Start with first phase (typing or mousing based on ratio)
-  orch.phase = (random(100) < mode.kbPercent) ? PHASE_TYPING : PHASE_MOUSING;
+  orch.phase = (rngBelow(RNG_ORCH, 100) < mode.kbPercent) ? PHASE_TYPING : PHASE_MOUSING;
   orch.phaseStartMs = now;
   orch.phaseDurationMs = phaseDuration(orch.phase, mode, orch.autoProfile);
 
-  // Reset burst state
+  // Reset burst state — a key still down (M+K hold, tap mid-hold) is
+  // released, or a mode change mid-hold would leave it stuck
   orch.burstKeysRemaining = 0;
+  if (orch.keyDown) sendKeyUp();
   orch.keyDown = false;
   orch.inBurstGap = false;
 
@@ -320,7 +377,7 @@ static void startPhase(ActivityPhase phase, unsigned long now) {
     pickSwipeDirection(orch.kbmsSwipeDx, orch.kbmsSwipeDy);
     orch.kbmsSubPhaseStartMs = now;
     orch.kbmsSubPhaseDurMs = KBMS_SWIPE_DUR_MS;
-    orch.kbmsLastStepMs = now;  // prevent stale timestamp on re-entry
+    orch.swipeLastStepMs = now;  // prevent stale timestamp on re-entry
     orch.kbmsKeysRemaining = 0;
     orch.keyDown = false;
     orch.inBurstGap = false;
@@ -333,7 +390,7 @@ static void startPhase(ActivityPhase phase, unsigned long now) {
     orch.mskbKeyHoldTarget = randRange(MSKB_KEY_HOLD_MIN_MS, MSKB_KEY_HOLD_MAX_MS);
     orch.mskbSubPhaseStartMs = now;
     orch.mskbSubPhaseDurMs = MSKB_SETUP_DELAY_MS;
-    orch.mskbLastStepMs = now;  // prevent stale timestamp on re-entry
+    orch.swipeLastStepMs = now;  // prevent stale timestamp on re-entry
     orch.keyDown = false;
     orch.keyDownMs = now;  // sane baseline if key press is skipped
     pickSwipeDirection(orch.mskbStrokeDx, orch.mskbStrokeDy);
@@ -344,16 +401,34 @@ static void startPhase(ActivityPhase phase, unsigned long now) {
 // BURST STATE MACHINE (PHASE_TYPING sub-FSM)
 // ============================================================================
 
+// Tap the next key of a burst. The emitter releases it after
+// currentKeyHoldMs; orch.keyDown stays set until then so the burst waits.
+static void tapBurstKey(const PhaseTiming& t, unsigned long now) {
+  // Save index before pickNextKey() advances it
+  uint8_t pressedKeyIdx = nextKeyIndex;
+  // Modifier keys get longer hold — check the PRESSED key, not the next one
+  const KeyDef& key = AVAILABLE_KEYS[pressedKeyIdx];
+  if (key.isModifier) {
+    orch.currentKeyHoldMs = (uint16_t)randRange(150, 400);
+  } else {
+    orch.currentKeyHoldMs = (uint16_t)randRange(t.keyHoldMinMs, t.keyHoldMaxMs);
+  }
+  sendKeyTap(pressedKeyIdx, orch.currentKeyHoldMs);
+  pickNextKey();
+  orch.keyDown = true;
+  orch.keyDownMs = now;
+  orch.lastSimKeystrokeMs = now;
+}
+
 static void tickBurst(unsigned long now) {
   if (!keyEnabled || !hasPopulatedSlot()) return;
 
   const WorkModeDef& mode = currentWorkMode();
   const PhaseTiming& t = mode.timing[orch.autoProfile];
 
-  // If key is currently held down, check if it's time to release
+  // Key tap in progress — the emitter releases it; the next key waits for the hold
   if (orch.keyDown) {
     if (now - orch.keyDownMs >= orch.currentKeyHoldMs) {
-      sendKeyUp();
       orch.keyDown = false;
       orch.burstKeysRemaining--;
 
@@ -389,21 +464,7 @@ static void tickBurst(unsigned long now) {
 
   // Ready to press next key?
   if (now >= orch.nextKeyMs && orch.burstKeysRemaining > 0) {
-    // Press key down — save index before pickNextKey() advances it
-    uint8_t pressedKeyIdx = nextKeyIndex;
-    sendKeyDown(pressedKeyIdx);
-    pickNextKey();
-    orch.keyDown = true;
-    orch.keyDownMs = now;
-    orch.lastSimKeystrokeMs = now;
-
-    // Modifier keys get longer hold — check the PRESSED key, not the next one
-    const KeyDef& key = AVAILABLE_KEYS[pressedKeyIdx];
-    if (key.isModifier) {
-      orch.currentKeyHoldMs = (uint16_t)randRange(150, 400);
-    } else {
-      orch.currentKeyHoldMs = (uint16_t)randRange(t.keyHoldMinMs, t.keyHoldMaxMs);
-    }
+    tapBurstKey(t, now);
   }
 }
 
@@ -423,7 +484,7 @@ static void tickMousePhase(unsigned long now) {
   // Phantom click: 25% chance on RETURNING → IDLE transition
   if (settings.phantomClicks && hasPopulatedClickSlot() &&
       prevState == MOUSE_RETURNING && mouseState == MOUSE_IDLE) {
-    if (random(100) < 25) {
+    if (rngBelow(RNG_ORCH, 100) < 25) {
       uint8_t action = pickNextClick();
       executeClick(action, (uint16_t)randRange(50, 150));
       orch.lastPhantomClickMs = millis();
@@ -454,12 +515,10 @@ static void tickKbMouse(unsigned long now) {
   switch (orch.kbmsSubPhase) {
 
     case KBMS_MOUSE_SWIPE:
-      // Send small mouse deltas at MOUSE_MOVE_STEP_MS intervals
+      // Small mouse steps through the shared motion scheduler
       if (mouseEnabled && elapsed < orch.kbmsSubPhaseDurMs) {
-        if (now - orch.kbmsLastStepMs >= MOUSE_MOVE_STEP_MS) {
-          sendMouseMove(orch.kbmsSwipeDx, orch.kbmsSwipeDy);
-          orch.kbmsLastStepMs = now;
-        }
+        SwipeMotion swipe = { orch.kbmsSwipeDx, orch.kbmsSwipeDy };
+        motionTick(swipe, orch.swipeLastStepMs, now);
       } else if (elapsed >= orch.kbmsSubPhaseDurMs) {
         orch.kbmsSwipesRemaining--;
         if (orch.kbmsSwipesRemaining > 0) {
@@ -517,26 +576,14 @@ static void tickKbMouse(unsigned long now) {
 
         if (orch.keyDown) {
           if (now - orch.keyDownMs >= orch.currentKeyHoldMs) {
-            sendKeyUp();
-            orch.keyDown = false;
+            orch.keyDown = false;  // released by the emitter
             orch.burstKeysRemaining--;
             if (orch.burstKeysRemaining > 0) {
               orch.nextKeyMs = now + scaleByPerformance(randRange(t.interKeyMinMs, t.interKeyMaxMs), false);
             }
           }
         } else if (now >= orch.nextKeyMs && orch.burstKeysRemaining > 0) {
-          uint8_t pressedKeyIdx = nextKeyIndex;
-          sendKeyDown(pressedKeyIdx);
-          pickNextKey();
-          orch.keyDown = true;
-          orch.keyDownMs = now;
-          orch.lastSimKeystrokeMs = now;
-          const KeyDef& key = AVAILABLE_KEYS[pressedKeyIdx];
-          if (key.isModifier) {
-            orch.currentKeyHoldMs = (uint16_t)randRange(150, 400);
-          } else {
-            orch.currentKeyHoldMs = (uint16_t)randRange(t.keyHoldMinMs, t.keyHoldMaxMs);
-          }
+          tapBurstKey(t, now);
         }
       }
       // Check if typing burst complete
@@ -589,12 +636,10 @@ static void tickMouseKb(unsigned long now) {
       break;
 
     case MSKB_MOUSE_DRAW:
-      // Send mouse deltas while key is held
+      // Stroke steps while the key is held
       if (mouseEnabled) {
-        if (now - orch.mskbLastStepMs >= MOUSE_MOVE_STEP_MS) {
-          sendMouseMove(orch.mskbStrokeDx, orch.mskbStrokeDy);
-          orch.mskbLastStepMs = now;
-        }
+        SwipeMotion stroke = { orch.mskbStrokeDx, orch.mskbStrokeDy };
+        motionTick(stroke, orch.swipeLastStepMs, now);
       }
 
       if (elapsed >= orch.mskbSubPhaseDurMs) {
@@ -732,7 +777,7 @@ void tickOrchestrator(unsigned long now) {
   if (now - orch.phaseStartMs >= orch.phaseDurationMs) {
     // If in mousing and mouse is mid-return, wait (cap at 2s)
     if (orch.phase == PHASE_MOUSING && mouseState == MOUSE_RETURNING) {
-      if (now - orch.phaseStartMs < orch.phaseDurationMs + 2000) {
+      if (now - orch.phaseStartMs < orch.phaseDurationMs + RETURN_WAIT_CAP_MS) {
         // Still waiting for return to complete
         handleMouseStateMachine(now);
         return;
@@ -782,14 +827,13 @@ void tickOrchestrator(unsigned long now) {
   // 6. Keystroke keepalive — ensure non-zero keyboard in every 2-min window
   if (keyEnabled && hasPopulatedSlot() && !phaseHasKeystrokes(orch.phase)) {
     if (orch.keepaliveBurstRemaining > 0 && now >= orch.keepaliveNextKeyMs) {
-      // Continue sending keepalive burst (silent — no buzzer during non-typing phases)
-      sendKeyDown(nextKeyIndex, true);
+      // Continue sending keepalive burst (silent — no buzzer during non-typing
+      // phases). Brief hold for robust HID host recognition; the emitter
+      // releases the key, so the loop never waits on it.
+      sendKeyTap(nextKeyIndex, (uint16_t)randRange(30, 60), true);
       pickNextKey();
       orch.lastSimKeystrokeMs = now;
       orch.keepaliveBurstRemaining--;
-      // Brief hold for robust HID host recognition, then release
-      delay(randRange(30, 60));
-      sendKeyUp();
       orch.keepaliveNextKeyMs = now + randRange(200, 600);
     } else if (orch.keepaliveBurstRemaining == 0 &&
                now - orch.lastSimKeystrokeMs >= ACTIVITY_FLOOR_GAP_MS) {
@@ -801,6 +845,134 @@ void tickOrchestrator(unsigned long now) {
   }
 }
 
+// Earliest time a typing sub-FSM (tickBurst / K+M typing) acts
+static void foldBurstDeadline(bool& any, uint32_t& due) {
+  if (orch.keyDown) {
+    hid_deadline_fold(any, due, (uint32_t)(orch.keyDownMs + orch.currentKeyHoldMs));
+  } else if (orch.inBurstGap) {
+    hid_deadline_fold(any, due, (uint32_t)orch.burstGapEndMs);
+  } else {
+    hid_deadline_fold(any, due, (uint32_t)orch.nextKeyMs);
+  }
+}
+
+// Mirrors tickOrchestrator(): the earliest time any of its timers fires or
+// its current phase has work. A step that acts on the next pass reports now.
+unsigned long orchestratorDeadline(unsigned long now) {
+  bool any = false;
+  uint32_t due = 0;
+  unsigned long mouseDue;
+
+  // 1-3. Block (and lunch force-jump), mode and profile stint timers
+  hid_deadline_fold(any, due, (uint32_t)(orch.blockStartMs + orch.blockDurationMs));
+  if (!orch.lunchCompleted && orch.lunchBlockIdx != 0xFF && orch.blockIdx < orch.lunchBlockIdx) {
+    hid_deadline_fold(any, due, (uint32_t)(orch.dayStartMs + lunchTargetMs()));
+  }
+  hid_deadline_fold(any, due, (uint32_t)(orch.modeStartMs + orch.modeDurationMs));
+  hid_deadline_fold(any, due, (uint32_t)(orch.profileStintStartMs + orch.profileStintMs));
+
+  // 4. Phase timer — past it, the phase either ends on the next pass or
+  // waits out the mouse's return home
+  if (now - orch.phaseStartMs >= orch.phaseDurationMs) {
+    if (orch.phase == PHASE_MOUSING && mouseState == MOUSE_RETURNING) {
+      hid_deadline_fold(any, due, (uint32_t)(orch.phaseStartMs + orch.phaseDurationMs + RETURN_WAIT_CAP_MS));
+      if (mouseStateDeadline(now, mouseDue)) hid_deadline_fold(any, due, (uint32_t)mouseDue);
+    } else {
+      hid_deadline_fold(any, due, (uint32_t)now);
+    }
+    return due;
+  }
+  hid_deadline_fold(any, due, (uint32_t)(orch.phaseStartMs + orch.phaseDurationMs));
+
+  // 5. Current phase
+  bool typing = keyEnabled && hasPopulatedSlot();
+  switch (orch.phase) {
+    case PHASE_TYPING:
+      if (typing) {
+        if (!orch.keyDown && !orch.inBurstGap && orch.burstKeysRemaining == 0) {
+          hid_deadline_fold(any, due, (uint32_t)now);  // start the next burst
+        } else {
+          foldBurstDeadline(any, due);
+        }
+      }
+      break;
+
+    case PHASE_MOUSING:
+      if (mouseEnabled && mouseStateDeadline(now, mouseDue)) {
+        hid_deadline_fold(any, due, (uint32_t)mouseDue);
+      }
+      break;
+
+    case PHASE_SWITCHING:
+      if (settings.windowSwitching && orch.autoProfile != PROFILE_LAZY) {
+        hid_deadline_fold(any, due, (uint32_t)orch.nextWindowSwitchMs);
+      }
+      break;
+
+    case PHASE_KB_MOUSE: {
+      uint32_t subEnd = (uint32_t)(orch.kbmsSubPhaseStartMs + orch.kbmsSubPhaseDurMs);
+      switch (orch.kbmsSubPhase) {
+        case KBMS_MOUSE_SWIPE:
+          if (mouseEnabled && now - orch.kbmsSubPhaseStartMs < orch.kbmsSubPhaseDurMs) {
+            hid_deadline_fold(any, due, hid_cadence_plan_at((uint32_t)orch.swipeLastStepMs,
+                                                            MOUSE_MOVE_STEP_MS, MOTION_LEAD_MS));
+          }
+          hid_deadline_fold(any, due, subEnd);
+          break;
+        case KBMS_CLICK:
+          hid_deadline_fold(any, due, (uint32_t)now);
+          break;
+        case KBMS_TYPING:
+          if (orch.burstKeysRemaining == 0 && !orch.keyDown) {
+            hid_deadline_fold(any, due, (uint32_t)now);  // on to the pause
+          } else if (typing && orch.burstKeysRemaining > 0) {
+            foldBurstDeadline(any, due);
+          }
+          break;
+        default:  // KBMS_CLICK_PAUSE, KBMS_TYPING_PAUSE
+          hid_deadline_fold(any, due, subEnd);
+          break;
+      }
+      break;
+    }
+
+    case PHASE_MOUSE_KB: {
+      uint32_t subEnd = (uint32_t)(orch.mskbSubPhaseStartMs + orch.mskbSubPhaseDurMs);
+      switch (orch.mskbSubPhase) {
+        case MSKB_KEY_DOWN:
+          if (!orch.keyDown && typing) hid_deadline_fold(any, due, (uint32_t)now);
+          if (orch.keyDown) hid_deadline_fold(any, due, subEnd);
+          break;
+        case MSKB_MOUSE_DRAW:
+          if (mouseEnabled) {
+            hid_deadline_fold(any, due, hid_cadence_plan_at((uint32_t)orch.swipeLastStepMs,
+                                                            MOUSE_MOVE_STEP_MS, MOTION_LEAD_MS));
+          }
+          hid_deadline_fold(any, due, subEnd);
+          break;
+        default:  // MSKB_KEY_UP_PAUSE
+          hid_deadline_fold(any, due, subEnd);
+          break;
+      }
+      break;
+    }
+
+    default:  // PHASE_IDLE
+      break;
+  }
+
+  // 6. Keystroke keepalive
+  if (typing && !phaseHasKeystrokes(orch.phase)) {
+    if (orch.keepaliveBurstRemaining > 0) {
+      hid_deadline_fold(any, due, (uint32_t)orch.keepaliveNextKeyMs);
+    } else {
+      hid_deadline_fold(any, due, (uint32_t)(orch.lastSimKeystrokeMs + ACTIVITY_FLOOR_GAP_MS));
+    }
+  }
+
+  return due;
+}
+
 void skipWorkMode() {
   unsigned long now = millis();
   // Release held key
@@ -853,30 +1025,22 @@ void syncOrchestratorTime(uint32_t daySeconds) {
 
   uint32_t offsetMin = (daySeconds - schedStartSecs) / 60;
 
-  // Find the correct block for this time offset using cumulative scaled durations
-  uint16_t cumulative = 0;
-  for (uint8_t i = 0; i < tmpl.numBlocks; i++) {
-    // Skip lunch block if lunch disabled
-    if (!lunchEnabled() && tmpl.blocks[i].isLunch) continue;
-
-    uint16_t dur = scaledBlockDurationMin(i);
-    uint16_t blockEnd = cumulative + dur;
-    if (offsetMin < blockEnd) {
-      unsigned long now = millis();
+  // Find the block holding this time offset (a skipped lunch has no length)
+  uint8_t i = timeline_find(dayTimeline(), offsetMin);
+  if (i < tmpl.numBlocks) {
+    unsigned long now = millis();
 
-      // Reconstruct dayStartMs from current offset
-      orch.dayStartMs = now - (unsigned long)offsetMin * 60000UL;
-      orch.lunchBlockIdx = findLunchBlockIdx();
-      // Lunch is completed if synced block is at or past the lunch block
-      orch.lunchCompleted = (orch.lunchBlockIdx != 0xFF && i >= orch.lunchBlockIdx);
+    // Reconstruct dayStartMs from current offset
+    orch.dayStartMs = now - (unsigned long)offsetMin * 60000UL;
+    orch.lunchBlockIdx = findLunchBlockIdx();
+    // Lunch is completed if synced block is at or past the lunch block
+    orch.lunchCompleted = (orch.lunchBlockIdx != 0xFF && i >= orch.lunchBlockIdx);
 
-      startBlock(i, now);
-      startMode(now);
-      Serial.print("[SIM] Time synced to block ");
-      Serial.println(i);
-      return;
-    }
-    cumulative = blockEnd;
+    startBlock(i, now);
+    startMode(now);
+    Serial.print("[SIM] Time synced to block ");
+    Serial.println(i);
+    return;
   }
 
   // Past all blocks — stay on last block
@@ -887,3 +1051,29 @@ void syncOrchestratorTime(uint32_t daySeconds) {
   startBlock(tmpl.numBlocks - 1, now);
   startMode(now);
 }
+
+// ============================================================================
+// Micro-benchmark hooks (bench.h) — draws from RNG_ORCH are not rewound
+// ============================================================================
+
+#if GHOST_BENCH
+
+uint32_t benchSelectWeightedMode(uint32_t ops) {
+  const DayTemplate& tmpl = currentTemplate();
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    acc += selectWeightedMode((uint8_t)(i % tmpl.numBlocks));
+  }
+  return acc;
+}
+
+uint32_t benchPhaseDuration(uint32_t ops) {
+  uint32_t acc = 0;
+  for (uint32_t i = 0; i < ops; i++) {
+    acc += phaseDuration((ActivityPhase)(i % PHASE_COUNT), workModes[i % WMODE_COUNT],
+                         (Profile)(i % PROFILE_COUNT));
+  }
+  return acc;
+}
+
+#endif // GHOST_BENCH
@@ -7,9 +7,18 @@
 // Initialize orchestrator state for current job simulation
 void initOrchestrator();
 
+// Rebuild the weighted mode / profile / phase samplers from DAY_TEMPLATES
+// and workModes[], and the block timeline on next use — initWorkModes()
+// and every sim data write call this
+void rebuildSimSamplers();
+
 // Main tick — call once per loop iteration when in simulation mode
 void tickOrchestrator(unsigned long now);
 
+// Earliest time tickOrchestrator() has work (a timer fires or the current
+// phase acts) — loop() can sleep until then
+unsigned long orchestratorDeadline(unsigned long now);
+
 // Skip to next work mode (encoder press in sim NORMAL)
 void skipWorkMode();
 
@@ -25,6 +34,10 @@ uint8_t blockProgress(unsigned long now);
 // Get mode progress (0-100)
 uint8_t modeProgress(unsigned long now);
 
+// Scale a duration by settings.jobPerformance — scaleUp for active durations
+// (longer at higher levels), !scaleUp for idle gaps (shorter)
+unsigned long scaleByPerformance(unsigned long value, bool scaleUp);
+
 // Sync orchestrator to wall clock time
 void syncOrchestratorTime(uint32_t daySeconds);
 
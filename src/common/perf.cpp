@@ -0,0 +1,91 @@
+#include "perf.h"
+
+#if GHOST_PERF || GHOST_BENCH
+
+void perfCounterInit() {
+#if defined(GHOST_PLATFORM_NRF52)
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t perfCyclesPerUs() {
+#if defined(GHOST_PLATFORM_NRF52)
+  return F_CPU / 1000000UL;
+#elif defined(GHOST_PLATFORM_C6) || defined(GHOST_PLATFORM_S3)
+  return getCpuFrequencyMhz();
+#else
+  return 1;  // host: micros()
+#endif
+}
+
+#endif // GHOST_PERF || GHOST_BENCH
+
+#if GHOST_PERF
+
+// ============================================================================
+// Loop stage profiler — storage, stats, report
+// ============================================================================
+
+const char* const PERF_STAGE_NAMES[PERF_STAGE_COUNT] = {
+  "loop", "encoder", "serial", "bleuart", "input",
+  "battery", "schedule", "hid", "display", "save"
+};
+
+static PerfStats perfTable[PERF_STAGE_COUNT];
+
+void perfReset() {
+  memset(perfTable, 0, sizeof(perfTable));
+  for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+    perfTable[i].minCycles = 0xFFFFFFFFu;
+  }
+}
+
+void perfInit() {
+  perfCounterInit();
+  perfReset();
+}
+
+void perfRecord(PerfStage stage, uint32_t cycles) {
+  PerfStats& s = perfTable[stage];
+  s.count++;
+  s.totalCycles += cycles;
+  if (cycles < s.minCycles) s.minCycles = cycles;
+  if (cycles > s.maxCycles) s.maxCycles = cycles;
+  s.hist[perf_bucket(cycles)]++;
+}
+
+const PerfStats& perfStats(PerfStage stage) {
+  return perfTable[stage];
+}
+
+uint32_t perfPercentile(PerfStage stage, uint8_t pct) {
+  const PerfStats& s = perfTable[stage];
+  uint32_t p = perf_percentile(s.hist, s.count, pct);
+  return (p > s.maxCycles) ? s.maxCycles : p;
+}
+
+static void printUs(uint32_t cycles, uint32_t perUs) {
+  Serial.print((float)cycles / perUs, 1);
+  Serial.print("\t");
+}
+
+void perfPrint() {
+  uint32_t perUs = perfCyclesPerUs();
+  Serial.println("\n=== Loop profile (us) ===");
+  Serial.println("stage\tcount\tmin\tavg\tmax\tp99");
+  for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+    const PerfStats& s = perfTable[i];
+    if (s.count == 0) continue;
+    Serial.print(PERF_STAGE_NAMES[i]); Serial.print("\t");
+    Serial.print(s.count); Serial.print("\t");
+    printUs(s.minCycles, perUs);
+    printUs((uint32_t)(s.totalCycles / s.count), perUs);
+    printUs(s.maxCycles, perUs);
+    printUs(perfPercentile((PerfStage)i, 99), perUs);
+    Serial.println();
+  }
+}
+
+#endif // GHOST_PERF
@@ -0,0 +1,100 @@
+#ifndef GHOST_PERF_H
+#define GHOST_PERF_H
+
+#include "config.h"
+
+// ============================================================================
+// Loop stage profiler
+// Build with -DGHOST_PERF=1 to time each loop() stage in CPU cycles
+// (DWT->CYCCNT on nRF52, the CPU cycle counter on ESP32, micros() on host).
+// With GHOST_PERF=0 (default) every macro below expands to nothing and the
+// firmware image is unchanged.
+// ============================================================================
+
+#if GHOST_PERF || GHOST_BENCH
+
+// Cycle counter — shared with the benchmark build (bench.h)
+#if defined(GHOST_PLATFORM_NRF52)
+  #include <nrf.h>
+  static inline uint32_t perfCycles() { return DWT->CYCCNT; }
+#elif defined(GHOST_PLATFORM_C6) || defined(GHOST_PLATFORM_S3)
+  #include <esp_cpu.h>
+  static inline uint32_t perfCycles() { return (uint32_t)esp_cpu_get_cycle_count(); }
+#else
+  static inline uint32_t perfCycles() { return (uint32_t)micros(); }
+#endif
+
+// Start the cycle counter (DWT needs enabling on nRF52; no-op elsewhere)
+void perfCounterInit();
+
+// Cycle counter rate
+uint32_t perfCyclesPerUs();
+
+#endif // GHOST_PERF || GHOST_BENCH
+
+#if GHOST_PERF
+
+#include "perf_pure.h"
+
+enum PerfStage {
+  PERF_LOOP,       // whole loop() iteration, including the trailing yield
+  PERF_ENCODER,    // pollEncoder()
+  PERF_SERIAL,     // handleSerialCommands()
+  PERF_BLE_UART,   // handleBleUart()
+  PERF_INPUT,      // handleEncoder() + handleButtons()
+  PERF_BATTERY,    // readBattery() + ADC recal (when due)
+  PERF_SCHEDULE,   // checkSchedule()
+  PERF_HID,        // tickOrchestrator() / simple-mode jiggler / game tick
+  PERF_DISPLAY,    // updateDisplay() (+ LVGL timer on ESP32)
+  PERF_SAVE,       // saveSettings() / saveStats() (when due)
+  PERF_STAGE_COUNT
+};
+
+struct PerfStats {
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  uint32_t hist[PERF_HIST_BUCKETS];
+};
+
+extern const char* const PERF_STAGE_NAMES[PERF_STAGE_COUNT];
+
+// Enable the cycle counter and clear all stages (call once in setup())
+void perfInit();
+
+// Clear all stages
+void perfReset();
+
+// Add one sample
+void perfRecord(PerfStage stage, uint32_t cycles);
+
+const PerfStats& perfStats(PerfStage stage);
+
+// p-th percentile in cycles (bucket upper edge, clamped to max)
+uint32_t perfPercentile(PerfStage stage, uint8_t pct);
+
+// Print a µs table of all sampled stages to Serial
+void perfPrint();
+
+// Records the cycles between construction and end of scope
+class PerfScope {
+public:
+  explicit PerfScope(PerfStage stage) : stage_(stage), start_(perfCycles()) {}
+  ~PerfScope() { perfRecord(stage_, perfCycles() - start_); }
+private:
+  PerfStage stage_;
+  uint32_t start_;
+};
+
+#define PERF_INIT()        perfInit()
+#define PERF_SCOPE(stage)  PerfScope perfScope_##stage(stage)
+
+#else
+
+#define PERF_INIT()        ((void)0)
+#define PERF_SCOPE(stage)  ((void)0)
+
+#endif // GHOST_PERF
+
+#endif // GHOST_PERF_H
@@ -0,0 +1,36 @@
+#ifndef GHOST_PERF_PURE_H
+#define GHOST_PERF_PURE_H
+
+#include <stdint.h>
+
+// Log2 histogram: bucket 0 holds 0 cycles, bucket b (1..32) holds
+// [2^(b-1), 2^b). Constant-time insert, 33 counters per stage.
+#define PERF_HIST_BUCKETS 33
+
+inline uint8_t perf_bucket(uint32_t cycles) {
+  return cycles ? (uint8_t)(32 - __builtin_clz(cycles)) : 0;
+}
+
+// Upper edge of a bucket (largest value it can hold)
+inline uint32_t perf_bucket_max(uint8_t b) {
+  if (b == 0) return 0;
+  if (b >= 32) return 0xFFFFFFFFu;
+  return (1u << b) - 1;
+}
+
+// Percentile (1-100) from a histogram — returns the upper edge of the bucket
+// containing the pct-th ranked sample, so it over-reports by at most 2x.
+// Callers clamp to the observed max.
+inline uint32_t perf_percentile(const uint32_t* hist, uint32_t count, uint8_t pct) {
+  if (count == 0) return 0;
+  uint32_t rank = (uint32_t)(((uint64_t)count * pct + 99) / 100);
+  if (rank == 0) rank = 1;
+  uint32_t cum = 0;
+  for (uint8_t b = 0; b < PERF_HIST_BUCKETS; b++) {
+    cum += hist[b];
+    if (cum >= rank) return perf_bucket_max(b);
+  }
+  return 0xFFFFFFFFu;
+}
+
+#endif // GHOST_PERF_PURE_H
@@ -17,10 +17,14 @@
 void sendKeystroke();
 void pickNextKey();
 bool hasPopulatedSlot();
-void sendKeyDown(uint8_t keyIndex, bool silent = false);
-void sendKeyUp();
+void sendKeyDown(uint8_t keyIndex, bool silent = false);  // held until sendKeyUp()
+void sendKeyTap(uint8_t keyIndex, uint16_t holdMs, bool silent = false);  // released by a timer (timers.h) after holdMs
+void sendKeyUp();  // release now (no-op when no key is down)
 void sendMouseMove(int8_t dx, int8_t dy);
-void sendMouseScroll(int8_t scroll);
+void sendMouseScroll(int8_t scroll);  // whole detents, scaled by hidScrollUnits()
+void sendMouseMoveScroll(int8_t dx, int8_t dy, int8_t wheel);  // wheel in hidScrollUnits() units
+uint16_t hidReportIntervalMs();  // min spacing of mouse move reports (BLE conn interval / USB poll)
+uint8_t hidScrollUnits();        // wheel units per detent every active transport accepts (hid_hires.h)
 void sendMouseClick(uint8_t button, uint16_t holdMs);
 void sendWindowSwitch();
 bool hasPopulatedClickSlot();
@@ -29,6 +33,12 @@ void executeClick(uint8_t actionIdx, uint16_t holdMs);
 void sendConsumerPress(uint16_t usageCode);
 void sendConsumerRelease();
 
+// --- Recorded mouse traces (format and slot count: mouse_trace_pure.h) ---
+uint32_t mouseTraceSize(uint8_t slot);   // bytes stored, 0 = empty
+uint16_t mouseTraceRead(uint8_t slot, uint32_t offset, uint8_t* buf, uint16_t len);
+bool mouseTraceWrite(uint8_t slot, uint32_t offset, const uint8_t* data, uint16_t len);  // offset 0 starts over; else must equal size
+void mouseTraceErase(uint8_t slot);
+
 // --- Display ---
 void markDisplayDirty();
 void invalidateDisplayShadow();
@@ -39,7 +49,10 @@ void pushSerialStatus();
 // --- Sleep / power ---
 void enterDeepSleep();
 
-// --- Activity LEDs ---
-void tickActivityLeds();
+// --- HID emitter (hid_emit.h) ---
+void startHidEmitter();  // from setup(), after the HID transports are up
+void hidEmitLock();      // held by loop()'s HID section and by the emitter
+void hidEmitUnlock();
+void hidEmitKick();      // new work planned — emitter re-arms its timer
 
 #endif // GHOST_PLATFORM_HAL_H
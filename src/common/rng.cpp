@@ -0,0 +1,38 @@
+#include "rng.h"
+#include "rng_pure.h"
+
+// ============================================================================
+// PRNG streams
+// ============================================================================
+
+static RngState streams[RNG_STREAM_COUNT] = {
+  // Fixed non-zero defaults so draws before rngSeed() are still valid
+  {{ 0x9E3779B9u, 0x243F6A88u, 0xB7E15162u, 0x6A09E667u }},
+  {{ 0xBB67AE85u, 0x3C6EF372u, 0xA54FF53Au, 0x510E527Fu }},
+  {{ 0x9B05688Cu, 0x1F83D9ABu, 0x5BE0CD19u, 0x428A2F98u }},
+  {{ 0x71374491u, 0xB5C0FBCFu, 0xE9B5DBA5u, 0x3956C25Bu }},
+};
+
+void rngSeed(uint32_t seed) {
+  for (uint8_t i = 0; i < RNG_STREAM_COUNT; i++) {
+    // Distinct, well-separated per-stream seeds derived from the master
+    rngSeedStream((RngStream)i, seed ^ (0x9E3779B9u * (uint32_t)(i + 1)));
+  }
+}
+
+void rngSeedStream(RngStream stream, uint32_t seed) {
+  rng_seed_state(&streams[stream], seed);
+}
+
+uint32_t rngNext(RngStream stream) {
+  return rng_next(&streams[stream]);
+}
+
+uint32_t rngBelow(RngStream stream, uint32_t n) {
+  return rng_below(&streams[stream], n);
+}
+
+int32_t rngRange(RngStream stream, int32_t lo, int32_t hi) {
+  uint32_t span = (hi > lo) ? (uint32_t)hi - (uint32_t)lo : 0;
+  return lo + (int32_t)rng_below(&streams[stream], span);
+}
@@ -0,0 +1,35 @@
+#ifndef GHOST_RNG_H
+#define GHOST_RNG_H
+
+#include <stdint.h>
+
+// ============================================================================
+// Seedable PRNG service
+// Independent streams so one subsystem's draws never shift another's
+// sequence — e.g. a changed key-slot pick does not perturb mouse paths.
+// ============================================================================
+
+enum RngStream {
+  RNG_MOUSE,    // mouse.cpp — sweeps, Brownian directions, scroll
+  RNG_ORCH,     // orchestrator.cpp + timing.cpp — activity scheduling
+  RNG_KEYS,     // key / click slot picking (hid.cpp)
+  RNG_HID,      // report timing jitter (hid.cpp)
+  RNG_STREAM_COUNT
+};
+
+// Seed every stream from one master seed (called from setup())
+void rngSeed(uint32_t seed);
+
+// Reseed a single stream (tests, replay)
+void rngSeedStream(RngStream stream, uint32_t seed);
+
+// Raw 32-bit draw
+uint32_t rngNext(RngStream stream);
+
+// Uniform in [0, n) — drop-in for random(n); n == 0 returns 0
+uint32_t rngBelow(RngStream stream, uint32_t n);
+
+// Uniform in [lo, hi) — drop-in for random(lo, hi); returns lo if hi <= lo
+int32_t rngRange(RngStream stream, int32_t lo, int32_t hi);
+
+#endif // GHOST_RNG_H
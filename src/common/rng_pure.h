@@ -0,0 +1,51 @@
+#ifndef GHOST_RNG_PURE_H
+#define GHOST_RNG_PURE_H
+
+#include <stdint.h>
+
+// xoshiro128** generator state (Blackman & Vigna). 32-bit ops only, so it
+// is cheap on Cortex-M4 and RISC-V alike. Must not be all zero.
+struct RngState {
+  uint32_t s[4];
+};
+
+inline uint32_t rng_rotl(uint32_t x, int k) {
+  return (x << k) | (x >> (32 - k));
+}
+
+// SplitMix32 step — expands one seed word into well-mixed state words
+inline uint32_t rng_splitmix32(uint32_t* x) {
+  uint32_t z = (*x += 0x9E3779B9u);
+  z = (z ^ (z >> 16)) * 0x85EBCA6Bu;
+  z = (z ^ (z >> 13)) * 0xC2B2AE35u;
+  return z ^ (z >> 16);
+}
+
+inline void rng_seed_state(RngState* st, uint32_t seed) {
+  uint32_t x = seed;
+  for (int i = 0; i < 4; i++) st->s[i] = rng_splitmix32(&x);
+  // SplitMix32 is a bijection of a counter; four consecutive outputs are
+  // never all zero, so the xoshiro state is always valid.
+}
+
+inline uint32_t rng_next(RngState* st) {
+  uint32_t* s = st->s;
+  uint32_t result = rng_rotl(s[1] * 5, 7) * 9;
+  uint32_t t = s[1] << 9;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = rng_rotl(s[3], 11);
+  return result;
+}
+
+// Uniform in [0, n) by multiply-shift (Lemire) — no division, no rejection
+// loop. Bias is at most n / 2^32, far below anything observable here.
+// n == 0 returns 0, matching Arduino random(0).
+inline uint32_t rng_below(RngState* st, uint32_t n) {
+  return (uint32_t)(((uint64_t)rng_next(st) * n) >> 32);
+}
+
+#endif // GHOST_RNG_PURE_H
@@ -76,6 +76,12 @@ bool isScheduleActive() {
   }
 }
 
+bool scheduleCheckDeadline(unsigned long& dueMs) {
+  if (!timeSynced) return false;
+  dueMs = lastScheduleCheck + SCHEDULE_CHECK_MS;
+  return true;
+}
+
 void checkSchedule() {
   if (!timeSynced) return;
 
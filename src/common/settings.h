@@ -14,4 +14,11 @@ void setSettingValue(uint8_t settingId, uint32_t value);
 void formatMenuValue(uint8_t settingId, MenuValueFormat format, char* buf, size_t bufSize);
 int getDieTempCelsius();
 
+// Deferred saves on loop()'s timer wheel (timers.h) — keep flash wear down.
+// markSettingsDirty() (re)starts the SETTINGS_SAVE_DEBOUNCE_MS debounce;
+// dirty stats are saved every STATS_SAVE_INTERVAL_MS. startSaveTimers()
+// from setup(), after loopTimersInit().
+void markSettingsDirty();
+void startSaveTimers(unsigned long now);
+
 #endif // GHOST_SETTINGS_H
@@ -5,6 +5,8 @@
 #include "timing.h"
 #include "sim_data.h"
 #include "platform_hal.h"
+#include "timers.h"
+#include "perf.h"
 
 void loadDefaults() {
   memset(&settings, 0, sizeof(Settings));  // zero padding bytes for checksum consistency
@@ -311,3 +313,38 @@ void formatMenuValue(uint8_t settingId, MenuValueFormat format, char* buf, size_
     default:                snprintf(buf, bufSize, "%lu", (unsigned long)val); return;
   }
 }
+
+// ============================================================================
+// DEFERRED SAVES — loop()'s timer wheel (timers.h) calls these when due
+// ============================================================================
+
+static void settingsSaveFired(WheelTimer& t, uint32_t now);
+static void statsSaveFired(WheelTimer& t, uint32_t now);
+static WheelTimer settingsSaveTimer = TW_TIMER(settingsSaveFired);
+static WheelTimer statsSaveTimer = TW_TIMER(statsSaveFired);
+
+// A deep sleep saves and clears settingsDirty, so a stale debounce is a no-op
+static void settingsSaveFired(WheelTimer& t, uint32_t now) {
+  if (!settingsDirty) return;
+  PERF_SCOPE(PERF_SAVE);
+  saveSettings();
+  settingsDirty = false;
+}
+
+static void statsSaveFired(WheelTimer& t, uint32_t now) {
+  if (statsDirty) {
+    PERF_SCOPE(PERF_SAVE);
+    saveStats();
+    statsDirty = false;
+  }
+  loopTimerArm(t, now + STATS_SAVE_INTERVAL_MS);
+}
+
+void markSettingsDirty() {
+  settingsDirty = true;
+  loopTimerArm(settingsSaveTimer, millis() + SETTINGS_SAVE_DEBOUNCE_MS);
+}
+
+void startSaveTimers(unsigned long now) {
+  loopTimerArm(statsSaveTimer, now + STATS_SAVE_INTERVAL_MS);
+}
@@ -119,10 +119,6 @@ extern int batteryPercent;
 extern float batteryVoltage;
 extern bool batteryCharging;
 
-// LED timing
-extern unsigned long ledKbOnMs;
-extern unsigned long ledMouseOnMs;
-
 // Serial status push (toggle with 't' command)
 extern bool serialStatusPush;
 
@@ -224,9 +220,6 @@ struct OrchestratorState {
   int8_t kbmsSwipeDx;
   int8_t kbmsSwipeDy;
 
-  // K+M mouse step timer (replaces static local — reset on phase entry)
-  unsigned long kbmsLastStepMs;
-
   // M+K (drawing tool) sub-phase state
   MskbSubPhase mskbSubPhase;
   uint8_t mskbStrokesRemaining;
@@ -236,8 +229,8 @@ struct OrchestratorState {
   int8_t mskbStrokeDx;
   int8_t mskbStrokeDy;
 
-  // M+K mouse step timer (replaces static local — reset on phase entry)
-  unsigned long mskbLastStepMs;
+  // K+M swipe / M+K stroke step timer (motionTick) — reset on phase entry
+  unsigned long swipeLastStepMs;
 
   // Schedule preview overlay
   bool previewActive;
@@ -251,12 +244,11 @@ struct OrchestratorState {
 
 extern OrchestratorState orch;
 
-// Deferred settings save (avoids flash wear on rapid game-over)
+// Deferred settings save (avoids flash wear on rapid game-over) — set by
+// markSettingsDirty() (settings.h)
 extern bool settingsDirty;
-extern unsigned long settingsDirtyMs;
 
 // Lifetime stats periodic save
 extern bool statsDirty;
-extern unsigned long lastStatsSave;
 
 #endif // GHOST_COMMON_STATE_H
@@ -0,0 +1,227 @@
+#ifndef GHOST_TIMER_WHEEL_PURE_H
+#define GHOST_TIMER_WHEEL_PURE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// ============================================================================
+// Hierarchical timer wheel — O(1) arm / cancel, cost per run proportional to
+// the timers that expire (plus at most one cascade per level per 64 ticks of
+// that level), not to how many are armed.
+//
+// Four levels of 64 slots at 1 ms resolution cover 2^24 ms (4.6 h) ahead; a
+// timer further out waits on an overflow list that is re-sorted every 2^24
+// ms. A timer sits at the level of the highest 6-bit digit in which its due
+// time differs from the wheel's time, so each level's occupied slots all lie
+// ahead of its cursor and the next event is one bit scan per level.
+// Times are millis() values; due times up to 2^31 ms ahead are handled
+// across the 49.7-day wrap.
+//
+// Timers are intrusive (no allocation) and fire through a plain callback,
+// which gets the wheel's time as it fires: the due time, or the previous
+// run's time for a timer armed after its due time had passed. A callback
+// may re-arm or cancel any timer; one armed for a time already reached
+// fires on the next tw_run().
+// Pure header — no Arduino dependencies (unit-tested on host).
+// ============================================================================
+
+#define TW_LEVELS      4
+#define TW_SLOT_BITS   6
+#define TW_SLOTS       (1 << TW_SLOT_BITS)
+#define TW_SPAN_BITS   (TW_LEVELS * TW_SLOT_BITS)   // 24: range of the wheel proper
+
+#define TW_LIST_OVERFLOW  (TW_LEVELS * TW_SLOTS)
+#define TW_LIST_READY     (TW_LIST_OVERFLOW + 1)
+#define TW_LIST_FIRING    (TW_LIST_READY + 1)   // ready timers being fired this pass
+#define TW_LIST_COUNT     (TW_LIST_FIRING + 1)
+#define TW_LIST_NONE      0xFFFF
+
+struct WheelTimer;
+typedef void (*WheelTimerFn)(WheelTimer& t, uint32_t now);
+
+struct WheelTimer {
+  WheelTimer* next;
+  WheelTimer* prev;
+  uint32_t dueMs;
+  WheelTimerFn fire;
+  uint16_t list;          // TW_LIST_NONE when not armed
+};
+
+struct TimerWheel {
+  uint32_t nowMs;                  // every timer due at or before this has been handed out
+  uint64_t occupied[TW_LEVELS];    // non-empty slots, one bit per slot
+  WheelTimer* head[TW_LIST_COUNT];
+  uint32_t nextMs;                 // cached tw_next_event() result ...
+  bool nextAny;
+  bool nextValid;                  // ... until the wheel's lists change
+};
+
+// Static initializer for a disarmed timer:
+//   static WheelTimer releaseTimer = TW_TIMER(releaseFired);
+#define TW_TIMER(fn)  { NULL, NULL, 0, (fn), TW_LIST_NONE }
+
+// A timer is set up once with its callback; it starts disarmed
+inline void tw_timer_init(WheelTimer& t, WheelTimerFn fire) {
+  t.next = t.prev = NULL;
+  t.dueMs = 0;
+  t.fire = fire;
+  t.list = TW_LIST_NONE;
+}
+
+inline bool tw_armed(const WheelTimer& t) {
+  return t.list != TW_LIST_NONE;
+}
+
+inline void tw_init(TimerWheel& w, uint32_t now) {
+  w.nowMs = now;
+  for (uint8_t l = 0; l < TW_LEVELS; l++) w.occupied[l] = 0;
+  for (uint16_t i = 0; i < TW_LIST_COUNT; i++) w.head[i] = NULL;
+  w.nextValid = false;
+}
+
+inline void tw_link(TimerWheel& w, WheelTimer& t, uint16_t list) {
+  t.list = list;
+  t.prev = NULL;
+  t.next = w.head[list];
+  if (t.next) t.next->prev = &t;
+  w.head[list] = &t;
+  if (list < TW_LIST_OVERFLOW)
+    w.occupied[list / TW_SLOTS] |= 1ULL << (list % TW_SLOTS);
+  if (list <= TW_LIST_OVERFLOW) w.nextValid = false;
+}
+
+inline void tw_unlink(TimerWheel& w, WheelTimer& t) {
+  if (t.prev) t.prev->next = t.next;
+  else w.head[t.list] = t.next;
+  if (t.next) t.next->prev = t.prev;
+  if (t.list < TW_LIST_OVERFLOW && !w.head[t.list])
+    w.occupied[t.list / TW_SLOTS] &= ~(1ULL << (t.list % TW_SLOTS));
+  if (t.list <= TW_LIST_OVERFLOW) w.nextValid = false;
+  t.next = t.prev = NULL;
+  t.list = TW_LIST_NONE;
+}
+
+// File t by its due time against the wheel's time
+inline void tw_place(TimerWheel& w, WheelTimer& t) {
+  uint32_t now = w.nowMs;
+  if ((int32_t)(t.dueMs - now) <= 0) { tw_link(w, t, TW_LIST_READY); return; }
+  uint32_t diff = t.dueMs ^ now;
+  uint8_t level = (uint8_t)((31 - __builtin_clz(diff)) / TW_SLOT_BITS);
+  if (level >= TW_LEVELS) { tw_link(w, t, TW_LIST_OVERFLOW); return; }
+  uint16_t slot = (uint16_t)((t.dueMs >> (level * TW_SLOT_BITS)) & (TW_SLOTS - 1));
+  tw_link(w, t, (uint16_t)(level * TW_SLOTS + slot));
+}
+
+// (Re)arm t for dueMs — O(1)
+inline void tw_arm(TimerWheel& w, WheelTimer& t, uint32_t dueMs) {
+  if (tw_armed(t)) tw_unlink(w, t);
+  t.dueMs = dueMs;
+  tw_place(w, t);
+}
+
+// O(1); harmless when t is not armed
+inline void tw_cancel(TimerWheel& w, WheelTimer& t) {
+  if (tw_armed(t)) tw_unlink(w, t);
+}
+
+// Earliest time after nowMs at which the wheel has work: a slot's timers
+// fire, a higher slot cascades down, or the overflow list is re-sorted.
+// Cascades make this a lower bound on the next firing, never later than it.
+// False when nothing is armed past nowMs. Four bit scans; the result holds
+// until a timer is filed or removed, as nowMs only moves up to it.
+inline bool tw_next_event(TimerWheel& w, uint32_t& eventMs) {
+  if (w.nextValid) {
+    if (w.nextAny) eventMs = w.nextMs;
+    return w.nextAny;
+  }
+  bool any = false;
+  uint32_t best = 0;
+  for (uint8_t l = 0; l < TW_LEVELS; l++) {
+    uint8_t shift = (uint8_t)(l * TW_SLOT_BITS);
+    uint32_t cursor = (w.nowMs >> shift) & (TW_SLOTS - 1);
+    uint64_t ahead = (cursor == TW_SLOTS - 1) ? 0 : (w.occupied[l] & (~0ULL << (cursor + 1)));
+    if (!ahead) continue;
+    uint32_t slot = (uint32_t)__builtin_ctzll(ahead);
+    uint32_t blockMask = (shift + TW_SLOT_BITS >= 32) ? 0xFFFFFFFFu
+                         : ((1u << (shift + TW_SLOT_BITS)) - 1);
+    uint32_t t = (w.nowMs & ~blockMask) | (slot << shift);
+    if (!any || t - w.nowMs < best - w.nowMs) best = t;
+    any = true;
+  }
+  if (w.head[TW_LIST_OVERFLOW]) {
+    uint32_t t = ((w.nowMs >> TW_SPAN_BITS) + 1) << TW_SPAN_BITS;
+    if (!any || t - w.nowMs < best - w.nowMs) best = t;
+    any = true;
+  }
+  w.nextMs = best;
+  w.nextAny = any;
+  w.nextValid = true;
+  if (any) eventMs = best;
+  return any;
+}
+
+// Earliest time the owner should call tw_run() again (false = nothing armed).
+// Already-due timers report nowMs.
+inline bool tw_deadline(TimerWheel& w, uint32_t& dueMs) {
+  if (w.head[TW_LIST_READY]) { dueMs = w.nowMs; return true; }
+  return tw_next_event(w, dueMs);
+}
+
+// Move the wheel's time to t (an event time from tw_next_event): re-sort
+// overflow at a 2^24 boundary, cascade each level whose slot starts at t
+// (highest first), and hand the level-0 slot to the ready list
+inline void tw_advance_to(TimerWheel& w, uint32_t t) {
+  w.nowMs = t;
+  w.nextValid = false;
+  if ((t & ((1u << TW_SPAN_BITS) - 1)) == 0) {
+    WheelTimer* n = w.head[TW_LIST_OVERFLOW];
+    w.head[TW_LIST_OVERFLOW] = NULL;
+    while (n) {
+      WheelTimer* next = n->next;
+      n->list = TW_LIST_NONE;
+      tw_place(w, *n);
+      n = next;
+    }
+  }
+  for (int8_t l = TW_LEVELS - 1; l >= 0; l--) {
+    uint8_t shift = (uint8_t)(l * TW_SLOT_BITS);
+    if (l > 0 && (t & ((1u << shift) - 1)) != 0) continue;
+    uint16_t list = (uint16_t)(l * TW_SLOTS + ((t >> shift) & (TW_SLOTS - 1)));
+    WheelTimer* n = w.head[list];
+    if (!n) continue;
+    w.head[list] = NULL;
+    w.occupied[l] &= ~(1ULL << (list % TW_SLOTS));
+    while (n) {
+      WheelTimer* next = n->next;
+      n->list = TW_LIST_NONE;
+      tw_place(w, *n);   // lands lower, or on the ready list when due at t
+      n = next;
+    }
+  }
+}
+
+// Fire the timers on the ready list as it stands; ones a callback makes
+// ready wait for the next call. Each is unlinked before its callback runs,
+// so callbacks can re-arm or cancel any timer, including ones still queued.
+inline void tw_fire_ready(TimerWheel& w) {
+  w.head[TW_LIST_FIRING] = w.head[TW_LIST_READY];
+  w.head[TW_LIST_READY] = NULL;
+  for (WheelTimer* n = w.head[TW_LIST_FIRING]; n; n = n->next) n->list = TW_LIST_FIRING;
+  while (WheelTimer* n = w.head[TW_LIST_FIRING]) {
+    tw_unlink(w, *n);
+    n->fire(*n, w.nowMs);
+  }
+}
+
+// Fire everything due at or before now, in due order (ties in any order)
+inline void tw_run(TimerWheel& w, uint32_t now) {
+  tw_fire_ready(w);
+  uint32_t t;
+  while (tw_next_event(w, t) && (int32_t)(now - t) >= 0) {
+    tw_advance_to(w, t);
+    tw_fire_ready(w);
+  }
+  if ((int32_t)(now - w.nowMs) > 0) w.nowMs = now;
+}
+
+#endif // GHOST_TIMER_WHEEL_PURE_H
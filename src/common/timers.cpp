@@ -0,0 +1,50 @@
+#include "timers.h"
+
+// ============================================================================
+// Timer service — see timers.h
+// ============================================================================
+
+static TimerWheel wheel;
+static TimerWheel loopWheel;
+
+void timersInit(unsigned long now) {
+  tw_init(wheel, (uint32_t)now);
+}
+
+void timerArm(WheelTimer& t, unsigned long dueMs) {
+  tw_arm(wheel, t, (uint32_t)dueMs);
+}
+
+void timerCancel(WheelTimer& t) {
+  tw_cancel(wheel, t);
+}
+
+void timersRun(unsigned long now) {
+  tw_run(wheel, (uint32_t)now);
+}
+
+bool timersDeadline(unsigned long& dueMs) {
+  uint32_t due;
+  if (!tw_deadline(wheel, due)) return false;
+  dueMs = due;
+  return true;
+}
+
+void loopTimersInit(unsigned long now) {
+  tw_init(loopWheel, (uint32_t)now);
+}
+
+void loopTimerArm(WheelTimer& t, unsigned long dueMs) {
+  tw_arm(loopWheel, t, (uint32_t)dueMs);
+}
+
+void loopTimersRun(unsigned long now) {
+  tw_run(loopWheel, (uint32_t)now);
+}
+
+bool loopTimersDeadline(unsigned long& dueMs) {
+  uint32_t due;
+  if (!tw_deadline(loopWheel, due)) return false;
+  dueMs = due;
+  return true;
+}
@@ -0,0 +1,39 @@
+#ifndef GHOST_TIMERS_H
+#define GHOST_TIMERS_H
+
+#include "config.h"
+#include "timer_wheel_pure.h"
+
+// ============================================================================
+// Timer service — one hierarchical timer wheel (timer_wheel_pure.h) for the
+// HID side's one-shot timers: key / click releases, window-switch steps and
+// activity LED flashes. Subsystems own their WheelTimer (declare it with
+// TW_TIMER(callback)) and arm it; the HID emitter runs the wheel in
+// hidEmitService() and sleeps until timersDeadline(), so a pass costs only
+// the timers that expire. Callbacks run in the emitter; arm and cancel only
+// while holding hidEmitLock() (or from a callback).
+//
+// Not on a wheel: the orchestrator's phase / burst / keepalive / profile
+// timers (OrchestratorState), the mouse state machine's timers and
+// lastScrollTime. They stay ordered checks in tickOrchestrator() and
+// handleMouseStateMachine(), because the order in which they fire sets the
+// order of the seeded RNG draws (and so the golden traces); loop() sleeps
+// until orchestratorDeadline() / mouseStateDeadline() rather than polling.
+// ============================================================================
+
+void timersInit(unsigned long now);   // empties the wheel (armed timers are dropped)
+void timerArm(WheelTimer& t, unsigned long dueMs);
+void timerCancel(WheelTimer& t);
+void timersRun(unsigned long now);
+bool timersDeadline(unsigned long& dueMs);  // false when nothing is armed
+
+// loop()'s own wheel, for timers whose work has to run in loop() context
+// (flash writes): the settings and stats saves (settings.h). loop() runs it
+// each pass and sleeps no later than loopTimersDeadline(); arm only from
+// loop() or a callback.
+void loopTimersInit(unsigned long now);
+void loopTimerArm(WheelTimer& t, unsigned long dueMs);
+void loopTimersRun(unsigned long now);
+bool loopTimersDeadline(unsigned long& dueMs);
+
+#endif // GHOST_TIMERS_H
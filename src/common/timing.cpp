@@ -1,10 +1,11 @@
 #include "timing.h"
 #include "state.h"
 #include "keys.h"
+#include "rng.h"
 
 unsigned long applyRandomness(unsigned long baseValue) {
   long variation = (long)(baseValue * RANDOMNESS_PERCENT / 100);
-  long result = (long)baseValue + random(-variation, variation + 1);
+  long result = (long)baseValue + rngRange(RNG_ORCH, -variation, variation + 1);
   if (result < (long)MIN_CLAMP_MS) result = MIN_CLAMP_MS;
   return (unsigned long)result;
 }
@@ -48,7 +49,7 @@ void scheduleNextKey() {
   unsigned long eMin = effectiveKeyMin();
   unsigned long eMax = effectiveKeyMax();
   if (eMax > eMin) {
-    currentKeyInterval = eMin + random(eMax - eMin + 1);
+    currentKeyInterval = eMin + rngBelow(RNG_ORCH, eMax - eMin + 1);
   } else {
     currentKeyInterval = eMin;
   }
@@ -0,0 +1,50 @@
+#ifndef GHOST_EMU_BLUEFRUIT_H
+#define GHOST_EMU_BLUEFRUIT_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// Bluefruit / SoftDevice stand-in for the host emulator (env:emu)
+// env:emu links the nRF52 protocol layer (src/nrf52/protocol.cpp and
+// ble_uart.cpp) unchanged; this is the transport it sees. There is no BLE
+// link: the NUS never has data and no connection is ever secured, so
+// commands only arrive over the pty (serial_cmd.cpp). Reboot and DFU
+// resets restart the emulated device (emuReboot(), emu.h).
+// ============================================================================
+
+#define BLE_CONN_HANDLE_INVALID 0xFFFF
+
+class BLEConnection {
+public:
+  bool secured() const { return false; }
+};
+
+class BLEUart {
+public:
+  void begin() {}
+  void setRxCallback(void (*cb)(uint16_t)) { (void)cb; }
+  int available() { return 0; }
+  int read() { return -1; }
+  size_t write(const uint8_t* buf, size_t len) { (void)buf; return len; }
+};
+
+class BLEDis {};
+class BLEHidAdafruit {};
+
+class EmuBluefruit {
+public:
+  BLEConnection* Connection(uint16_t handle) { (void)handle; return nullptr; }
+};
+extern EmuBluefruit Bluefruit;
+
+// CMSIS / SoftDevice calls made by the reboot and DFU handlers
+void emuReboot();
+inline void NVIC_SystemReset() { emuReboot(); }
+inline uint32_t sd_power_gpregret_clr(uint32_t reg, uint32_t mask) { (void)reg; (void)mask; return 0; }
+inline uint32_t sd_power_gpregret_set(uint32_t reg, uint32_t mask) { (void)reg; (void)mask; return 0; }
+
+// Status reports the --platform the emulator was started with
+extern const char* emuPlatform;
+#define GHOST_PLATFORM_NAME emuPlatform
+
+#endif // GHOST_EMU_BLUEFRUIT_H
@@ -0,0 +1,26 @@
+#ifndef GHOST_EMU_H
+#define GHOST_EMU_H
+
+#include "config.h"
+
+// ============================================================================
+// Host firmware emulator (env:emu)
+// src/common/ + the src/native/ host platform + the nRF52 protocol layer
+// (src/nrf52/ble_uart.cpp, protocol.cpp, over the stand-in in bluefruit.h),
+// serving the text and JSON config protocol on a Linux pty.
+// ============================================================================
+
+// "platform" reported in ?status / JSON status (--platform, default nrf52)
+extern const char* emuPlatform;
+
+// Push status as JSON once statusPush was set via JSON (as on nRF52)
+extern bool jsonPushMode;
+
+// Request a soft restart. Settings, stats and work modes live in RAM and
+// survive it (the host has no flash); runtime state is reset as at boot.
+void emuReboot();
+
+// Read protocol lines from Serial (the pty) and dispatch them
+void handleSerialCommands();
+
+#endif // GHOST_EMU_H
@@ -0,0 +1,231 @@
+#ifndef PIO_UNIT_TESTING
+
+#include <Arduino.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "../nrf52/state.h"
+#include "orchestrator.h"
+#include "timing.h"
+#include "host_hal.h"
+#include "emu.h"
+
+// ============================================================================
+// Host firmware emulator (env:emu)
+// Opens a pseudo-terminal and serves the ?/=/!/{ config protocol on it, so
+// the dashboard (Web Serial via a pty bridge, or serial.js under Node) and
+// load tests can run with no hardware. The orchestrator runs on the host
+// virtual clock, paced against wall time:
+//
+//   --warp 1     real time (default) — status pushes at the firmware cadence
+//   --warp 60    one simulated minute per second
+//   --warp 0     free-running, as fast as the host allows
+//
+//   .pio/build/emu/program [--warp N] [--seed N] [--job N] [--simple]
+//                          [--platform nrf52|c6|s3] [--link PATH] [--log]
+//
+// Linux only (posix_openpt + fopencookie).
+// ============================================================================
+
+const char* emuPlatform = "nrf52";
+
+// nRF52 globals the linked protocol layer (src/nrf52/protocol.cpp,
+// ble_uart.cpp) reads — src/nrf52/state.cpp on target. No display, no BLE
+// link; games never run on the host, so their status stays at reset.
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+bool displayInitialized = false;
+GameState gameState;
+EmuBluefruit Bluefruit;
+BLEUart bleuart;
+volatile uint16_t bleConnHandle = BLE_CONN_HANDLE_INVALID;
+volatile bool bleUartResetPending = false;
+
+static volatile sig_atomic_t stopRequested = 0;
+static bool rebootPending = false;
+static unsigned long bootSeed = 1;
+static int ptyFd = -1;
+
+// Max virtual ms simulated per pass, so a slow host degrades to running
+// behind wall time instead of starving the pty
+#define EMU_MAX_STEPS_PER_PASS 20000
+
+static void onSignal(int) { stopRequested = 1; }
+
+void emuReboot() {
+  rebootPending = true;
+}
+
+// Serial output sink — non-blocking, drops what the pty can't take (like
+// USB CDC with no host reading) so an idle pty never stalls the emulator
+static ssize_t ptyWrite(void*, const char* buf, size_t len) {
+  size_t off = 0;
+  while (off < len) {
+    ssize_t n = write(ptyFd, buf + off, len - off);
+    if (n > 0) { off += (size_t)n; continue; }
+    if (n < 0 && errno == EINTR) continue;
+    break;
+  }
+  return (ssize_t)len;
+}
+
+static uint64_t wallMs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000ULL + (uint64_t)ts.tv_nsec / 1000000ULL;
+}
+
+static int openPty(char* slaveName, size_t nameSize, int* slaveFd) {
+  int fd = posix_openpt(O_RDWR | O_NOCTTY);
+  if (fd < 0) return -1;
+  if (grantpt(fd) < 0 || unlockpt(fd) < 0 || ptsname_r(fd, slaveName, nameSize) != 0) {
+    close(fd);
+    return -1;
+  }
+
+  // Hold the slave open: the master would otherwise read EIO between client
+  // sessions. Raw mode so clients see exact bytes (no echo, no CR mapping).
+  *slaveFd = open(slaveName, O_RDWR | O_NOCTTY);
+  if (*slaveFd >= 0) {
+    struct termios tio;
+    if (tcgetattr(*slaveFd, &tio) == 0) {
+      cfmakeraw(&tio);
+      tcsetattr(*slaveFd, TCSANOW, &tio);
+    }
+  }
+
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return fd;
+}
+
+static void bootDevice(long job, bool simple) {
+  hostSetup(bootSeed);
+  if (simple) settings.operationMode = OP_SIMPLE;
+  if (job >= 0 && job < JOB_SIM_COUNT) settings.jobSimulation = (uint8_t)job;
+  if (settings.operationMode == OP_SIMULATION) initOrchestrator();
+}
+
+// Soft restart: keep the "flash" contents, reset everything else
+static void rebootDevice() {
+  Settings savedSettings = settings;
+  Stats savedStats = stats;
+  WorkModeDef savedModes[WMODE_COUNT];
+  memcpy(savedModes, workModes, sizeof(workModes));
+
+  hostSetup(bootSeed);
+  settings = savedSettings;
+  stats = savedStats;
+  memcpy(workModes, savedModes, sizeof(workModes));
+  rebuildSimSamplers();
+  serialStatusPush = false;
+  jsonPushMode = false;
+  scheduleNextKey();
+  scheduleNextMouseState();
+  if (settings.operationMode == OP_SIMULATION) initOrchestrator();
+  Serial.println("[EMU] Rebooted");
+}
+
+static void usage() {
+  printf("Usage: program [--warp N] [--seed N] [--job 0-%d] [--simple]\n"
+         "               [--platform nrf52|c6|s3] [--link PATH] [--log]\n",
+         JOB_SIM_COUNT - 1);
+}
+
+int main(int argc, char** argv) {
+  double warp = 1.0;
+  long job = -1;
+  bool simple = false;
+  bool log = false;
+  const char* linkPath = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+    if      (!strcmp(a, "--warp") && v)     { warp = strtod(v, NULL); i++; }
+    else if (!strcmp(a, "--seed") && v)     { bootSeed = strtoul(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--job") && v)      { job = strtol(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--platform") && v) { emuPlatform = v; i++; }
+    else if (!strcmp(a, "--link") && v)     { linkPath = v; i++; }
+    else if (!strcmp(a, "--simple")) simple = true;
+    else if (!strcmp(a, "--log"))    log = true;
+    else { usage(); return 2; }
+  }
+  if (warp < 0) warp = 0;
+
+  char slaveName[128];
+  int slaveFd = -1;
+  ptyFd = openPty(slaveName, sizeof(slaveName), &slaveFd);
+  if (ptyFd < 0) {
+    perror("posix_openpt");
+    return 1;
+  }
+  if (linkPath) {
+    unlink(linkPath);
+    if (symlink(slaveName, linkPath) != 0) perror("symlink");
+  }
+
+  cookie_io_functions_t io = { NULL, ptyWrite, NULL, NULL };
+  FILE* ptyOut = fopencookie(NULL, "w", io);
+  setvbuf(ptyOut, NULL, _IOLBF, 0);
+  Serial.attachOutput(ptyOut);
+
+  signal(SIGINT, onSignal);
+  signal(SIGTERM, onSignal);
+
+  bootDevice(job, simple);
+  printf("Ghost Operator emulator (%s) on %s%s%s, warp %gx, seed %lu\n",
+         emuPlatform, slaveName, linkPath ? " -> " : "", linkPath ? linkPath : "",
+         warp, bootSeed);
+  fflush(stdout);
+
+  uint64_t wallStart = wallMs();
+  unsigned long virtStart = hostClockMs();
+  unsigned long lastLogMin = 0;
+
+  while (!stopRequested) {
+    struct pollfd pfd = { ptyFd, POLLIN, 0 };
+    if (poll(&pfd, 1, warp > 0 ? 1 : 0) > 0 && (pfd.revents & POLLIN)) {
+      char buf[256];
+      ssize_t n = read(ptyFd, buf, sizeof(buf));
+      if (n > 0) Serial.injectInput(buf, (size_t)n);
+    }
+    handleSerialCommands();
+
+    if (rebootPending) {
+      rebootPending = false;
+      rebootDevice();
+    }
+
+    // Catch the virtual clock up to wall time x warp, 1 ms per loop()
+    unsigned long target = hostClockMs() + EMU_MAX_STEPS_PER_PASS;
+    if (warp > 0) {
+      unsigned long paced = virtStart + (unsigned long)((double)(wallMs() - wallStart) * warp);
+      if ((long)(paced - target) < 0) target = paced;
+    }
+    for (uint32_t steps = 0; (long)(hostClockMs() - target) < 0 && steps < EMU_MAX_STEPS_PER_PASS; steps++) {
+      hostClockAdvance(1);
+      hostLoop();
+    }
+
+    if (log) {
+      unsigned long min = (hostClockMs() - virtStart) / 60000UL;
+      if (min != lastLogMin) {
+        lastLogMin = min;
+        printf("[EMU] t=%lu min  keys=%lu  mousePx=%lu\n", min,
+               (unsigned long)stats.totalKeystrokes, (unsigned long)stats.totalMousePixels);
+        fflush(stdout);
+      }
+    }
+  }
+
+  fclose(ptyOut);
+  if (slaveFd >= 0) close(slaveFd);
+  close(ptyFd);
+  if (linkPath) unlink(linkPath);
+  return 0;
+}
+
+#endif // PIO_UNIT_TESTING
@@ -0,0 +1,68 @@
+#include <Arduino.h>
+#include "../nrf52/ble_uart.h"
+#include "../nrf52/protocol.h"
+#include "state.h"
+#include "platform_hal.h"
+#include "emu.h"
+
+// ============================================================================
+// Serial (pty) line handling for the host emulator
+// Replaces src/native/serial_cmd.cpp in env:emu. Only protocol lines
+// (?/=/!/{) are accepted; the firmware's single-char debug menu is not
+// emulated.
+// ============================================================================
+
+// Line buffer for protocol commands arriving over the pty
+#define SERIAL_BUF_SIZE 512
+static char serialBuf[SERIAL_BUF_SIZE];
+static uint16_t serialBufPos = 0;
+static bool serialBufOverflow = false;
+
+bool jsonPushMode = false;
+
+// Serial response writer — plain println, same as USB CDC on hardware
+static void serialWrite(const char* msg) {
+  Serial.println(msg);
+}
+
+void pushSerialStatus() {
+  if (!serialStatusPush) return;
+  static unsigned long lastPush = 0;
+  unsigned long now = millis();
+  if (now - lastPush < 200) return;  // 200ms throttle — max 5 updates/sec
+  lastPush = now;
+  if (jsonPushMode) {
+    pushJsonStatus(serialWrite);
+  } else {
+    processCommand("?status", serialWrite);
+  }
+}
+
+void handleSerialCommands() {
+  while (Serial.available()) {
+    char c = (char)Serial.read();
+
+    if (c == '\n' || c == '\r') {
+      if (serialBufPos > 0) {
+        if (serialBufOverflow) {
+          serialWrite("-err:cmd too long");
+        } else {
+          serialBuf[serialBufPos] = '\0';
+          processCommand(serialBuf, serialWrite);
+        }
+        serialBufPos = 0;
+        serialBufOverflow = false;
+      }
+      continue;
+    }
+
+    // Drop anything that doesn't start a protocol line
+    if (serialBufPos == 0 && c != '?' && c != '=' && c != '!' && c != '{') continue;
+
+    if (serialBufPos < SERIAL_BUF_SIZE - 1) {
+      serialBuf[serialBufPos++] = c;
+    } else {
+      serialBufOverflow = true;
+    }
+  }
+}
@@ -7,6 +7,8 @@
 #include "keys.h"
 #include "timing.h"
 #include "platform_hal.h"
+#include "hid_hires.h"
+#include "sleep.h"
 
 // ============================================================================
 // NimBLE HID setup for ESP32-C6
@@ -71,12 +73,12 @@ static const uint8_t hidReportDescriptor[] = {
   0x05, 0x01,        //     Usage Page (Generic Desktop)
   0x09, 0x30,        //     Usage (X)
   0x09, 0x31,        //     Usage (Y)
-  0x09, 0x38,        //     Usage (Wheel)
   0x15, 0x81,        //     Logical Minimum (-127)
   0x25, 0x7F,        //     Logical Maximum (127)
   0x75, 0x08,        //     Report Size (8)
-  0x95, 0x03,        //     Report Count (3)
+  0x95, 0x02,        //     Report Count (2)
   0x81, 0x06,        //     Input (Data, Variable, Relative)
+  GHOST_HID_DESC_HIRES_WHEEL,  // Wheel + Resolution Multiplier feature
   0xC0,              //   End Collection
   0xC0,              // End Collection
 
@@ -105,6 +107,7 @@ class ServerCallbacks : public NimBLEServerCallbacks {
     Serial.print("[BLE] Connected to: ");
     Serial.println(connInfo.getAddress().toString().c_str());
     deviceConnected = true;
+    bleConnIntervalMs = BLE_INTERVAL_MS(connInfo.getConnInterval());
 
     // Reset timers so progress bars start fresh
     unsigned long now = millis();
@@ -117,6 +120,7 @@ class ServerCallbacks : public NimBLEServerCallbacks {
     scheduleNextMouseState();
     lastModeActivity = now;  // wake screensaver on BLE connect
     markDisplayDirty();
+    wakeLoop();
   }
 
   void onDisconnect(NimBLEServer* pSvr, NimBLEConnInfo& connInfo, int reason) override {
@@ -125,12 +129,18 @@ class ServerCallbacks : public NimBLEServerCallbacks {
     Serial.print("[BLE] Disconnected, reason: 0x");
     Serial.println(reason, HEX);
     deviceConnected = false;
+    bleScrollUnits = 1;  // next host has to opt in again
     easterEggActive = false;
     resetBleUartBuffer();
     markDisplayDirty();
 
     // Auto-reconnect
     startAdvertising();
+    wakeLoop();
+  }
+
+  void onConnParamsUpdate(NimBLEConnInfo& connInfo) override {
+    bleConnIntervalMs = BLE_INTERVAL_MS(connInfo.getConnInterval());
   }
 
   void onAuthenticationComplete(NimBLEConnInfo& connInfo) override {
@@ -144,6 +154,20 @@ class ServerCallbacks : public NimBLEServerCallbacks {
 
 static ServerCallbacks serverCallbacks;
 
+// ============================================================================
+// Mouse feature report — host writes the wheel Resolution Multiplier
+// ============================================================================
+
+class MouseFeatureCallbacks : public NimBLECharacteristicCallbacks {
+  void onWrite(NimBLECharacteristic* pChar, NimBLEConnInfo& connInfo) override {
+    (void)connInfo;
+    std::string val = pChar->getValue();
+    bleScrollUnits = val.empty() ? 1 : hid_hires_units((uint8_t)val[0]);
+  }
+};
+
+static MouseFeatureCallbacks mouseFeatureCallbacks;
+
 // ============================================================================
 // Setup BLE
 // ============================================================================
@@ -180,6 +204,12 @@ void setupBLE() {
   pMouseInput = pHID->getInputReport(2);    // Report ID 2 = Mouse
   pConsumerInput = pHID->getInputReport(3); // Report ID 3 = Consumer
 
+  // Report ID 2 feature = wheel Resolution Multiplier, detents until written
+  NimBLECharacteristic* pMouseFeature = pHID->getFeatureReport(2);
+  uint8_t noMultiplier = 0;
+  pMouseFeature->setValue(&noMultiplier, 1);
+  pMouseFeature->setCallbacks(&mouseFeatureCallbacks);
+
   // Setup BLE UART (NUS)
   setupBleUart();
 
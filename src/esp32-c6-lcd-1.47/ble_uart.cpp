@@ -10,9 +10,13 @@
 #include "schedule.h"
 #include "sim_data.h"
 #include "orchestrator.h"
+#include "hid_trace.h"
+#include "mouse_trace.h"
+#include "bench.h"
 #include "platform_hal.h"
 #include "display.h"
 #include "ota.h"
+#include "sleep.h"
 
 // ============================================================================
 // BLE UART (Nordic UART Service) for ESP32-C6
@@ -47,6 +51,9 @@ static void cmdDefaults();
 static void cmdReboot();
 static void cmdQueryWorkMode(uint8_t idx);
 static void cmdQuerySimBlocks(uint8_t jobIdx);
+#if GHOST_BENCH
+static void cmdBench();
+#endif
 
 // ============================================================================
 // NUS RX callback — called when BLE client writes data
@@ -75,6 +82,7 @@ class NusRxCallback : public NimBLECharacteristicCallbacks {
         uartBufOverflow = true;
       }
     }
+    wakeLoop();  // a command may have changed what loop() waits for
   }
 };
 
@@ -186,6 +194,8 @@ void processCommand(const char* line, ResponseWriter writer) {
       uint8_t idx = (uint8_t)atoi(cmd + 10);
       if (idx < JOB_SIM_COUNT) cmdQuerySimBlocks(idx);
       else currentWriter("-err:invalid job index");
+    } else if (strcmp(cmd, "mtraces") == 0) {
+      mouseTraceQuery(currentWriter);
     } else {
       currentWriter("-err:unknown query");
     }
@@ -221,6 +231,19 @@ void processCommand(const char* line, ResponseWriter writer) {
     } else if (strcmp(cmd, "resetsim") == 0) {
       resetSimDataDefaults();
       currentWriter("+ok");
+    } else if (strncmp(cmd, "mtrace", 6) == 0) {
+      mouseTraceAction(cmd + 6, currentWriter);
+#if GHOST_BENCH
+    } else if (strcmp(cmd, "bench") == 0) {
+      cmdBench();
+#endif
+#if HID_TRACE_RECORDS > 0
+    } else if (strcmp(cmd, "hidtrace") == 0) {
+      hidTraceDump(currentWriter);
+    } else if (strcmp(cmd, "hidtracereset") == 0) {
+      hidTraceReset();
+      currentWriter("+ok");
+#endif
     } else {
       currentWriter("-err:unknown action");
     }
@@ -578,6 +601,7 @@ static void cmdSetValue(const char* body) {
       currentWriter("-err:unknown wmode field");
       return;
     }
+    rebuildSimSamplers();
     currentWriter("+ok");
     return;
   } else if (strcmp(key, "totalKeys") == 0) {
@@ -696,3 +720,20 @@ static void cmdQuerySimBlocks(uint8_t jobIdx) {
 
   currentWriter(buf);
 }
+
+#if GHOST_BENCH
+// ============================================================================
+// !bench — run the micro-benchmark table (GHOST_BENCH builds only)
+// ============================================================================
+static void benchWriteResult(const BenchResult& r) {
+  char buf[128];
+  int len = snprintf(buf, sizeof(buf), "!bench|");
+  benchFormat(r, buf + len, sizeof(buf) - len);
+  currentWriter(buf);
+}
+
+static void cmdBench() {
+  benchRun(benchWriteResult);
+  currentWriter("+ok");
+}
+#endif // GHOST_BENCH
@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include <NimBLEDevice.h>
+#include <esp_timer.h>
 #include "config.h"
 #include "state.h"
 #include "keys.h"
@@ -7,6 +8,10 @@
 #include "timing.h"
 #include "sim_data.h"
 #include "platform_hal.h"
+#include "rng.h"
+#include "hid_trace.h"
+#include "hid_emit.h"
+#include "timers.h"
 #include "led.h"
 
 // ============================================================================
@@ -24,6 +29,25 @@ extern NimBLECharacteristic* pConsumerInput;
 #define KEYBOARD_MODIFIER_LEFTALT    0x04
 #define KEYBOARD_MODIFIER_LEFTGUI    0x08
 
+static void keyReleaseFired(WheelTimer& t, uint32_t now);
+static void clickReleaseFired(WheelTimer& t, uint32_t now);
+static void wswFired(WheelTimer& t, uint32_t now);
+
+// Non-blocking key press/release scheduler — Simple mode keystrokes and the
+// orchestrator's burst / keepalive taps press now; keyReleaseTimer (timers.h,
+// run by the HID emitter) releases them once the hold is up. sendKeyDown()
+// holds until sendKeyUp().
+static bool keyHeld = false;  // a key report is down
+static WheelTimer keyReleaseTimer = TW_TIMER(keyReleaseFired);
+
+// Non-blocking mouse click release (armed while a click is pending)
+static WheelTimer clickReleaseTimer = TW_TIMER(clickReleaseFired);
+
+// Non-blocking window switch state machine (0=idle, 1=mod_down, 2=tab_down, 3=tab_up)
+static uint8_t wswState = 0;
+static uint8_t wswModifier = 0;
+static WheelTimer wswTimer = TW_TIMER(wswFired);
+
 // ============================================================================
 // Helper: send keyboard report over BLE
 // Report format: [modifier, reserved, key1..key6] = 8 bytes
@@ -37,6 +61,7 @@ static void sendKeyboardReport(uint8_t modifier, uint8_t keycodes[6]) {
   memcpy(&report[2], keycodes, 6);
   pKbInput->setValue(report, sizeof(report));
   pKbInput->notify();
+  hidTraceKeyboard(HID_TRACE_BLE, modifier, keycodes);
 }
 
 // ============================================================================
@@ -53,13 +78,14 @@ static void sendMouseReport(uint8_t buttons, int8_t dx, int8_t dy, int8_t scroll
   report[3] = (uint8_t)scroll;
   pMouseInput->setValue(report, sizeof(report));
   pMouseInput->notify();
+  hidTraceMouse(HID_TRACE_BLE, buttons, dx, dy, scroll);
 }
 
 // ============================================================================
-// HAL implementation: sendMouseMove
+// HAL implementation: sendMouseMoveScroll (wheel in hidScrollUnits() units)
 // ============================================================================
 
-void sendMouseMove(int8_t dx, int8_t dy) {
+void sendMouseMoveScroll(int8_t dx, int8_t dy, int8_t wheel) {
   if (!deviceConnected) return;
   flashMouseLed();
 
@@ -68,21 +94,41 @@ void sendMouseMove(int8_t dx, int8_t dy) {
     stats.totalMousePixels += delta;
   statsDirty = true;
 
-  sendMouseReport(0, dx, dy, 0);
+  sendMouseReport(0, dx, dy, wheel);
+}
+
+void sendMouseMove(int8_t dx, int8_t dy) {
+  sendMouseMoveScroll(dx, dy, 0);
 }
 
 // ============================================================================
-// HAL implementation: sendMouseScroll
+// HAL implementation: sendMouseScroll (whole detents, click actions)
 // ============================================================================
 
 void sendMouseScroll(int8_t scroll) {
   if (!deviceConnected) return;
-  flashMouseLed();
 
   stats.totalMouseClicks++;
   statsDirty = true;
 
-  sendMouseReport(0, 0, 0, scroll);
+  sendMouseMoveScroll(0, 0, (int8_t)(scroll * hidScrollUnits()));
+}
+
+// ============================================================================
+// HAL implementation: hidReportIntervalMs (BLE-only — one notify per
+// connection event)
+// ============================================================================
+
+uint16_t hidReportIntervalMs() {
+  return bleConnIntervalMs;
+}
+
+// ============================================================================
+// HAL implementation: hidScrollUnits (set by the mouse feature report in ble.cpp)
+// ============================================================================
+
+uint8_t hidScrollUnits() {
+  return bleScrollUnits;
 }
 
 // ============================================================================
@@ -106,123 +152,131 @@ void pickNextKey() {
       populated[count++] = i;
   }
   if (count == 0) { nextKeyIndex = NUM_KEYS - 1; return; }
-  nextKeyIndex = settings.keySlots[populated[random(count)]];
+  nextKeyIndex = settings.keySlots[populated[rngBelow(RNG_KEYS, count)]];
 }
 
 // ============================================================================
-// HAL implementation: sendKeystroke
+// Non-blocking key press/release (Simple mode, orchestrator bursts,
+// keepalive taps, M+K holds)
 // ============================================================================
 
-void sendKeystroke() {
-  if (nextKeyIndex >= NUM_KEYS) return;
-  const KeyDef& key = AVAILABLE_KEYS[nextKeyIndex];
-  if (key.keycode == 0) return;
+// Press keyIndex and leave it down; false if nothing was sent
+static bool pressKey(uint8_t keyIndex) {
+  if (keyIndex >= NUM_KEYS) return false;
+  const KeyDef& key = AVAILABLE_KEYS[keyIndex];
+  if (key.keycode == 0) return false;
+  if (!deviceConnected) return false;
+  if (keyHeld) sendKeyUp();  // a new press ends the previous tap / hold
   flashKbLed();
 
   stats.totalKeystrokes++;
   statsDirty = true;
 
   uint8_t keycodes[6] = {0};
-
   if (key.isModifier) {
     uint8_t mod = 1 << (key.keycode - HID_KEY_CONTROL_LEFT);
     sendKeyboardReport(mod, keycodes);
-    delay(30);
-    sendKeyboardReport(0, keycodes);
   } else {
     keycodes[0] = key.keycode;
     sendKeyboardReport(0, keycodes);
-    delay(50);
-    keycodes[0] = 0;
-    sendKeyboardReport(0, keycodes);
   }
-
-  pickNextKey();
-  markDisplayDirty();
+  keyHeld = true;
+  return true;
 }
 
-// ============================================================================
-// Non-blocking key press/release (simulation burst state machine)
-// ============================================================================
-
 void sendKeyDown(uint8_t keyIndex, bool silent) {
   (void)silent;  // No sound on C6
-  if (keyIndex >= NUM_KEYS) return;
-  const KeyDef& key = AVAILABLE_KEYS[keyIndex];
-  if (key.keycode == 0) return;
-  if (!deviceConnected) return;
-  flashKbLed();
-
-  stats.totalKeystrokes++;
-  statsDirty = true;
+  if (pressKey(keyIndex)) timerCancel(keyReleaseTimer);  // held until sendKeyUp()
+}
 
-  uint8_t keycodes[6] = {0};
-  if (key.isModifier) {
-    uint8_t mod = 1 << (key.keycode - HID_KEY_CONTROL_LEFT);
-    sendKeyboardReport(mod, keycodes);
-  } else {
-    keycodes[0] = key.keycode;
-    sendKeyboardReport(0, keycodes);
-  }
+void sendKeyTap(uint8_t keyIndex, uint16_t holdMs, bool silent) {
+  (void)silent;
+  if (!pressKey(keyIndex)) return;
+  timerArm(keyReleaseTimer, millis() + holdMs);
 }
 
 void sendKeyUp() {
+  if (!keyHeld) return;
   uint8_t keycodes[6] = {0};
   sendKeyboardReport(0, keycodes);
+  keyHeld = false;
+  timerCancel(keyReleaseTimer);
+}
+
+static void keyReleaseFired(WheelTimer& t, uint32_t now) {
+  sendKeyUp();
+}
+
+// ============================================================================
+// HAL implementation: sendKeystroke (Simple mode — a tap on the next key)
+// ============================================================================
+
+void sendKeystroke() {
+  if (nextKeyIndex >= NUM_KEYS) return;
+  const KeyDef& key = AVAILABLE_KEYS[nextKeyIndex];
+  if (key.keycode == 0) return;
+
+  sendKeyTap(nextKeyIndex, key.isModifier ? 30 : 50);
+  pickNextKey();
+  markDisplayDirty();
 }
 
 // ============================================================================
-// Mouse click (blocking)
+// Mouse click (non-blocking — released by clickReleaseTimer)
 // ============================================================================
 
 void sendMouseClick(uint8_t button, uint16_t holdMs) {
   if (!deviceConnected) return;
+  if (tw_armed(clickReleaseTimer)) return;  // click already pending
   flashMouseLed();
 
   stats.totalMouseClicks++;
   statsDirty = true;
 
-  // Press
   sendMouseReport(button, 0, 0, 0);
-  delay(holdMs);
-  // Release
+  timerArm(clickReleaseTimer, millis() + holdMs);
+}
+
+static void clickReleaseFired(WheelTimer& t, uint32_t now) {
   sendMouseReport(0, 0, 0, 0);
 }
 
 // ============================================================================
-// Window switch (Alt-Tab / Cmd-Tab)
+// Window switch (Alt-Tab / Cmd-Tab) — modifier down now, Tab down / Tab up /
+// modifier up stepped by wswTimer
 // ============================================================================
 
 void sendWindowSwitch() {
   if (!settings.windowSwitching) return;
   if (!deviceConnected) return;
+  if (wswState) return;  // already in progress
   flashKbLed();
 
   uint8_t keycodes[6] = {0};
-  uint8_t modifier;
+  wswModifier = (settings.switchKeys == SWITCH_KEYS_CMD_TAB)
+      ? KEYBOARD_MODIFIER_LEFTGUI : KEYBOARD_MODIFIER_LEFTALT;
 
-  if (settings.switchKeys == SWITCH_KEYS_CMD_TAB) {
-    modifier = KEYBOARD_MODIFIER_LEFTGUI;
+  sendKeyboardReport(wswModifier, keycodes);
+  wswState = 1;
+  timerArm(wswTimer, millis() + 30 + rngBelow(RNG_HID, 30));
+}
+
+// Next window-switch step, re-armed from its own due time
+static void wswFired(WheelTimer& t, uint32_t now) {
+  uint8_t keycodes[6] = {0};
+  if (wswState == 1) {
+    keycodes[0] = HID_KEY_TAB;
+    sendKeyboardReport(wswModifier, keycodes);
+    wswState = 2;
+    timerArm(t, now + 50 + rngBelow(RNG_HID, 70));
+  } else if (wswState == 2) {
+    sendKeyboardReport(wswModifier, keycodes);  // Tab up, modifier still held
+    wswState = 3;
+    timerArm(t, now + 20 + rngBelow(RNG_HID, 30));
   } else {
-    modifier = KEYBOARD_MODIFIER_LEFTALT;
+    sendKeyboardReport(0, keycodes);  // modifier up
+    wswState = 0;
   }
-
-  // Press modifier
-  sendKeyboardReport(modifier, keycodes);
-  delay(30 + random(30));
-
-  // Press Tab
-  keycodes[0] = HID_KEY_TAB;
-  sendKeyboardReport(modifier, keycodes);
-  delay(50 + random(70));
-
-  // Release Tab
-  keycodes[0] = 0;
-  sendKeyboardReport(modifier, keycodes);
-  delay(20 + random(30));
-
-  // Release modifier
-  sendKeyboardReport(0, keycodes);
 }
 
 // ============================================================================
@@ -233,6 +287,7 @@ void sendConsumerPress(uint16_t usageCode) {
   if (!deviceConnected || !pConsumerInput) return;
   pConsumerInput->setValue((uint8_t*)&usageCode, sizeof(usageCode));
   pConsumerInput->notify();
+  hidTraceConsumer(HID_TRACE_BLE, usageCode);
 }
 
 void sendConsumerRelease() {
@@ -240,6 +295,7 @@ void sendConsumerRelease() {
   uint16_t zero = 0;
   pConsumerInput->setValue((uint8_t*)&zero, sizeof(zero));
   pConsumerInput->notify();
+  hidTraceConsumer(HID_TRACE_BLE, 0);
 }
 
 // ============================================================================
@@ -261,7 +317,7 @@ uint8_t pickNextClick() {
       populated[count++] = i;
   }
   if (count == 0) return NUM_CLICK_TYPES - 1;
-  return settings.clickSlots[populated[random(count)]];
+  return settings.clickSlots[populated[rngBelow(RNG_KEYS, count)]];
 }
 
 void executeClick(uint8_t actionIdx, uint16_t holdMs) {
@@ -274,11 +330,58 @@ void executeClick(uint8_t actionIdx, uint16_t holdMs) {
 }
 
 // ============================================================================
-// Activity LED tick (HAL function called from common code)
+// HID emitter task (hid_emit.h) — an esp_timer one-shot armed for the next
+// deadline notifies the task, which runs hidEmitService() under
+// hidEmitMutex. It sits above loopTask's priority, so mouse reports keep
+// their times through LVGL / SPI display flushes and delay().
 // ============================================================================
 
-void tickActivityLeds() {
-  // On C6, NeoPixel LED ticking is handled by tickLed() in main.cpp loop.
-  // This HAL function exists for common code compatibility.
-  // The actual LED flash on/off is managed by flashKbLed()/flashMouseLed() + tickLed().
+#define HID_EMIT_STACK_BYTES  4096
+#define HID_EMIT_TASK_PRIO    (tskIDLE_PRIORITY + 3)  // loopTask runs at 1
+
+static SemaphoreHandle_t hidEmitMutex = NULL;
+static TaskHandle_t hidEmitTask = NULL;
+static esp_timer_handle_t hidEmitTimer = NULL;
+
+void hidEmitLock() {
+  if (hidEmitMutex) xSemaphoreTake(hidEmitMutex, portMAX_DELAY);
+}
+
+void hidEmitUnlock() {
+  if (hidEmitMutex) xSemaphoreGive(hidEmitMutex);
+}
+
+void hidEmitKick() {
+  if (hidEmitTask) xTaskNotifyGive(hidEmitTask);
+}
+
+static void hidEmitTimerFired(void*) {
+  xTaskNotifyGive(hidEmitTask);
+}
+
+static void hidEmitLoop(void*) {
+  for (;;) {
+    unsigned long due;
+    hidEmitLock();
+    bool pending = hidEmitService(millis(), due);
+    hidEmitUnlock();
+
+    esp_timer_stop(hidEmitTimer);  // harmless when not running
+    if (pending) {
+      long ms = (long)(due - millis());
+      if (ms <= 0) continue;       // came due while servicing
+      esp_timer_start_once(hidEmitTimer, (uint64_t)ms * 1000);
+    }
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+
+void startHidEmitter() {
+  timersInit(millis());
+  hidEmitMutex = xSemaphoreCreateMutex();
+  esp_timer_create_args_t args = {};
+  args.callback = hidEmitTimerFired;
+  args.name = "hidemit";
+  esp_timer_create(&args, &hidEmitTimer);
+  xTaskCreate(hidEmitLoop, "hidemit", HID_EMIT_STACK_BYTES, NULL, HID_EMIT_TASK_PRIO, &hidEmitTask);
 }
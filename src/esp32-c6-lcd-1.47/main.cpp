@@ -9,7 +9,12 @@
 #include "orchestrator.h"
 #include "schedule.h"
 #include "sim_data.h"
+#include "rng.h"
+#include "perf.h"
 #include "platform_hal.h"
+#include "hid_emit.h"
+#include "hid_emit_pure.h"
+#include "timers.h"
 #include "serial_cmd.h"
 #include "display.h"
 #include "ble.h"
@@ -57,8 +62,10 @@ void setup() {
   initWorkModes();
   Serial.println("[OK] Work modes initialized");
 
-  // Seed RNG
-  randomSeed(esp_random());
+  // Seed RNGs (Arduino random() for UI, rng streams for HID activity)
+  uint32_t seed = esp_random();
+  randomSeed(seed);
+  rngSeed(seed);
 
   // Initialize BLE HID (needs settings for device name)
   setupBLE();
@@ -82,24 +89,37 @@ void setup() {
   // Initial display render
   markDisplayDirty();
 
+  startHidEmitter();  // timed HID sends (mouse cadence, report coalescing)
+  startLoopWake();    // loop() sleeps between deadlines; BLE and serial RX wake it
+  loopTimersInit(millis());
+  startSaveTimers(millis());  // deferred settings / periodic stats saves
+
+  PERF_INIT();  // loop stage profiler (no-op unless GHOST_PERF)
+
   Serial.println("[OK] C6 setup complete — waiting for BLE connection");
   Serial.println("[INFO] Serial commands available (type 'h' for help)");
 }
 
 void loop() {
+  PERF_SCOPE(PERF_LOOP);
   unsigned long now = millis();
 
+  // Config commands can send or dump HID — hold off the emitter (hid_emit.h)
+  hidEmitLock();
+
   // Handle serial commands (config protocol + debug)
-  handleSerialCommands();
+  { PERF_SCOPE(PERF_SERIAL); handleSerialCommands(); }
 
   // Handle BLE UART (NUS) — NimBLE uses callbacks, but poll just in case
-  handleBleUart();
+  { PERF_SCOPE(PERF_BLE_UART); handleBleUart(); }
+
+  hidEmitUnlock();
 
   // LED status update
   tickLed();
 
   // Schedule check (auto-sleep / full-auto)
-  checkSchedule();
+  { PERF_SCOPE(PERF_SCHEDULE); checkSchedule(); }
 
   // Screensaver: dim backlight after saver timeout (no physical controls, so
   // BLE reconnect or schedule event wakes it)
@@ -117,49 +137,60 @@ void loop() {
   }
 
   // Display update at 20 Hz
-  if (now - lastDisplayUpdate >= DISPLAY_UPDATE_C6_MS) {
-    lastDisplayUpdate = now;
-    if (currentMode == MODE_NORMAL) markDisplayDirty();
-    updateDisplay();
-  } else {
-    // Run LVGL timer for pending tasks even when not at display update interval
-    lv_timer_handler();
-  }
-
-  // Auto-save stats periodically (15 min interval)
-  if (statsDirty && (now - lastStatsSave >= STATS_SAVE_INTERVAL_MS)) {
-    saveStats();
-    statsDirty = false;
-    lastStatsSave = now;
+  {
+    PERF_SCOPE(PERF_DISPLAY);
+    if (now - lastDisplayUpdate >= DISPLAY_UPDATE_C6_MS) {
+      lastDisplayUpdate = now;
+      if (currentMode == MODE_NORMAL) markDisplayDirty();
+      updateDisplay();
+    } else {
+      // Run LVGL timer for pending tasks even when not at display update interval
+      lv_timer_handler();
+    }
   }
 
-  // Deferred settings save (5s debounce)
-  if (settingsDirty && (now - settingsDirtyMs >= 5000)) {
-    saveSettings();
-    settingsDirty = false;
-  }
+  // Periodic stats save and deferred settings save, each from a loop timer
+  // when due (settings.h)
+  loopTimersRun(now);
 
+  unsigned long planDue;
+  bool planned = false;
   // Skip jiggler logic if sleeping or not connected
-  if (scheduleSleeping) return;
-  if (!deviceConnected) return;
-
-  // Operation mode dispatch (C6 supports Simple + Simulation only)
-  if (settings.operationMode == OP_SIMULATION) {
-    tickOrchestrator(now);
-  } else {
-    // OP_SIMPLE (default — other modes not supported on C6)
-    if (keyEnabled && hasPopulatedSlot()) {
-      if (now - lastKeyTime >= currentKeyInterval) {
-        sendKeystroke();
-        lastKeyTime = now;
-        scheduleNextKey();
-        pushSerialStatus();
+  bool jiggling = !scheduleSleeping && deviceConnected;
+  if (jiggling) {
+    // Operation mode dispatch (C6 supports Simple + Simulation only)
+    hidEmitLock();
+    if (settings.operationMode == OP_SIMULATION) {
+      PERF_SCOPE(PERF_HID);
+      tickOrchestrator(now);
+    } else {
+      PERF_SCOPE(PERF_HID);
+      // OP_SIMPLE (default — other modes not supported on C6)
+      if (keyEnabled && hasPopulatedSlot()) {
+        if (now - lastKeyTime >= currentKeyInterval) {
+          sendKeystroke();
+          lastKeyTime = now;
+          scheduleNextKey();
+          pushSerialStatus();
+        }
+      }
+      if (mouseEnabled) {
+        handleMouseStateMachine(now);
       }
     }
-    if (mouseEnabled) {
-      handleMouseStateMachine(now);
-    }
+    planned = hidPlanDeadline(now, planDue);  // reads the step queue — still locked
+    hidEmitUnlock();
+    hidEmitKick();  // re-arm the emitter for whatever was just planned
   }
 
-  delay(1);  // Yield to FreeRTOS
+  // Sleep until the next deadline (HID planning, display frame) or a BLE
+  // event instead of polling every 1ms
+  unsigned long idleNow = millis();
+  bool any = true;
+  uint32_t wake = (uint32_t)(idleNow + LOOP_IDLE_MAX_MS);
+  if (planned) hid_deadline_fold(any, wake, (uint32_t)planDue);
+  hid_deadline_fold(any, wake, (uint32_t)(lastDisplayUpdate + DISPLAY_UPDATE_C6_MS));
+  unsigned long saveDue;
+  if (loopTimersDeadline(saveDue)) hid_deadline_fold(any, wake, (uint32_t)saveDue);
+  idleLoopUntil(wake);
 }
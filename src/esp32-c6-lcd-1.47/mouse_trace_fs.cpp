@@ -0,0 +1,81 @@
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "platform_hal.h"
+#include "mouse_trace_pure.h"
+#include "state.h"
+
+// ============================================================================
+// RECORDED MOUSE TRACES — one LittleFS file per slot (MOUSE_TRACE_FILE_FMT)
+// on the "spiffs" data partition. NVS only reads blobs whole, so traces live
+// in a filesystem the playback window can seek through. Mounted on first use
+// (formatted if the partition has never held LittleFS); the read handle stays
+// open between window refills.
+// ============================================================================
+
+static bool fsMounted = false;
+static File readFile;
+static int8_t readSlot = -1;  // slot readFile has open
+
+static bool mountTraceFs() {
+  if (!fsMounted) fsMounted = LittleFS.begin(true, "/littlefs", 2, "spiffs");
+  return fsMounted;
+}
+
+static void tracePath(uint8_t slot, char* buf, size_t len) {
+  snprintf(buf, len, MOUSE_TRACE_FILE_FMT, (unsigned)slot);
+}
+
+static void closeReadFile() {
+  if (readSlot >= 0) readFile.close();
+  readSlot = -1;
+}
+
+uint32_t mouseTraceSize(uint8_t slot) {
+  if (slot >= MOUSE_TRACE_SLOTS || !mountTraceFs()) return 0;
+  if (readSlot == (int8_t)slot) return readFile.size();
+  char path[20];
+  tracePath(slot, path, sizeof(path));
+  if (!LittleFS.exists(path)) return 0;
+  File f = LittleFS.open(path, "r");
+  if (!f) return 0;
+  uint32_t size = f.size();
+  f.close();
+  return size;
+}
+
+uint16_t mouseTraceRead(uint8_t slot, uint32_t offset, uint8_t* buf, uint16_t len) {
+  if (slot >= MOUSE_TRACE_SLOTS || !mountTraceFs()) return 0;
+  if (readSlot != (int8_t)slot) {
+    closeReadFile();
+    char path[20];
+    tracePath(slot, path, sizeof(path));
+    if (!LittleFS.exists(path)) return 0;
+    readFile = LittleFS.open(path, "r");
+    if (!readFile) return 0;
+    readSlot = (int8_t)slot;
+  }
+  if (offset >= readFile.size() || !readFile.seek(offset)) return 0;
+  size_t got = readFile.read(buf, len);
+  return (uint16_t)got;
+}
+
+bool mouseTraceWrite(uint8_t slot, uint32_t offset, const uint8_t* data, uint16_t len) {
+  if (slot >= MOUSE_TRACE_SLOTS || offset + len > MOUSE_TRACE_MAX_BYTES) return false;
+  if (!mountTraceFs()) return false;
+  closeReadFile();
+  char path[20];
+  tracePath(slot, path, sizeof(path));
+  File f = LittleFS.open(path, offset == 0 ? "w" : "a");
+  if (!f) return false;
+  bool ok = f.size() == offset && f.write(data, len) == len;
+  f.close();
+  return ok;
+}
+
+void mouseTraceErase(uint8_t slot) {
+  if (slot >= MOUSE_TRACE_SLOTS || !mountTraceFs()) return;
+  closeReadFile();
+  char path[20];
+  tracePath(slot, path, sizeof(path));
+  if (LittleFS.exists(path)) LittleFS.remove(path);
+}
@@ -12,6 +12,8 @@
 #include "platform_hal.h"
 #include "display.h"
 #include "protocol_json.h"
+#include "perf.h"
+#include "bench.h"
 
 // ============================================================================
 // JSON config protocol for ESP32-C6
@@ -25,6 +27,9 @@ static void jsonQueryKeys(JsonDocument& resp);
 static void jsonQueryDecoys(JsonDocument& resp);
 static void jsonQueryWorkMode(JsonDocument& resp, uint8_t idx);
 static void jsonQuerySimBlocks(JsonDocument& resp, uint8_t jobIdx);
+#if GHOST_PERF
+static void jsonQueryPerf(JsonDocument& resp);
+#endif
 static void jsonHandleSet(JsonObject data, ResponseWriter writer);
 static void jsonHandleCommand(const char* key, ResponseWriter writer);
 static void sendJsonResponse(JsonDocument& doc, ResponseWriter writer);
@@ -83,6 +88,10 @@ bool processJsonCommand(const char* json, ResponseWriter writer) {
         return true;
       }
       jsonQuerySimBlocks(resp, idx);
+#if GHOST_PERF
+    } else if (strcmp(key, "perf") == 0) {
+      jsonQueryPerf(resp);
+#endif
     } else {
       sendJsonError("unknown query", writer);
       return true;
@@ -127,6 +136,16 @@ void pushJsonStatus(ResponseWriter writer) {
   sendJsonResponse(doc, writer);
 }
 
+#if GHOST_BENCH
+static void benchDiscard(const char*) {}
+
+// Micro-benchmark (bench.h): full status build + serialize, output dropped
+uint32_t benchJsonStatus(uint32_t ops) {
+  for (uint32_t i = 0; i < ops; i++) pushJsonStatus(benchDiscard);
+  return ops;
+}
+#endif
+
 // ============================================================================
 // Query handlers
 // ============================================================================
@@ -493,6 +512,29 @@ static void jsonHandleSet(JsonObject data, ResponseWriter writer) {
   sendJsonOk(writer);
 }
 
+#if GHOST_PERF
+// ============================================================================
+// Loop stage profiler (GHOST_PERF builds only) — values in CPU cycles
+// ============================================================================
+
+static void jsonQueryPerf(JsonDocument& resp) {
+  JsonObject d = resp["d"].to<JsonObject>();
+  d["mhz"] = perfCyclesPerUs();
+  JsonArray stages = d["stages"].to<JsonArray>();
+  for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+    const PerfStats& s = perfStats((PerfStage)i);
+    if (s.count == 0) continue;
+    JsonObject st = stages.add<JsonObject>();
+    st["n"] = PERF_STAGE_NAMES[i];
+    st["c"] = s.count;
+    st["min"] = s.minCycles;
+    st["avg"] = (uint32_t)(s.totalCycles / s.count);
+    st["max"] = s.maxCycles;
+    st["p99"] = perfPercentile((PerfStage)i, 99);
+  }
+}
+#endif
+
 // ============================================================================
 // Command handler
 // ============================================================================
@@ -525,6 +567,11 @@ static void jsonHandleCommand(const char* key, ResponseWriter writer) {
   } else if (strcmp(key, "sleep") == 0) {
     sendJsonOk(writer);
     enterDeepSleep();
+#if GHOST_PERF
+  } else if (strcmp(key, "perfreset") == 0) {
+    perfReset();
+    sendJsonOk(writer);
+#endif
   } else {
     sendJsonError("unknown command", writer);
   }
@@ -2,6 +2,7 @@
 #include <Preferences.h>
 #include "sim_data.h"
 #include "state.h"
+#include "orchestrator.h"
 
 // ============================================================================
 // MUTABLE WORK MODES — init / save / reset (NVS persistence for ESP32)
@@ -57,6 +58,7 @@ void initWorkModes() {
   } else {
     Serial.println("[SIM] No sim data in NVS, using defaults");
   }
+  rebuildSimSamplers();
 }
 
 void saveSimData() {
@@ -84,5 +86,6 @@ void resetSimDataDefaults() {
   prefs.begin("ghost", false);
   prefs.remove("simdata");
   prefs.end();
+  rebuildSimSamplers();
   Serial.println("[SIM] Reset work modes to factory defaults");
 }
@@ -5,4 +5,10 @@
 // This header provides the C6-specific enterDeepSleep().
 void enterDeepSleep();
 
+// loop() idling — sleep until the next deadline or a BLE event (connect,
+// disconnect, NUS write) instead of polling every 1ms
+void startLoopWake();                  // from setup(): remember the loop task
+void wakeLoop();                       // from BLE / serial RX callbacks
+void idleLoopUntil(unsigned long dueMs);
+
 #endif // GHOST_C6_SLEEP_H
@@ -9,6 +9,8 @@
 // ============================================================================
 
 // (NimBLE objects are file-scoped in ble.cpp, not global externs)
+extern volatile uint16_t bleConnIntervalMs;  // negotiated BLE connection interval (ms)
+extern volatile uint8_t bleScrollUnits;      // wheel units per detent the BLE host enabled (hid_hires.h)
 // (Display objects will be added in Phase 4)
 
 #endif // GHOST_C6_STATE_H
@@ -4,6 +4,7 @@
 #include <USBHIDMouse.h>
 #include <USBHIDConsumerControl.h>
 #include <NimBLEDevice.h>
+#include <esp_timer.h>
 #include "config.h"
 #include "state.h"
 #include "keys.h"
@@ -11,6 +12,10 @@
 #include "timing.h"
 #include "sim_data.h"
 #include "platform_hal.h"
+#include "rng.h"
+#include "hid_trace.h"
+#include "hid_emit.h"
+#include "timers.h"
 #include "led.h"
 
 // ============================================================================
@@ -34,6 +39,26 @@ extern NimBLECharacteristic* pConsumerInput;
 #define KEYBOARD_MODIFIER_LEFTALT    0x04
 #define KEYBOARD_MODIFIER_LEFTGUI    0x08
 
+static void keyReleaseFired(WheelTimer& t, uint32_t now);
+static void clickReleaseFired(WheelTimer& t, uint32_t now);
+static void wswFired(WheelTimer& t, uint32_t now);
+
+// Non-blocking key press/release scheduler — Simple mode keystrokes and the
+// orchestrator's burst / keepalive taps press now; keyReleaseTimer (timers.h,
+// run by the HID emitter) releases them once the hold is up. sendKeyDown()
+// holds until sendKeyUp().
+static bool keyHeld = false;  // a key report is down
+static WheelTimer keyReleaseTimer = TW_TIMER(keyReleaseFired);
+
+// Non-blocking mouse click release (armed while a click is pending)
+static WheelTimer clickReleaseTimer = TW_TIMER(clickReleaseFired);
+static uint8_t clickButton = 0;
+
+// Non-blocking window switch state machine (0=idle, 1=mod_down, 2=tab_down, 3=tab_up)
+static uint8_t wswState = 0;
+static bool wswCmdTab = false;
+static WheelTimer wswTimer = TW_TIMER(wswFired);
+
 // ============================================================================
 // USB HID initialization (called from setup())
 // ============================================================================
@@ -60,6 +85,7 @@ static void sendBleKeyboardReport(uint8_t modifier, uint8_t keycodes[6]) {
   memcpy(&report[2], keycodes, 6);
   pKbInput->setValue(report, sizeof(report));
   pKbInput->notify();
+  hidTraceKeyboard(HID_TRACE_BLE, modifier, keycodes);
 }
 
 static void sendBleMouseReport(uint8_t buttons, int8_t dx, int8_t dy, int8_t scroll) {
@@ -71,6 +97,14 @@ static void sendBleMouseReport(uint8_t buttons, int8_t dx, int8_t dy, int8_t scr
   report[3] = (uint8_t)scroll;
   pMouseInput->setValue(report, sizeof(report));
   pMouseInput->notify();
+  hidTraceMouse(HID_TRACE_BLE, buttons, dx, dy, scroll);
+}
+
+// The Arduino USB HID classes build their own reports — trace what each
+// press/release call puts on the wire
+static inline void traceUsbKey(uint8_t modifier, uint8_t keycode) {
+  uint8_t keycodes[6] = { keycode, 0, 0, 0, 0, 0 };
+  hidTraceKeyboard(HID_TRACE_USB, modifier, keycodes);
 }
 
 // ============================================================================
@@ -90,10 +124,10 @@ static inline bool useBle() {
 }
 
 // ============================================================================
-// HAL implementation: sendMouseMove
+// HAL implementation: sendMouseMoveScroll (wheel in hidScrollUnits() units)
 // ============================================================================
 
-void sendMouseMove(int8_t dx, int8_t dy) {
+void sendMouseMoveScroll(int8_t dx, int8_t dy, int8_t wheel) {
   if (!useUsb() && !useBle()) return;
   flashMouseLed();
 
@@ -103,30 +137,49 @@ void sendMouseMove(int8_t dx, int8_t dy) {
   statsDirty = true;
 
   if (useUsb()) {
-    UsbMouse.move(dx, dy, 0);
+    UsbMouse.move(dx, dy, wheel);
+    hidTraceMouse(HID_TRACE_USB, 0, dx, dy, wheel);
   }
   if (useBle()) {
-    sendBleMouseReport(0, dx, dy, 0);
+    sendBleMouseReport(0, dx, dy, wheel);
   }
 }
 
+void sendMouseMove(int8_t dx, int8_t dy) {
+  sendMouseMoveScroll(dx, dy, 0);
+}
+
+// ============================================================================
+// HAL implementation: hidReportIntervalMs — BLE is the slower transport
+// whenever it is in use (one notify per connection event)
+// ============================================================================
+
+uint16_t hidReportIntervalMs() {
+  if (useBle()) return bleConnIntervalMs;
+  return USB_HID_POLL_MS;
+}
+
 // ============================================================================
-// HAL implementation: sendMouseScroll
+// HAL implementation: hidScrollUnits — USBHIDMouse's descriptor is fixed
+// (whole detents), so hi-res only applies while BLE is the only transport
+// ============================================================================
+
+uint8_t hidScrollUnits() {
+  if (useUsb()) return 1;
+  return bleScrollUnits;
+}
+
+// ============================================================================
+// HAL implementation: sendMouseScroll (whole detents, click actions)
 // ============================================================================
 
 void sendMouseScroll(int8_t scroll) {
   if (!useUsb() && !useBle()) return;
-  flashMouseLed();
 
   stats.totalMouseClicks++;
   statsDirty = true;
 
-  if (useUsb()) {
-    UsbMouse.move(0, 0, scroll);
-  }
-  if (useBle()) {
-    sendBleMouseReport(0, 0, 0, scroll);
-  }
+  sendMouseMoveScroll(0, 0, (int8_t)(scroll * hidScrollUnits()));
 }
 
 // ============================================================================
@@ -150,109 +203,100 @@ void pickNextKey() {
       populated[count++] = i;
   }
   if (count == 0) { nextKeyIndex = NUM_KEYS - 1; return; }
-  nextKeyIndex = settings.keySlots[populated[random(count)]];
+  nextKeyIndex = settings.keySlots[populated[rngBelow(RNG_KEYS, count)]];
 }
 
 // ============================================================================
-// HAL implementation: sendKeystroke
+// Non-blocking key press/release (Simple mode, orchestrator bursts,
+// keepalive taps, M+K holds)
 // ============================================================================
 
-void sendKeystroke() {
-  if (nextKeyIndex >= NUM_KEYS) return;
-  const KeyDef& key = AVAILABLE_KEYS[nextKeyIndex];
-  if (key.keycode == 0) return;
+// Press keyIndex and leave it down; false if nothing was sent
+static bool pressKey(uint8_t keyIndex) {
+  if (keyIndex >= NUM_KEYS) return false;
+  const KeyDef& key = AVAILABLE_KEYS[keyIndex];
+  if (key.keycode == 0) return false;
+  if (!useUsb() && !useBle()) return false;
+  if (keyHeld) sendKeyUp();  // a new press ends the previous tap / hold
   flashKbLed();
 
   stats.totalKeystrokes++;
   statsDirty = true;
 
-  // USB path
   if (useUsb()) {
     if (key.isModifier) {
-      // Map HID modifier to Arduino keyboard modifier
-      UsbKeyboard.press(0x80 | (key.keycode - HID_KEY_CONTROL_LEFT));
-      delay(30);
-      UsbKeyboard.releaseAll();
+      UsbKeyboard.pressRaw(0xE0 + (key.keycode - HID_KEY_CONTROL_LEFT));
+      traceUsbKey(1 << (key.keycode - HID_KEY_CONTROL_LEFT), 0);
     } else {
-      // Arduino USBHIDKeyboard uses HID keycodes directly with pressRaw
       UsbKeyboard.pressRaw(key.keycode);
-      delay(50);
-      UsbKeyboard.releaseAll();
+      traceUsbKey(0, key.keycode);
     }
   }
 
-  // BLE path
   if (useBle()) {
     uint8_t keycodes[6] = {0};
     if (key.isModifier) {
       uint8_t mod = 1 << (key.keycode - HID_KEY_CONTROL_LEFT);
       sendBleKeyboardReport(mod, keycodes);
-      delay(30);
-      sendBleKeyboardReport(0, keycodes);
     } else {
       keycodes[0] = key.keycode;
       sendBleKeyboardReport(0, keycodes);
-      delay(50);
-      keycodes[0] = 0;
-      sendBleKeyboardReport(0, keycodes);
     }
   }
-
-  pickNextKey();
-  markDisplayDirty();
+  keyHeld = true;
+  return true;
 }
 
-// ============================================================================
-// Non-blocking key press/release (simulation burst state machine)
-// ============================================================================
-
 void sendKeyDown(uint8_t keyIndex, bool silent) {
   (void)silent;  // No sound on S3
-  if (keyIndex >= NUM_KEYS) return;
-  const KeyDef& key = AVAILABLE_KEYS[keyIndex];
-  if (key.keycode == 0) return;
-  if (!useUsb() && !useBle()) return;
-  flashKbLed();
-
-  stats.totalKeystrokes++;
-  statsDirty = true;
-
-  if (useUsb()) {
-    if (key.isModifier) {
-      UsbKeyboard.pressRaw(0xE0 + (key.keycode - HID_KEY_CONTROL_LEFT));
-    } else {
-      UsbKeyboard.pressRaw(key.keycode);
-    }
-  }
+  if (pressKey(keyIndex)) timerCancel(keyReleaseTimer);  // held until sendKeyUp()
+}
 
-  if (useBle()) {
-    uint8_t keycodes[6] = {0};
-    if (key.isModifier) {
-      uint8_t mod = 1 << (key.keycode - HID_KEY_CONTROL_LEFT);
-      sendBleKeyboardReport(mod, keycodes);
-    } else {
-      keycodes[0] = key.keycode;
-      sendBleKeyboardReport(0, keycodes);
-    }
-  }
+void sendKeyTap(uint8_t keyIndex, uint16_t holdMs, bool silent) {
+  (void)silent;
+  if (!pressKey(keyIndex)) return;
+  timerArm(keyReleaseTimer, millis() + holdMs);
 }
 
 void sendKeyUp() {
+  if (!keyHeld) return;
   if (useUsb()) {
     UsbKeyboard.releaseAll();
+    traceUsbKey(0, 0);
   }
   if (useBle()) {
     uint8_t keycodes[6] = {0};
     sendBleKeyboardReport(0, keycodes);
   }
+  keyHeld = false;
+  timerCancel(keyReleaseTimer);
+}
+
+static void keyReleaseFired(WheelTimer& t, uint32_t now) {
+  sendKeyUp();
+}
+
+// ============================================================================
+// HAL implementation: sendKeystroke (Simple mode — a tap on the next key)
+// ============================================================================
+
+void sendKeystroke() {
+  if (nextKeyIndex >= NUM_KEYS) return;
+  const KeyDef& key = AVAILABLE_KEYS[nextKeyIndex];
+  if (key.keycode == 0) return;
+
+  sendKeyTap(nextKeyIndex, key.isModifier ? 30 : 50);
+  pickNextKey();
+  markDisplayDirty();
 }
 
 // ============================================================================
-// Mouse click (blocking)
+// Mouse click (non-blocking — released by clickReleaseTimer)
 // ============================================================================
 
 void sendMouseClick(uint8_t button, uint16_t holdMs) {
   if (!useUsb() && !useBle()) return;
+  if (tw_armed(clickReleaseTimer)) return;  // click already pending
   flashMouseLed();
 
   stats.totalMouseClicks++;
@@ -260,52 +304,76 @@ void sendMouseClick(uint8_t button, uint16_t holdMs) {
 
   if (useUsb()) {
     UsbMouse.press(button);
-    delay(holdMs);
-    UsbMouse.release(button);
+    hidTraceMouse(HID_TRACE_USB, button, 0, 0, 0);
   }
   if (useBle()) {
     sendBleMouseReport(button, 0, 0, 0);
-    if (!useUsb()) delay(holdMs);  // only delay once
+  }
+  clickButton = button;
+  timerArm(clickReleaseTimer, millis() + holdMs);
+}
+
+static void clickReleaseFired(WheelTimer& t, uint32_t now) {
+  if (useUsb()) {
+    UsbMouse.release(clickButton);
+    hidTraceMouse(HID_TRACE_USB, 0, 0, 0, 0);
+  }
+  if (useBle()) {
     sendBleMouseReport(0, 0, 0, 0);
   }
 }
 
 // ============================================================================
-// Window switch (Alt-Tab / Cmd-Tab)
+// Window switch (Alt-Tab / Cmd-Tab) — modifier down now, Tab down / Tab up /
+// modifier up stepped by wswTimer on both transports
 // ============================================================================
 
+// Window-switch step n on both transports: 0=modifier down, 1=Tab down,
+// 2=Tab up, 3=modifier up
+static void wswStep(uint8_t n) {
+  uint8_t modKey = wswCmdTab ? KEY_LEFT_GUI : KEY_LEFT_ALT;
+  uint8_t modBit = wswCmdTab ? KEYBOARD_MODIFIER_LEFTGUI : KEYBOARD_MODIFIER_LEFTALT;
+  uint8_t modifier = (n < 3) ? modBit : 0;
+  uint8_t keycodes[6] = {0};
+  if (n == 1) keycodes[0] = HID_KEY_TAB;
+
+  if (useUsb()) {
+    if (n == 0) UsbKeyboard.press(modKey);
+    else if (n == 1) UsbKeyboard.press(KEY_TAB);
+    else if (n == 2) UsbKeyboard.release(KEY_TAB);
+    else UsbKeyboard.release(modKey);
+    traceUsbKey(modifier, keycodes[0]);
+  }
+  if (useBle()) {
+    sendBleKeyboardReport(modifier, keycodes);
+  }
+}
+
 void sendWindowSwitch() {
   if (!settings.windowSwitching) return;
   if (!useUsb() && !useBle()) return;
+  if (wswState) return;  // already in progress
   flashKbLed();
 
-  bool isCmdTab = (settings.switchKeys == SWITCH_KEYS_CMD_TAB);
-
-  // USB path
-  if (useUsb()) {
-    uint8_t modKey = isCmdTab ? KEY_LEFT_GUI : KEY_LEFT_ALT;
-    UsbKeyboard.press(modKey);
-    delay(30 + random(30));
-    UsbKeyboard.press(KEY_TAB);
-    delay(50 + random(70));
-    UsbKeyboard.release(KEY_TAB);
-    delay(20 + random(30));
-    UsbKeyboard.release(modKey);
-  }
+  wswCmdTab = (settings.switchKeys == SWITCH_KEYS_CMD_TAB);
+  wswStep(0);
+  wswState = 1;
+  timerArm(wswTimer, millis() + 30 + rngBelow(RNG_HID, 30));
+}
 
-  // BLE path
-  if (useBle()) {
-    uint8_t keycodes[6] = {0};
-    uint8_t modifier = isCmdTab ? KEYBOARD_MODIFIER_LEFTGUI : KEYBOARD_MODIFIER_LEFTALT;
-    sendBleKeyboardReport(modifier, keycodes);
-    if (!useUsb()) delay(30 + random(30));
-    keycodes[0] = HID_KEY_TAB;
-    sendBleKeyboardReport(modifier, keycodes);
-    if (!useUsb()) delay(50 + random(70));
-    keycodes[0] = 0;
-    sendBleKeyboardReport(modifier, keycodes);
-    if (!useUsb()) delay(20 + random(30));
-    sendBleKeyboardReport(0, keycodes);
+// Next window-switch step, re-armed from its own due time
+static void wswFired(WheelTimer& t, uint32_t now) {
+  if (wswState == 1) {
+    wswStep(1);
+    wswState = 2;
+    timerArm(t, now + 50 + rngBelow(RNG_HID, 70));
+  } else if (wswState == 2) {
+    wswStep(2);  // modifier still held
+    wswState = 3;
+    timerArm(t, now + 20 + rngBelow(RNG_HID, 30));
+  } else {
+    wswStep(3);
+    wswState = 0;
   }
 }
 
@@ -316,21 +384,25 @@ void sendWindowSwitch() {
 void sendConsumerPress(uint16_t usageCode) {
   if (useUsb()) {
     UsbConsumer.press(usageCode);
+    hidTraceConsumer(HID_TRACE_USB, usageCode);
   }
   if (useBle() && pConsumerInput) {
     pConsumerInput->setValue((uint8_t*)&usageCode, sizeof(usageCode));
     pConsumerInput->notify();
+    hidTraceConsumer(HID_TRACE_BLE, usageCode);
   }
 }
 
 void sendConsumerRelease() {
   if (useUsb()) {
     UsbConsumer.release();
+    hidTraceConsumer(HID_TRACE_USB, 0);
   }
   if (useBle() && pConsumerInput) {
     uint16_t zero = 0;
     pConsumerInput->setValue((uint8_t*)&zero, sizeof(zero));
     pConsumerInput->notify();
+    hidTraceConsumer(HID_TRACE_BLE, 0);
   }
 }
 
@@ -353,7 +425,7 @@ uint8_t pickNextClick() {
       populated[count++] = i;
   }
   if (count == 0) return NUM_CLICK_TYPES - 1;
-  return settings.clickSlots[populated[random(count)]];
+  return settings.clickSlots[populated[rngBelow(RNG_KEYS, count)]];
 }
 
 void executeClick(uint8_t actionIdx, uint16_t holdMs) {
@@ -366,10 +438,58 @@ void executeClick(uint8_t actionIdx, uint16_t holdMs) {
 }
 
 // ============================================================================
-// Activity LED tick (HAL function called from common code)
+// HID emitter task (hid_emit.h) — an esp_timer one-shot armed for the next
+// deadline notifies the task, which runs hidEmitService() under
+// hidEmitMutex. It sits above loopTask's priority, so mouse reports keep
+// their times through LVGL / SPI display flushes and delay().
 // ============================================================================
 
-void tickActivityLeds() {
-  // On S3, NeoPixel LED ticking is handled by tickLed() in main.cpp loop.
-  // This HAL function exists for common code compatibility.
+#define HID_EMIT_STACK_BYTES  4096
+#define HID_EMIT_TASK_PRIO    (tskIDLE_PRIORITY + 3)  // loopTask runs at 1
+
+static SemaphoreHandle_t hidEmitMutex = NULL;
+static TaskHandle_t hidEmitTask = NULL;
+static esp_timer_handle_t hidEmitTimer = NULL;
+
+void hidEmitLock() {
+  if (hidEmitMutex) xSemaphoreTake(hidEmitMutex, portMAX_DELAY);
+}
+
+void hidEmitUnlock() {
+  if (hidEmitMutex) xSemaphoreGive(hidEmitMutex);
+}
+
+void hidEmitKick() {
+  if (hidEmitTask) xTaskNotifyGive(hidEmitTask);
+}
+
+static void hidEmitTimerFired(void*) {
+  xTaskNotifyGive(hidEmitTask);
+}
+
+static void hidEmitLoop(void*) {
+  for (;;) {
+    unsigned long due;
+    hidEmitLock();
+    bool pending = hidEmitService(millis(), due);
+    hidEmitUnlock();
+
+    esp_timer_stop(hidEmitTimer);  // harmless when not running
+    if (pending) {
+      long ms = (long)(due - millis());
+      if (ms <= 0) continue;       // came due while servicing
+      esp_timer_start_once(hidEmitTimer, (uint64_t)ms * 1000);
+    }
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+  }
+}
+
+void startHidEmitter() {
+  timersInit(millis());
+  hidEmitMutex = xSemaphoreCreateMutex();
+  esp_timer_create_args_t args = {};
+  args.callback = hidEmitTimerFired;
+  args.name = "hidemit";
+  esp_timer_create(&args, &hidEmitTimer);
+  xTaskCreate(hidEmitLoop, "hidemit", HID_EMIT_STACK_BYTES, NULL, HID_EMIT_TASK_PRIO, &hidEmitTask);
 }
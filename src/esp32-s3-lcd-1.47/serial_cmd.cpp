@@ -9,6 +9,8 @@
 #include "sim_data.h"
 #include "orchestrator.h"
 #include "platform_hal.h"
+#include "perf.h"
+#include "hid_trace.h"
 
 // ============================================================================
 // Screenshot — captures LVGL screen as BMP, base64-encoded over serial
@@ -185,6 +187,12 @@ void handleSerialCommands() {
         Serial.println("s - Status");
         Serial.println("d - Dump settings");
         Serial.println("t - Toggle status push");
+#if GHOST_PERF
+        Serial.println("l - Loop stage profile");
+#endif
+#if HID_TRACE_RECORDS > 0
+        Serial.println("i - HID report trace (base64)");
+#endif
         Serial.println("r - Reboot");
         Serial.println("p - Screenshot (base64 BMP)");
         Serial.println("e - Easter egg (test)");
@@ -223,6 +231,16 @@ void handleSerialCommands() {
         }
         Serial.print("Activity LEDs: "); Serial.println(settings.activityLeds ? "On" : "Off");
         break;
+#if GHOST_PERF
+      case 'l':
+        perfPrint();
+        break;
+#endif
+#if HID_TRACE_RECORDS > 0
+      case 'i':
+        hidTraceDump(serialWrite);
+        break;
+#endif
       case 't':
         serialStatusPush = !serialStatusPush;
         Serial.print("Status push: ");
@@ -35,3 +35,32 @@ void enterDeepSleep() {
   // On S3 with no battery, deep sleep = light sleep
   enterLightSleep(true);
 }
+
+// ============================================================================
+// Loop idling — loop() waits on a task notification whose timeout is its
+// next deadline; BLE callbacks (NimBLE host task) and USB serial RX give it
+// early. USB state is polled at least every LOOP_IDLE_MAX_MS.
+// ============================================================================
+
+static TaskHandle_t loopTask = NULL;
+
+// USBCDC RX event (USB event task) — handleSerialCommands() reads it
+static void serialRxEvent(void* arg, esp_event_base_t base, int32_t id, void* data) {
+  wakeLoop();
+}
+
+void startLoopWake() {
+  loopTask = xTaskGetCurrentTaskHandle();
+  Serial.onEvent(ARDUINO_USB_CDC_RX_EVENT, serialRxEvent);
+}
+
+void wakeLoop() {
+  if (loopTask) xTaskNotifyGive(loopTask);
+}
+
+void idleLoopUntil(unsigned long dueMs) {
+  long ms = (long)(dueMs - millis());
+  TickType_t wait = ms > 0 ? pdMS_TO_TICKS(ms) : 0;
+  if (wait == 0) wait = 1;  // overdue: still yield, as delay(1) did
+  ulTaskNotifyTake(pdTRUE, wait);
+}
@@ -26,6 +26,8 @@ int lastEncoderPos = 0;
 
 // Connection & enables
 volatile bool deviceConnected = false;
+volatile uint16_t bleConnIntervalMs = BLE_INTERVAL_MS(BLE_INTERVAL_ACTIVE);
+volatile uint8_t bleScrollUnits = 1;
 bool usbConnected = false;
 bool usbHostConnected = false;  // S3-specific: USB host has enumerated us
 bool keyEnabled = true;
@@ -117,10 +119,6 @@ int batteryPercent = 100;
 float batteryVoltage = 5.0;
 bool batteryCharging = false;
 
-// LED timing
-unsigned long ledKbOnMs = 0;
-unsigned long ledMouseOnMs = 0;
-
 // Serial status push (off by default)
 bool serialStatusPush = false;
 
@@ -174,8 +172,6 @@ OrchestratorState orch = {};
 
 // Deferred settings save
 bool settingsDirty = false;
-unsigned long settingsDirtyMs = 0;
 
 // Lifetime stats periodic save
 bool statsDirty = false;
-unsigned long lastStatsSave = 0;
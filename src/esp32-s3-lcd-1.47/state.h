@@ -12,5 +12,7 @@
 extern bool usbHostConnected;  // true when USB host has enumerated us
 
 // (NimBLE objects are file-scoped in ble.cpp, not global externs)
+extern volatile uint16_t bleConnIntervalMs;  // negotiated BLE connection interval (ms)
+extern volatile uint8_t bleScrollUnits;      // wheel units per detent the BLE host enabled (hid_hires.h)
 
 #endif // GHOST_S3_STATE_H
@@ -0,0 +1,119 @@
+#ifndef GHOST_NATIVE_ARDUINO_H
+#define GHOST_NATIVE_ARDUINO_H
+
+// ============================================================================
+// Minimal Arduino API shim for host builds (env:sim)
+//
+// Provides just enough of the Arduino core for src/common/ to compile and run
+// on a desktop toolchain. Time comes from a virtual clock (see host_hal.h) so
+// a full simulated workday runs in well under a second of wall time; delay()
+// advances that clock instead of sleeping.
+// ============================================================================
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <type_traits>
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+// Arduino cores define min/max as type-generic helpers
+template <typename T, typename U>
+static inline typename std::common_type<T, U>::type min(T a, U b) { return a < b ? a : b; }
+template <typename T, typename U>
+static inline typename std::common_type<T, U>::type max(T a, U b) { return a > b ? a : b; }
+
+// AVR-style flash access — plain memory on host
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define memcpy_P memcpy
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+static inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+// Time (virtual clock)
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Random (deterministic for a given randomSeed())
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// GPIO — no pins on host; writes are dropped, reads idle high (pull-ups)
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+static inline void pinMode(uint8_t, uint8_t) {}
+static inline void digitalWrite(uint8_t, uint8_t) {}
+static inline int digitalRead(uint8_t) { return HIGH; }
+
+// ============================================================================
+// Serial — output goes to an attachable FILE* (NULL = discard), input comes
+// from a host-injected buffer
+// ============================================================================
+
+#define HOST_SERIAL_RX_SIZE 1024
+
+class HostSerial {
+public:
+  void begin(unsigned long baud) { (void)baud; }
+  explicit operator bool() const { return true; }
+
+  size_t write(uint8_t c);
+  size_t write(const uint8_t* buf, size_t len);
+
+  size_t print(const char* s);
+  size_t print(char c);
+  size_t print(unsigned char n, int base = DEC);
+  size_t print(int n, int base = DEC);
+  size_t print(unsigned int n, int base = DEC);
+  size_t print(long n, int base = DEC);
+  size_t print(unsigned long n, int base = DEC);
+  size_t print(double n, int digits = 2);
+
+  size_t println();
+  template <typename T>
+  size_t println(T v) { size_t n = print(v); return n + println(); }
+  template <typename T>
+  size_t println(T v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+
+  int available();
+  int read();
+  int peek();
+  void flush();
+
+  // Host-side hooks
+  void attachOutput(FILE* f) { out = f; }
+  size_t injectInput(const char* data, size_t len);
+
+private:
+  size_t printNumber(unsigned long n, int base, bool negative);
+
+  FILE* out = NULL;
+  char rxBuf[HOST_SERIAL_RX_SIZE];
+  size_t rxHead = 0;
+  size_t rxTail = 0;
+};
+
+extern HostSerial Serial;
+
+#endif // GHOST_NATIVE_ARDUINO_H
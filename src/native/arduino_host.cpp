@@ -0,0 +1,134 @@
+#include <Arduino.h>
+#include "host_hal.h"
+
+// ============================================================================
+// Arduino core shim — virtual clock, PRNG, Serial
+// ============================================================================
+
+HostSerial Serial;
+
+static uint64_t clockUs = 0;
+
+unsigned long millis() { return (unsigned long)(clockUs / 1000); }
+unsigned long micros() { return (unsigned long)clockUs; }
+void delay(unsigned long ms) { clockUs += (uint64_t)ms * 1000; }
+void delayMicroseconds(unsigned int us) { clockUs += us; }
+
+void hostClockSet(unsigned long ms) { clockUs = (uint64_t)ms * 1000; }
+void hostClockAdvance(unsigned long ms) { clockUs += (uint64_t)ms * 1000; }
+unsigned long hostClockMs() { return millis(); }
+
+// ============================================================================
+// PRNG — xorshift32, independent of the host libc so runs are reproducible
+// across machines for a given seed
+// ============================================================================
+
+static uint32_t rngState = 1;
+
+static uint32_t nextRandom() {
+  uint32_t x = rngState;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  rngState = x;
+  return x;
+}
+
+void randomSeed(unsigned long seed) {
+  rngState = (uint32_t)seed;
+  if (rngState == 0) rngState = 1;  // xorshift state must be non-zero
+}
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  return (long)(nextRandom() % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return random(howbig - howsmall) + howsmall;
+}
+
+// ============================================================================
+// Serial
+// ============================================================================
+
+size_t HostSerial::write(uint8_t c) {
+  if (out) fputc(c, out);
+  return 1;
+}
+
+size_t HostSerial::write(const uint8_t* buf, size_t len) {
+  if (out) fwrite(buf, 1, len, out);
+  return len;
+}
+
+size_t HostSerial::print(const char* s) {
+  size_t len = strlen(s);
+  return write((const uint8_t*)s, len);
+}
+
+size_t HostSerial::print(char c) { return write((uint8_t)c); }
+
+size_t HostSerial::printNumber(unsigned long n, int base, bool negative) {
+  if (base < 2) base = 10;
+  char buf[8 * sizeof(unsigned long) + 2];
+  char* p = &buf[sizeof(buf) - 1];
+  *p = '\0';
+  do {
+    unsigned long digit = n % base;
+    n /= base;
+    *--p = (char)(digit < 10 ? '0' + digit : 'A' + digit - 10);
+  } while (n);
+  if (negative) *--p = '-';
+  return print(p);
+}
+
+size_t HostSerial::print(unsigned char n, int base) { return printNumber(n, base, false); }
+size_t HostSerial::print(unsigned int n, int base) { return printNumber(n, base, false); }
+size_t HostSerial::print(unsigned long n, int base) { return printNumber(n, base, false); }
+size_t HostSerial::print(int n, int base) { return print((long)n, base); }
+
+size_t HostSerial::print(long n, int base) {
+  if (base == 10 && n < 0) return printNumber(0UL - (unsigned long)n, 10, true);
+  return printNumber((unsigned long)n, base, false);
+}
+
+size_t HostSerial::print(double n, int digits) {
+  char buf[48];
+  snprintf(buf, sizeof(buf), "%.*f", digits, n);
+  return print(buf);
+}
+
+size_t HostSerial::println() { return print("\r\n"); }
+
+int HostSerial::available() {
+  return (int)((rxHead + HOST_SERIAL_RX_SIZE - rxTail) % HOST_SERIAL_RX_SIZE);
+}
+
+int HostSerial::read() {
+  if (rxHead == rxTail) return -1;
+  uint8_t c = (uint8_t)rxBuf[rxTail];
+  rxTail = (rxTail + 1) % HOST_SERIAL_RX_SIZE;
+  return c;
+}
+
+int HostSerial::peek() {
+  if (rxHead == rxTail) return -1;
+  return (uint8_t)rxBuf[rxTail];
+}
+
+void HostSerial::flush() {
+  if (out) fflush(out);
+}
+
+size_t HostSerial::injectInput(const char* data, size_t len) {
+  size_t n = 0;
+  while (n < len) {
+    size_t next = (rxHead + 1) % HOST_SERIAL_RX_SIZE;
+    if (next == rxTail) break;  // full — drop the rest, like a UART FIFO overrun
+    rxBuf[rxHead] = data[n++];
+    rxHead = next;
+  }
+  return n;
+}
@@ -0,0 +1,42 @@
+#if GHOST_BENCH && !defined(PIO_UNIT_TESTING)
+
+#include <Arduino.h>
+#include "state.h"
+#include "orchestrator.h"
+#include "host_hal.h"
+#include "bench.h"
+
+// ============================================================================
+// Host micro-benchmarks (env:bench)
+// Runs the bench.h case table against the real monotonic clock and prints
+// ns/op. Same cases as the firmware !bench command, minus jsonStatus
+// (ArduinoJson is not part of the host build).
+//
+//   .pio/build/bench/program [--seed N]
+// ============================================================================
+
+static void printResult(const BenchResult& r) {
+  printf("%-20s %9lu %12lu %10.1f\n", r.name, (unsigned long)r.ops,
+         (unsigned long)r.ticks, r.ops ? (double)r.ticks / r.ops : 0.0);
+}
+
+int main(int argc, char** argv) {
+  unsigned long seed = 1;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--seed") && i + 1 < argc) seed = strtoul(argv[++i], NULL, 0);
+    else {
+      printf("Usage: program [--seed N]\n");
+      return 2;
+    }
+  }
+
+  hostSetup(seed);
+  settings.operationMode = OP_SIMULATION;
+  initOrchestrator();
+
+  printf("%-20s %9s %12s %10s\n", "case", "ops", "best ns", "ns/op");
+  benchRun(printResult);
+  return 0;
+}
+
+#endif // GHOST_BENCH && !PIO_UNIT_TESTING
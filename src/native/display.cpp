@@ -0,0 +1,14 @@
+#include <Arduino.h>
+#include "state.h"
+#include "platform_hal.h"
+
+// ============================================================================
+// Display for host builds (headless)
+// ============================================================================
+
+void markDisplayDirty() {
+  displayDirty = true;
+}
+
+void invalidateDisplayShadow() {
+}
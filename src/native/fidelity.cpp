@@ -0,0 +1,327 @@
+#include <Arduino.h>
+#include <algorithm>
+#include <vector>
+#include "state.h"
+#include "orchestrator.h"
+#include "keys.h"
+#include "host_hal.h"
+#include "fidelity.h"
+
+// ============================================================================
+// Simulation fidelity report — see fidelity.h
+// ============================================================================
+
+#define PERF_LEVELS 12
+
+// Inter-key histogram: bin 0 below target, 1..10 deciles of the target
+// range, 11 above it
+#define IK_BINS 12
+
+// A floor gap counts as violated once it exceeds the floor by more than
+// the keepalive's own scheduling slack (key hold delay + loop step)
+#define FLOOR_SLACK_MS 1000UL
+
+struct ModeTally {
+  unsigned long phaseMs[PHASE_COUNT];
+  unsigned long phaseEntries[PHASE_COUNT];
+  std::vector<uint32_t> interKey[PROFILE_COUNT];
+};
+
+struct ProfileTally {
+  unsigned long ms;
+  unsigned long kbReports;
+  unsigned long mouseReports;
+  unsigned long allReports;
+};
+
+struct LevelResult {
+  ModeTally modes[WMODE_COUNT];
+  ProfileTally profiles[PROFILE_COUNT];
+  unsigned long maxKeyGapMs;
+  unsigned long floorViolations;
+  unsigned long keys;
+};
+
+// Per-run capture state, shared with the HID sink
+static LevelResult* cur = NULL;
+static uint8_t lastKb[8];
+static unsigned long lastPressMs;
+static bool releasePending;          // in-burst release waiting for its next press
+static unsigned long releaseMs;
+static WorkModeId releaseMode;
+static Profile releaseProfile;
+
+static void onReport(const HostHidReport& r) {
+  ProfileTally& p = cur->profiles[orch.autoProfile];
+  p.allReports++;
+
+  if (r.reportId == RID_MOUSE) {
+    p.mouseReports++;
+    return;
+  }
+  if (r.reportId != RID_KEYBOARD) return;
+  p.kbReports++;
+
+  // Press: a modifier or key slot going from clear to set
+  bool press = (r.data[0] & ~lastKb[0]) != 0;
+  bool anyDown = r.data[0] != 0;
+  for (uint8_t i = 2; i < 8; i++) {
+    if (r.data[i] && !lastKb[i]) press = true;
+    if (r.data[i]) anyDown = true;
+  }
+  memcpy(lastKb, r.data, sizeof(lastKb));
+
+  if (press) {
+    cur->keys++;
+    if (lastPressMs) {
+      unsigned long gap = r.ms - lastPressMs;
+      if (gap > cur->maxKeyGapMs) cur->maxKeyGapMs = gap;
+      if (gap > ACTIVITY_FLOOR_GAP_MS + FLOOR_SLACK_MS) cur->floorViolations++;
+    }
+    lastPressMs = r.ms;
+
+    if (releasePending && orch.phase == PHASE_TYPING &&
+        orch.modeId == releaseMode && orch.autoProfile == releaseProfile) {
+      cur->modes[releaseMode].interKey[releaseProfile].push_back((uint32_t)(r.ms - releaseMs));
+    }
+    releasePending = false;
+  } else if (!anyDown && orch.phase == PHASE_TYPING) {
+    // Burst-ending releases are dropped after the tick (inBurstGap set)
+    releasePending = true;
+    releaseMs = r.ms;
+    releaseMode = orch.modeId;
+    releaseProfile = orch.autoProfile;
+  }
+}
+
+static void runLevel(const FidelityRun& run, uint8_t perf, LevelResult& res) {
+  cur = &res;
+  memset(lastKb, 0, sizeof(lastKb));
+  lastPressMs = 0;
+  releasePending = false;
+
+  hostSetHidSink(onReport);
+  hostSetup(run.seed);
+  settings.operationMode = OP_SIMULATION;
+  if (run.configure) run.configure();
+  settings.jobPerformance = perf;
+
+  unsigned long dayMinutes = settings.shiftDuration;
+  if (settings.shiftDuration >= LUNCH_NO_LUNCH_THRESHOLD) dayMinutes += settings.lunchDuration;
+  unsigned long start = hostClockMs();
+  unsigned long end = start + dayMinutes * 60000UL;
+
+  initOrchestrator();
+  unsigned long lastPhaseStart = orch.phaseStartMs;
+  res.modes[orch.modeId].phaseEntries[orch.phase]++;
+
+  for (unsigned long now = start; now < end; now = hostClockMs() + run.stepMs) {
+    hostClockSet(now);
+    WorkModeId mode = orch.modeId;
+    ActivityPhase phase = orch.phase;
+    Profile profile = orch.autoProfile;
+
+    hostLoop();
+
+    // delay() inside the tick may have moved the clock past now
+    unsigned long elapsed = hostClockMs() - now + run.stepMs;
+    res.modes[mode].phaseMs[phase] += elapsed;
+    res.profiles[profile].ms += elapsed;
+
+    if (orch.inBurstGap) releasePending = false;
+    if (orch.phaseStartMs != lastPhaseStart) {
+      lastPhaseStart = orch.phaseStartMs;
+      res.modes[orch.modeId].phaseEntries[orch.phase]++;
+    }
+  }
+
+  hostSetHidSink(NULL);
+  cur = NULL;
+}
+
+// ----------------------------------------------------------------------------
+// Derived metrics
+// ----------------------------------------------------------------------------
+
+struct InterKeyStats {
+  unsigned long lo, hi;     // scaled target range
+  size_t n;
+  uint32_t p50, p95;
+  double inRangePct;
+  unsigned long hist[IK_BINS];
+};
+
+static void interKeyStats(uint8_t mode, uint8_t profile, std::vector<uint32_t>& v,
+                          unsigned long stepMs, InterKeyStats& s) {
+  const PhaseTiming& t = workModes[mode].timing[profile];
+  s.lo = scaleByPerformance(t.interKeyMinMs, false);
+  s.hi = scaleByPerformance(t.interKeyMaxMs, false);
+  s.n = v.size();
+  memset(s.hist, 0, sizeof(s.hist));
+  if (v.empty()) {
+    s.p50 = s.p95 = 0;
+    s.inRangePct = 0;
+    return;
+  }
+
+  std::sort(v.begin(), v.end());
+  s.p50 = v[(v.size() - 1) / 2];
+  s.p95 = v[(v.size() - 1) * 95 / 100];
+
+  // Observed intervals land up to one loop step after the scheduled time
+  size_t inRange = 0;
+  for (uint32_t x : v) {
+    uint8_t bin;
+    if (x < s.lo) bin = 0;
+    else if (x > s.hi + stepMs) bin = IK_BINS - 1;
+    else {
+      inRange++;
+      unsigned long span = s.hi > s.lo ? s.hi - s.lo + 1 : 1;
+      unsigned long off = min((unsigned long)x - s.lo, span - 1);
+      bin = (uint8_t)(1 + off * 10 / span);
+    }
+    s.hist[bin]++;
+  }
+  s.inRangePct = 100.0 * inRange / v.size();
+}
+
+// Typing share of typing+mousing, by phase picks and by time
+static double kbPickPct(const ModeTally& m) {
+  unsigned long total = m.phaseEntries[PHASE_TYPING] + m.phaseEntries[PHASE_MOUSING];
+  return total ? 100.0 * m.phaseEntries[PHASE_TYPING] / total : 0;
+}
+
+static double kbTimePct(const ModeTally& m) {
+  unsigned long total = m.phaseMs[PHASE_TYPING] + m.phaseMs[PHASE_MOUSING];
+  return total ? 100.0 * m.phaseMs[PHASE_TYPING] / total : 0;
+}
+
+static unsigned long modeMs(const ModeTally& m) {
+  unsigned long ms = 0;
+  for (uint8_t p = 0; p < PHASE_COUNT; p++) ms += m.phaseMs[p];
+  return ms;
+}
+
+static double perMin(unsigned long count, unsigned long ms) {
+  return ms ? count * 60000.0 / ms : 0;
+}
+
+// ----------------------------------------------------------------------------
+// Output — CSV is one tidy table (filter/pivot on perf + metric); JSON nests
+// the same values per level
+// ----------------------------------------------------------------------------
+
+static void writeCsvLevel(FILE* out, uint8_t perf, LevelResult& res, unsigned long stepMs) {
+  for (uint8_t m = 0; m < WMODE_COUNT; m++) {
+    ModeTally& t = res.modes[m];
+    unsigned long ms = modeMs(t);
+    if (ms == 0) continue;
+    const char* name = workModes[m].name;
+    uint8_t kb = workModes[m].kbPercent;
+    fprintf(out, "%u,mode_minutes,%s,,,%.2f,,\n", perf, name, ms / 60000.0);
+    fprintf(out, "%u,kb_pick_pct,%s,,,%.1f,%u,%u\n", perf, name, kbPickPct(t), kb, kb);
+    fprintf(out, "%u,kb_time_pct,%s,,,%.1f,%u,%u\n", perf, name, kbTimePct(t), kb, kb);
+
+    for (uint8_t p = 0; p < PROFILE_COUNT; p++) {
+      if (t.interKey[p].empty()) continue;
+      InterKeyStats s;
+      interKeyStats(m, p, t.interKey[p], stepMs, s);
+      const char* prof = PROFILE_NAMES[p];
+      fprintf(out, "%u,interkey_n,%s,%s,,%zu,%lu,%lu\n", perf, name, prof, s.n, s.lo, s.hi);
+      fprintf(out, "%u,interkey_p50_ms,%s,%s,,%u,%lu,%lu\n", perf, name, prof, s.p50, s.lo, s.hi);
+      fprintf(out, "%u,interkey_p95_ms,%s,%s,,%u,%lu,%lu\n", perf, name, prof, s.p95, s.lo, s.hi);
+      fprintf(out, "%u,interkey_in_range_pct,%s,%s,,%.1f,%lu,%lu\n", perf, name, prof, s.inRangePct, s.lo, s.hi);
+      for (uint8_t b = 0; b < IK_BINS; b++) {
+        fprintf(out, "%u,interkey_hist,%s,%s,%u,%lu,%lu,%lu\n", perf, name, prof, b, s.hist[b], s.lo, s.hi);
+      }
+    }
+  }
+
+  for (uint8_t p = 0; p < PROFILE_COUNT; p++) {
+    const ProfileTally& t = res.profiles[p];
+    if (t.ms == 0) continue;
+    fprintf(out, "%u,profile_minutes,,%s,,%.2f,,\n", perf, PROFILE_NAMES[p], t.ms / 60000.0);
+    fprintf(out, "%u,reports_per_min,,%s,kb,%.1f,,\n", perf, PROFILE_NAMES[p], perMin(t.kbReports, t.ms));
+    fprintf(out, "%u,reports_per_min,,%s,mouse,%.1f,,\n", perf, PROFILE_NAMES[p], perMin(t.mouseReports, t.ms));
+    fprintf(out, "%u,reports_per_min,,%s,all,%.1f,,\n", perf, PROFILE_NAMES[p], perMin(t.allReports, t.ms));
+  }
+
+  fprintf(out, "%u,keys,,,,%lu,,\n", perf, res.keys);
+  fprintf(out, "%u,max_key_gap_ms,,,,%lu,,%lu\n", perf, res.maxKeyGapMs, ACTIVITY_FLOOR_GAP_MS);
+  fprintf(out, "%u,floor_violations,,,,%lu,,%lu\n", perf, res.floorViolations, ACTIVITY_FLOOR_GAP_MS);
+}
+
+static void writeJsonLevel(FILE* out, uint8_t perf, LevelResult& res, unsigned long stepMs) {
+  fprintf(out, "{\"perf\":%u,\"keys\":%lu,\"maxKeyGapMs\":%lu,\"floorViolations\":%lu,\"modes\":[",
+          perf, res.keys, res.maxKeyGapMs, res.floorViolations);
+  bool firstMode = true;
+  for (uint8_t m = 0; m < WMODE_COUNT; m++) {
+    ModeTally& t = res.modes[m];
+    unsigned long ms = modeMs(t);
+    if (ms == 0) continue;
+    fprintf(out, "%s\n  {\"mode\":\"%s\",\"minutes\":%.2f,\"kbPercent\":%u,\"kbPickPct\":%.1f,"
+            "\"kbTimePct\":%.1f,\"interKey\":[", firstMode ? "" : ",", workModes[m].name,
+            ms / 60000.0, workModes[m].kbPercent, kbPickPct(t), kbTimePct(t));
+    firstMode = false;
+
+    bool firstProf = true;
+    for (uint8_t p = 0; p < PROFILE_COUNT; p++) {
+      if (t.interKey[p].empty()) continue;
+      InterKeyStats s;
+      interKeyStats(m, p, t.interKey[p], stepMs, s);
+      fprintf(out, "%s{\"profile\":\"%s\",\"targetMs\":[%lu,%lu],\"n\":%zu,\"p50\":%u,\"p95\":%u,"
+              "\"inRangePct\":%.1f,\"hist\":[", firstProf ? "" : ",", PROFILE_NAMES[p],
+              s.lo, s.hi, s.n, s.p50, s.p95, s.inRangePct);
+      for (uint8_t b = 0; b < IK_BINS; b++) fprintf(out, "%s%lu", b ? "," : "", s.hist[b]);
+      fprintf(out, "]}");
+      firstProf = false;
+    }
+    fprintf(out, "]}");
+  }
+
+  fprintf(out, "],\n \"profiles\":[");
+  bool firstProf = true;
+  for (uint8_t p = 0; p < PROFILE_COUNT; p++) {
+    const ProfileTally& t = res.profiles[p];
+    if (t.ms == 0) continue;
+    fprintf(out, "%s{\"profile\":\"%s\",\"minutes\":%.2f,\"kbPerMin\":%.1f,\"mousePerMin\":%.1f,"
+            "\"allPerMin\":%.1f}", firstProf ? "" : ",", PROFILE_NAMES[p], t.ms / 60000.0,
+            perMin(t.kbReports, t.ms), perMin(t.mouseReports, t.ms), perMin(t.allReports, t.ms));
+    firstProf = false;
+  }
+  fprintf(out, "]}");
+}
+
+int runFidelityReport(const FidelityRun& run, bool json, FILE* out) {
+  uint8_t first = run.perf >= 0 ? (uint8_t)run.perf : 0;
+  uint8_t last = run.perf >= 0 ? (uint8_t)run.perf : PERF_LEVELS - 1;
+
+  // Header values come from the configured settings of a throwaway setup
+  hostSetup(run.seed);
+  if (run.configure) run.configure();
+  const DayTemplate& tmpl = DAY_TEMPLATES[settings.jobSimulation];
+
+  if (json) {
+    fprintf(out, "{\"job\":\"%s\",\"shiftMin\":%u,\"lunchMin\":%u,\"seed\":%lu,\"stepMs\":%lu,"
+            "\"floorGapMs\":%lu,\"levels\":[\n", tmpl.name, settings.shiftDuration,
+            settings.lunchDuration, run.seed, run.stepMs, ACTIVITY_FLOOR_GAP_MS);
+  } else {
+    fprintf(out, "perf,metric,mode,profile,bin,value,target_lo,target_hi\n");
+  }
+
+  for (uint8_t perf = first; perf <= last; perf++) {
+    LevelResult* res = new LevelResult();
+    runLevel(run, perf, *res);
+    if (json) {
+      if (perf != first) fprintf(out, ",\n");
+      writeJsonLevel(out, perf, *res, run.stepMs);
+    } else {
+      writeCsvLevel(out, perf, *res, run.stepMs);
+    }
+    delete res;
+    fflush(out);
+  }
+
+  if (json) fprintf(out, "\n]}\n");
+  return 0;
+}
@@ -0,0 +1,27 @@
+#ifndef GHOST_NATIVE_FIDELITY_H
+#define GHOST_NATIVE_FIDELITY_H
+
+#include <stdio.h>
+
+// ============================================================================
+// Simulation fidelity report (env:sim --fidelity csv|json)
+// Runs one simulated day per jobPerformance level and compares what the
+// orchestrator actually sent with what the templates ask for:
+//   - typing vs mousing share per work mode        vs kbPercent
+//   - in-burst inter-key intervals per mode/profile vs interKeyMin/MaxMs
+//     (scaled by performance, as the orchestrator applies them)
+//   - longest keystroke gap                        vs ACTIVITY_FLOOR_GAP_MS
+//   - keyboard / mouse reports per minute per profile
+// ============================================================================
+
+struct FidelityRun {
+  long perf;                   // single level, or -1 for all 0..11
+  unsigned long seed;
+  unsigned long stepMs;
+  void (*configure)();         // applies job/shift/lunch after hostSetup()
+};
+
+// Write the report to out. Returns 0 on success.
+int runFidelityReport(const FidelityRun& run, bool json, FILE* out);
+
+#endif // GHOST_NATIVE_FIDELITY_H
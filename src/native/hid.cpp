@@ -0,0 +1,321 @@
+#include <Arduino.h>
+#include "config.h"
+#include "state.h"
+#include "keys.h"
+#include "settings.h"
+#include "sim_data.h"
+#include "platform_hal.h"
+#include "rng.h"
+#include "hid_trace.h"
+#include "host_hal.h"
+#include "timers.h"
+
+// ============================================================================
+// HID for host builds — reports go to the registered HostHidSink
+// Mirrors nrf52/hid.cpp: non-blocking key/click/window-switch releases are
+// timers (timers.h) run by the HID emitter (hid_emit.h), so report timing
+// matches the primary target.
+// ============================================================================
+
+#define KEYBOARD_MODIFIER_LEFTALT    0x04
+#define KEYBOARD_MODIFIER_LEFTGUI    0x08
+
+static HostHidSink hidSink = NULL;
+static uint16_t hidIntervalMs = BLE_INTERVAL_MS(BLE_INTERVAL_ACTIVE);
+static uint8_t hidScrollUnitsValue = 1;
+
+static void keyReleaseFired(WheelTimer& t, uint32_t now);
+static void clickReleaseFired(WheelTimer& t, uint32_t now);
+static void wswFired(WheelTimer& t, uint32_t now);
+
+// Non-blocking key press/release scheduler (Simple mode keystrokes, burst and
+// keepalive taps); sendKeyDown() holds until sendKeyUp()
+static bool keyHeld = false;  // a key report is down
+static WheelTimer keyReleaseTimer = TW_TIMER(keyReleaseFired);  // armed by a tap
+
+// Non-blocking mouse click release (armed while a click is pending)
+static WheelTimer clickReleaseTimer = TW_TIMER(clickReleaseFired);
+
+// Non-blocking window switch: 0=idle, 1=mod down, 2=tab down, 3=tab up
+static uint8_t wswState = 0;
+static uint8_t wswModifier = 0;
+static WheelTimer wswTimer = TW_TIMER(wswFired);
+
+void hostSetHidSink(HostHidSink sink) {
+  hidSink = sink;
+}
+
+void hostSetHidIntervalMs(uint16_t ms) {
+  hidIntervalMs = ms;
+}
+
+void hostSetHidScrollUnits(uint8_t units) {
+  hidScrollUnitsValue = units;
+}
+
+void hostResetHid() {
+  hidIntervalMs = BLE_INTERVAL_MS(BLE_INTERVAL_ACTIVE);
+  hidScrollUnitsValue = 1;
+  keyHeld = false;
+  wswState = 0;
+  timersInit(millis());  // drops armed timers; their links are stale now
+  tw_timer_init(keyReleaseTimer, keyReleaseFired);
+  tw_timer_init(clickReleaseTimer, clickReleaseFired);
+  tw_timer_init(wswTimer, wswFired);
+  hidTraceReset();
+}
+
+static void emitReport(uint8_t reportId, const uint8_t* data, uint8_t len) {
+  if (!hidSink) return;
+  HostHidReport r;
+  r.ms = millis();
+  r.reportId = reportId;
+  r.len = len;
+  memset(r.data, 0, sizeof(r.data));
+  memcpy(r.data, data, len);
+  hidSink(r);
+}
+
+// Host has no real transports — trace the ones the firmware would have used
+static uint8_t traceFlags() {
+  return (uint8_t)((deviceConnected ? HID_TRACE_BLE : 0) | (usbConnected ? HID_TRACE_USB : 0));
+}
+
+static void sendKeyboardReport(uint8_t modifier, const uint8_t keycodes[6]) {
+  if (!deviceConnected && !usbConnected) return;
+  hidTraceKeyboard(traceFlags(), modifier, keycodes);
+  uint8_t report[8];
+  report[0] = modifier;
+  report[1] = 0;  // reserved
+  memcpy(&report[2], keycodes, 6);
+  emitReport(RID_KEYBOARD, report, sizeof(report));
+}
+
+static void sendMouseReport(uint8_t buttons, int8_t dx, int8_t dy, int8_t scroll) {
+  if (!deviceConnected && !usbConnected) return;
+  hidTraceMouse(traceFlags(), buttons, dx, dy, scroll);
+  uint8_t report[4];
+  report[0] = buttons;
+  report[1] = (uint8_t)dx;
+  report[2] = (uint8_t)dy;
+  report[3] = (uint8_t)scroll;
+  emitReport(RID_MOUSE, report, sizeof(report));
+}
+
+// ============================================================================
+// Mouse
+// ============================================================================
+
+void sendMouseMoveScroll(int8_t dx, int8_t dy, int8_t wheel) {
+  uint32_t delta = (uint32_t)(abs(dx) + abs(dy));
+  if (stats.totalMousePixels <= UINT32_MAX - delta)
+    stats.totalMousePixels += delta;
+  statsDirty = true;
+
+  sendMouseReport(0, dx, dy, wheel);
+}
+
+void sendMouseMove(int8_t dx, int8_t dy) {
+  sendMouseMoveScroll(dx, dy, 0);
+}
+
+uint16_t hidReportIntervalMs() {
+  return hidIntervalMs;
+}
+
+uint8_t hidScrollUnits() {
+  return hidScrollUnitsValue;
+}
+
+void sendMouseScroll(int8_t scroll) {
+  stats.totalMouseClicks++;
+  statsDirty = true;
+
+  sendMouseReport(0, 0, 0, (int8_t)(scroll * hidScrollUnitsValue));
+}
+
+void sendMouseClick(uint8_t button, uint16_t holdMs) {
+  if (tw_armed(clickReleaseTimer)) return;  // click already pending
+  stats.totalMouseClicks++;
+  statsDirty = true;
+
+  sendMouseReport(button, 0, 0, 0);
+  timerArm(clickReleaseTimer, millis() + holdMs);
+}
+
+static void clickReleaseFired(WheelTimer& t, uint32_t now) {
+  sendMouseReport(0, 0, 0, 0);
+}
+
+// ============================================================================
+// Key slots
+// ============================================================================
+
+bool hasPopulatedSlot() {
+  for (int i = 0; i < NUM_SLOTS; i++) {
+    if (settings.keySlots[i] >= NUM_KEYS) continue;
+    if (AVAILABLE_KEYS[settings.keySlots[i]].keycode != 0) return true;
+  }
+  return false;
+}
+
+void pickNextKey() {
+  uint8_t populated[NUM_SLOTS];
+  uint8_t count = 0;
+  for (int i = 0; i < NUM_SLOTS; i++) {
+    if (settings.keySlots[i] >= NUM_KEYS) continue;
+    if (AVAILABLE_KEYS[settings.keySlots[i]].keycode != 0)
+      populated[count++] = i;
+  }
+  if (count == 0) { nextKeyIndex = NUM_KEYS - 1; return; }
+  nextKeyIndex = settings.keySlots[populated[rngBelow(RNG_KEYS, count)]];
+}
+
+// Simple mode keystroke — a tap on the next key
+void sendKeystroke() {
+  if (nextKeyIndex >= NUM_KEYS) return;
+  const KeyDef& key = AVAILABLE_KEYS[nextKeyIndex];
+  if (key.keycode == 0) return;
+
+  sendKeyTap(nextKeyIndex, key.isModifier ? 30 : 50);
+  pickNextKey();
+  markDisplayDirty();
+}
+
+// Press keyIndex and leave it down; false if nothing was sent
+static bool pressKey(uint8_t keyIndex) {
+  if (keyIndex >= NUM_KEYS) return false;
+  const KeyDef& key = AVAILABLE_KEYS[keyIndex];
+  if (key.keycode == 0) return false;
+  if (keyHeld) sendKeyUp();  // a new press ends the previous tap / hold
+  stats.totalKeystrokes++;
+  statsDirty = true;
+
+  uint8_t keycodes[6] = {0};
+  if (key.isModifier) {
+    uint8_t mod = 1 << (key.keycode - HID_KEY_CONTROL_LEFT);
+    sendKeyboardReport(mod, keycodes);
+  } else {
+    keycodes[0] = key.keycode;
+    sendKeyboardReport(0, keycodes);
+  }
+  keyHeld = true;
+  return true;
+}
+
+void sendKeyDown(uint8_t keyIndex, bool silent) {
+  (void)silent;  // no sound on host
+  if (pressKey(keyIndex)) timerCancel(keyReleaseTimer);  // held until sendKeyUp()
+}
+
+void sendKeyTap(uint8_t keyIndex, uint16_t holdMs, bool silent) {
+  (void)silent;
+  if (!pressKey(keyIndex)) return;
+  timerArm(keyReleaseTimer, millis() + holdMs);
+}
+
+void sendKeyUp() {
+  if (!keyHeld) return;
+  uint8_t keycodes[6] = {0};
+  sendKeyboardReport(0, keycodes);
+  keyHeld = false;
+  timerCancel(keyReleaseTimer);
+}
+
+static void keyReleaseFired(WheelTimer& t, uint32_t now) {
+  sendKeyUp();
+}
+
+// ============================================================================
+// Window switch (Alt-Tab / Cmd-Tab)
+// ============================================================================
+
+void sendWindowSwitch() {
+  if (!settings.windowSwitching) return;
+  if (wswState) return;  // already in progress
+
+  uint8_t keycodes[6] = {0};
+  wswModifier = (settings.switchKeys == SWITCH_KEYS_CMD_TAB)
+      ? KEYBOARD_MODIFIER_LEFTGUI : KEYBOARD_MODIFIER_LEFTALT;
+
+  sendKeyboardReport(wswModifier, keycodes);
+  wswState = 1;
+  timerArm(wswTimer, millis() + 30 + rngBelow(RNG_HID, 30));
+}
+
+// Next window-switch step, re-armed from its own due time
+static void wswFired(WheelTimer& t, uint32_t now) {
+  uint8_t keycodes[6] = {0};
+  if (wswState == 1) {
+    keycodes[0] = HID_KEY_TAB;
+    sendKeyboardReport(wswModifier, keycodes);
+    wswState = 2;
+    timerArm(t, now + 50 + rngBelow(RNG_HID, 70));
+  } else if (wswState == 2) {
+    sendKeyboardReport(wswModifier, keycodes);  // Tab up, modifier still held
+    wswState = 3;
+    timerArm(t, now + 20 + rngBelow(RNG_HID, 30));
+  } else {
+    sendKeyboardReport(0, keycodes);  // modifier up
+    wswState = 0;
+  }
+}
+
+// ============================================================================
+// Consumer control (media keys)
+// ============================================================================
+
+void sendConsumerPress(uint16_t usageCode) {
+  if (!deviceConnected && !usbConnected) return;
+  hidTraceConsumer(traceFlags(), usageCode);
+  uint8_t report[2] = { (uint8_t)(usageCode & 0xFF), (uint8_t)(usageCode >> 8) };
+  emitReport(RID_CONSUMER, report, sizeof(report));
+}
+
+void sendConsumerRelease() {
+  if (!deviceConnected && !usbConnected) return;
+  hidTraceConsumer(traceFlags(), 0);
+  uint8_t report[2] = { 0, 0 };
+  emitReport(RID_CONSUMER, report, sizeof(report));
+}
+
+// ============================================================================
+// Click slots
+// ============================================================================
+
+bool hasPopulatedClickSlot() {
+  for (int i = 0; i < NUM_CLICK_SLOTS; i++) {
+    if (settings.clickSlots[i] < NUM_CLICK_TYPES - 1) return true;
+  }
+  return false;
+}
+
+uint8_t pickNextClick() {
+  uint8_t populated[NUM_CLICK_SLOTS];
+  uint8_t count = 0;
+  for (int i = 0; i < NUM_CLICK_SLOTS; i++) {
+    if (settings.clickSlots[i] < NUM_CLICK_TYPES - 1)
+      populated[count++] = i;
+  }
+  if (count == 0) return NUM_CLICK_TYPES - 1;
+  return settings.clickSlots[populated[rngBelow(RNG_KEYS, count)]];
+}
+
+void executeClick(uint8_t actionIdx, uint16_t holdMs) {
+  if (actionIdx >= NUM_CLICK_TYPES - 1) return;
+  if (CLICK_SCROLL_DIRS[actionIdx] != 0) {
+    sendMouseScroll(CLICK_SCROLL_DIRS[actionIdx]);
+  } else {
+    sendMouseClick(CLICK_BUTTON_CODES[actionIdx], holdMs);
+  }
+}
+
+// ============================================================================
+// HID emitter — single-threaded on host: hostLoop() runs hidEmitService()
+// every simulated millisecond, so there is no timer to arm or lock to take
+// ============================================================================
+
+void startHidEmitter() {}
+void hidEmitLock() {}
+void hidEmitUnlock() {}
+void hidEmitKick() {}
@@ -0,0 +1,57 @@
+#ifndef GHOST_NATIVE_HOST_HAL_H
+#define GHOST_NATIVE_HOST_HAL_H
+
+#include <stdint.h>
+
+// ============================================================================
+// Host platform controls (env:sim)
+// Hooks the simulator drives that have no equivalent on real hardware.
+// ============================================================================
+
+// Virtual clock — millis()/micros() read it, delay() advances it
+void hostClockSet(unsigned long ms);
+void hostClockAdvance(unsigned long ms);
+unsigned long hostClockMs();
+
+// Every HID report the firmware would have sent is delivered here, stamped
+// with the virtual time. Payloads use the USB composite report layouts:
+//   RID_KEYBOARD: [modifier, reserved, key1..key6]   (8 bytes)
+//   RID_MOUSE:    [buttons, dx, dy, wheel]           (4 bytes)
+//   RID_CONSUMER: [usage lo, usage hi]               (2 bytes)
+struct HostHidReport {
+  unsigned long ms;
+  uint8_t reportId;   // USBReportId
+  uint8_t len;
+  uint8_t data[8];
+};
+
+typedef void (*HostHidSink)(const HostHidReport& report);
+void hostSetHidSink(HostHidSink sink);
+
+// Spacing of mouse move reports (hidReportIntervalMs()). Defaults to the
+// active BLE connection interval; reset by hostResetHid().
+void hostSetHidIntervalMs(uint16_t ms);
+
+// Wheel units per detent (hidScrollUnits()) — what a host that wrote the
+// Resolution Multiplier feature would have enabled. Defaults to 1 (detents);
+// reset by hostResetHid().
+void hostSetHidScrollUnits(uint8_t units);
+
+// Bring up common state the way setup() does on hardware (settings defaults,
+// stats, work modes, RNG seed, connected transport, timing baselines).
+// Also clears the runtime HID state a previous run left behind, so several
+// seeded runs can share one process (tests). Does not start the orchestrator.
+void hostSetup(unsigned long seed);
+
+// Drop pending key / click / window-switch releases and restore the default
+// report interval and scroll units (called by hostSetup)
+void hostResetHid();
+
+// One pass of the firmware main loop's HID work at the current virtual time:
+// release timers, schedule check, then orchestrator or simple-mode dispatch.
+// Returns the earliest time the loop has work again (capped at
+// LOOP_IDLE_MAX_MS ahead); nothing happens on passes before it, so a
+// driver may jump the clock straight there.
+unsigned long hostLoop();
+
+#endif // GHOST_NATIVE_HOST_HAL_H
@@ -0,0 +1,97 @@
+#include <Arduino.h>
+#include "state.h"
+#include "settings.h"
+#include "sim_data.h"
+#include "timing.h"
+#include "mouse.h"
+#include "hid_emit.h"
+#include "hid_emit_pure.h"
+#include "schedule.h"
+#include "orchestrator.h"
+#include "platform_hal.h"
+#include "rng.h"
+#include "host_hal.h"
+
+// ============================================================================
+// Host setup() / loop() equivalents
+// Same ordering as the hardware entry points, minus peripherals.
+// ============================================================================
+
+void hostSetup(unsigned long seed) {
+  // Some timers treat a 0 timestamp as idle (same as nRF52)
+  if (hostClockMs() == 0) hostClockSet(1000);
+
+  loadSettings();
+  loadStats();
+  initWorkModes();
+  randomSeed(seed);
+  rngSeed(seed);
+
+  // Runtime state a previous run in this process may have left behind
+  hostResetHid();
+  discardQueuedMouseMoves();
+  memset(&orch, 0, sizeof(orch));
+  currentProfile = PROFILE_NORMAL;
+  keyEnabled = true;
+  mouseEnabled = true;
+  mouseState = MOUSE_IDLE;
+  currentMouseDx = 0;
+  currentMouseDy = 0;
+  mouseNetX = 0;
+  mouseNetY = 0;
+  mouseJiggleCount = 0;
+  lastScrollTime = 0;
+  nextScrollInterval = 3000;
+  scheduleSleeping = false;
+  scheduleManualWake = false;
+  statsDirty = false;
+
+  // Host is always "connected" — every report reaches the sink
+  deviceConnected = true;
+  usbConnected = true;
+
+  startTime = millis();
+  lastKeyTime = startTime;
+  lastMouseStateChange = startTime;
+  lastModeActivity = startTime;
+  lastScheduleCheck = startTime;
+  scheduleNextKey();
+  scheduleNextMouseState();
+  pickNextKey();
+}
+
+unsigned long hostLoop() {
+  unsigned long now = millis();
+
+  // Emitter first, as if its timer had fired at the top of this millisecond
+  unsigned long nextDue;
+  hidEmitService(now, nextDue);
+  checkSchedule();
+
+  if (!scheduleSleeping) {
+    if (settings.operationMode == OP_SIMULATION) {
+      tickOrchestrator(now);
+    } else {
+      if (keyEnabled && hasPopulatedSlot()) {
+        if (now - lastKeyTime >= currentKeyInterval) {
+          sendKeystroke();
+          lastKeyTime = now;
+          scheduleNextKey();
+          pushSerialStatus();
+        }
+      }
+      if (mouseEnabled) {
+        handleMouseStateMachine(now);
+      }
+    }
+  }
+
+  // Next wake, as the hardware loops compute it
+  bool any = true;
+  uint32_t wake = (uint32_t)(now + LOOP_IDLE_MAX_MS);
+  unsigned long due;
+  if (hidEmitDeadline(now, due)) hid_deadline_fold(any, wake, (uint32_t)due);
+  if (scheduleCheckDeadline(due)) hid_deadline_fold(any, wake, (uint32_t)due);
+  if (!scheduleSleeping && hidPlanDeadline(now, due)) hid_deadline_fold(any, wake, (uint32_t)due);
+  return wake;
+}
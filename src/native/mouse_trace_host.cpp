@@ -0,0 +1,37 @@
+#include <Arduino.h>
+#include "config.h"
+#include "platform_hal.h"
+#include "mouse_trace_pure.h"
+
+// ============================================================================
+// Recorded mouse traces for host builds — RAM stand-in for the LittleFS
+// slot files. Contents last for the process (tests erase what they write).
+// ============================================================================
+
+static uint8_t traceData[MOUSE_TRACE_SLOTS][MOUSE_TRACE_MAX_BYTES];
+static uint32_t traceSize[MOUSE_TRACE_SLOTS];
+
+uint32_t mouseTraceSize(uint8_t slot) {
+  return slot < MOUSE_TRACE_SLOTS ? traceSize[slot] : 0;
+}
+
+uint16_t mouseTraceRead(uint8_t slot, uint32_t offset, uint8_t* buf, uint16_t len) {
+  if (slot >= MOUSE_TRACE_SLOTS || offset >= traceSize[slot]) return 0;
+  uint32_t n = traceSize[slot] - offset;
+  if (n > len) n = len;
+  memcpy(buf, traceData[slot] + offset, n);
+  return (uint16_t)n;
+}
+
+bool mouseTraceWrite(uint8_t slot, uint32_t offset, const uint8_t* data, uint16_t len) {
+  if (slot >= MOUSE_TRACE_SLOTS || offset + len > MOUSE_TRACE_MAX_BYTES) return false;
+  if (offset == 0) traceSize[slot] = 0;
+  if (offset != traceSize[slot]) return false;
+  memcpy(traceData[slot] + offset, data, len);
+  traceSize[slot] = offset + len;
+  return true;
+}
+
+void mouseTraceErase(uint8_t slot) {
+  if (slot < MOUSE_TRACE_SLOTS) traceSize[slot] = 0;
+}
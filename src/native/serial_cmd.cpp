@@ -0,0 +1,11 @@
+#include <Arduino.h>
+#include "state.h"
+#include "platform_hal.h"
+
+// ============================================================================
+// Serial status push for host builds
+// The host has no config protocol yet, so there is nothing to push.
+// ============================================================================
+
+void pushSerialStatus() {
+}
@@ -0,0 +1,40 @@
+#include <Arduino.h>
+#include "settings.h"
+#include "state.h"
+
+// ============================================================================
+// Settings persistence for host builds
+// No flash — "saving" only refreshes checksums so the structs stay
+// self-consistent; every run starts from loadDefaults().
+// ============================================================================
+
+static uint8_t calcStatsChecksum() {
+  uint8_t sum = 0;
+  uint8_t* p = (uint8_t*)&stats;
+  for (size_t i = 0; i < offsetof(Stats, checksum); i++) {
+    sum ^= p[i];
+  }
+  return sum;
+}
+
+void saveSettings() {
+  settings.checksum = calcChecksum();
+}
+
+void loadSettings() {
+  loadDefaults();
+}
+
+void saveStats() {
+  stats.magic = STATS_MAGIC;
+  stats.checksum = calcStatsChecksum();
+}
+
+void loadStats() {
+  memset(&stats, 0, sizeof(Stats));
+  stats.magic = STATS_MAGIC;
+}
+
+int getDieTempCelsius() {
+  return 0;
+}
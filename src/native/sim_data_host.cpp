@@ -0,0 +1,23 @@
+#include <Arduino.h>
+#include "sim_data.h"
+#include "state.h"
+#include "orchestrator.h"
+
+// ============================================================================
+// MUTABLE WORK MODES — init / save / reset (host builds, RAM only)
+// ============================================================================
+
+void initWorkModes() {
+  for (uint8_t i = 0; i < WMODE_COUNT; i++) {
+    workModes[i] = WORK_MODES[i];
+  }
+  rebuildSimSamplers();
+}
+
+void saveSimData() {
+  // Nothing to persist on host
+}
+
+void resetSimDataDefaults() {
+  initWorkModes();
+}
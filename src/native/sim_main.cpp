@@ -0,0 +1,220 @@
+#ifndef PIO_UNIT_TESTING
+
+#include <Arduino.h>
+#include <time.h>
+#include "state.h"
+#include "orchestrator.h"
+#include "host_hal.h"
+#include "hid_trace.h"
+#include "fidelity.h"
+
+// ============================================================================
+// Full-day simulator (env:sim)
+// Runs the orchestrator through one shiftDuration (+ lunch) workday on the
+// virtual clock and prints per-block activity totals. A complete 12h day
+// runs in well under a second of wall time.
+//
+//   .pio/build/sim/program [--job N] [--perf N] [--shift MIN] [--lunch MIN]
+//                          [--seed N] [--step MS] [--simple] [--trace] [--log]
+//                          [--hidtrace FILE] [--fidelity csv|json]
+//
+// --fidelity replaces the block table with the fidelity report (fidelity.h)
+// for every jobPerformance level, or only --perf if given.
+// By default the clock jumps to each wake time hostLoop() returns, the way
+// the firmware loop sleeps between deadlines; the loop pass count shows how
+// often it wakes. --step MS polls every MS instead (--step 0 = the default;
+// the fidelity report always polls, at --step or 1 ms).
+// ============================================================================
+
+struct BlockTally {
+  unsigned long keys;
+  unsigned long mouseReports;
+  unsigned long mousePixels;
+  unsigned long clicks;
+  unsigned long scrolls;
+  unsigned long durationMs;
+};
+
+static BlockTally tally[MAX_DAY_BLOCKS + 1];  // last slot = simple mode
+static uint8_t tallyIdx = 0;
+static unsigned long lastKeyMs = 0;
+static unsigned long maxKeyGapMs = 0;
+static uint8_t lastKbState[8] = {0};
+static uint8_t lastButtons = 0;
+static bool traceReports = false;
+static long optJob = -1, optShift = -1, optLunch = -1;
+
+static void onReport(const HostHidReport& r) {
+  BlockTally& t = tally[tallyIdx];
+
+  if (traceReports) {
+    printf("%10lu %u", r.ms, r.reportId);
+    for (uint8_t i = 0; i < r.len; i++) printf(" %02X", r.data[i]);
+    printf("\n");
+  }
+
+  if (r.reportId == RID_KEYBOARD) {
+    // Count presses: a modifier or key slot going from clear to set
+    bool press = (r.data[0] & ~lastKbState[0]) != 0;
+    for (uint8_t i = 2; i < 8; i++) {
+      if (r.data[i] && !lastKbState[i]) press = true;
+    }
+    memcpy(lastKbState, r.data, sizeof(lastKbState));
+    if (press) {
+      t.keys++;
+      if (lastKeyMs && r.ms - lastKeyMs > maxKeyGapMs) maxKeyGapMs = r.ms - lastKeyMs;
+      lastKeyMs = r.ms;
+    }
+  } else if (r.reportId == RID_MOUSE) {
+    int8_t dx = (int8_t)r.data[1];
+    int8_t dy = (int8_t)r.data[2];
+    int8_t wheel = (int8_t)r.data[3];
+    if (dx || dy) {
+      t.mouseReports++;
+      t.mousePixels += (unsigned long)(abs(dx) + abs(dy));
+    }
+    if (wheel) t.scrolls++;
+    if (r.data[0] & ~lastButtons) t.clicks++;
+    lastButtons = r.data[0];
+  }
+}
+
+// Raw HID trace dump (same bytes the device base64-encodes) for
+// tools/hid_trace_decode.cpp — holds the last HID_TRACE_RECORDS reports
+static bool writeHidTrace(const char* path) {
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  uint8_t buf[HID_TRACE_HEADER_SIZE];
+  hid_trace_put_header(buf, hidTraceCount(), hidTraceDropped());
+  fwrite(buf, 1, HID_TRACE_HEADER_SIZE, f);
+  for (uint16_t i = 0; i < hidTraceCount(); i++) {
+    hid_trace_put_record(buf, hidTraceAt(i));
+    fwrite(buf, 1, HID_TRACE_RECORD_SIZE, f);
+  }
+  fclose(f);
+  return true;
+}
+
+// Day options on top of the hostSetup() defaults
+static void applyDayOptions() {
+  if (optJob >= 0 && optJob < JOB_SIM_COUNT) settings.jobSimulation = (uint8_t)optJob;
+  if (optShift >= SHIFT_MIN_MINUTES && optShift <= SHIFT_MAX_MINUTES) settings.shiftDuration = (uint16_t)optShift;
+  if (optLunch >= LUNCH_DUR_MIN && optLunch <= LUNCH_DUR_MAX) settings.lunchDuration = (uint16_t)optLunch;
+}
+
+static void usage() {
+  printf("Usage: program [--job 0-%d] [--perf 0-11] [--shift MIN] [--lunch MIN]\n"
+         "               [--seed N] [--step MS] [--simple] [--trace] [--log]\n"
+         "               [--hidtrace FILE] [--fidelity csv|json]\n",
+         JOB_SIM_COUNT - 1);
+}
+
+int main(int argc, char** argv) {
+  long perf = -1;
+  unsigned long seed = 1;
+  unsigned long stepMs = 0;   // wake-driven
+  bool simple = false;
+  bool log = false;
+  const char* hidTracePath = NULL;
+  const char* fidelity = NULL;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+    if      (!strcmp(a, "--job")   && v) { optJob = strtol(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--perf")  && v) { perf = strtol(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--shift") && v) { optShift = strtol(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--lunch") && v) { optLunch = strtol(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--seed")  && v) { seed = strtoul(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--step")  && v) { stepMs = strtoul(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--hidtrace") && v) { hidTracePath = v; i++; }
+    else if (!strcmp(a, "--fidelity") && v) { fidelity = v; i++; }
+    else if (!strcmp(a, "--simple")) simple = true;
+    else if (!strcmp(a, "--trace"))  traceReports = true;
+    else if (!strcmp(a, "--log"))    log = true;
+    else { usage(); return 2; }
+  }
+  bool wakeDriven = (stepMs == 0);
+  if (stepMs == 0) stepMs = 1;
+
+  if (fidelity) {
+    if (strcmp(fidelity, "csv") && strcmp(fidelity, "json")) { usage(); return 2; }
+    FidelityRun run = { (perf >= 0 && perf <= 11) ? perf : -1, seed, stepMs, applyDayOptions };
+    return runFidelityReport(run, !strcmp(fidelity, "json"), stdout);
+  }
+
+  if (log) Serial.attachOutput(stdout);
+  hostSetHidSink(onReport);
+  hostSetup(seed);
+
+  settings.operationMode = simple ? OP_SIMPLE : OP_SIMULATION;
+  applyDayOptions();
+  if (perf >= 0 && perf <= 11) settings.jobPerformance = (uint8_t)perf;
+
+  unsigned long dayMinutes = settings.shiftDuration;
+  if (settings.shiftDuration >= LUNCH_NO_LUNCH_THRESHOLD) dayMinutes += settings.lunchDuration;
+  unsigned long dayMs = dayMinutes * 60000UL;
+
+  if (!simple) initOrchestrator();
+
+  clock_t wallStart = clock();
+  unsigned long start = hostClockMs();
+  unsigned long end = start + dayMs;
+  unsigned long blockEnter = start;
+
+  unsigned long passes = 0;
+  for (unsigned long now = start; now < end; ) {
+    hostClockSet(now);
+    tallyIdx = simple ? MAX_DAY_BLOCKS : orch.blockIdx;
+    unsigned long wake = hostLoop();
+    passes++;
+    if (!simple && orch.blockIdx != tallyIdx) {
+      // delay() inside the tick may have moved the clock past now
+      tally[tallyIdx].durationMs += hostClockMs() - blockEnter;
+      blockEnter = hostClockMs();
+    }
+    now = hostClockMs() + stepMs;
+    if (wakeDriven && (long)(wake - now) > 0) now = wake;
+  }
+  tally[simple ? MAX_DAY_BLOCKS : orch.blockIdx].durationMs += hostClockMs() - blockEnter;
+  double wallSec = (double)(clock() - wallStart) / CLOCKS_PER_SEC;
+
+  // ---- Report ----
+  const DayTemplate& tmpl = DAY_TEMPLATES[settings.jobSimulation];
+  char stepText[24];
+  if (wakeDriven) snprintf(stepText, sizeof(stepText), "wake");
+  else            snprintf(stepText, sizeof(stepText), "%lu ms", stepMs);
+  printf("%s day, performance %u, shift %u min, lunch %u min, seed %lu, step %s\n",
+         simple ? "Simple" : tmpl.name, settings.jobPerformance,
+         settings.shiftDuration, settings.lunchDuration, seed, stepText);
+  printf("%-16s %8s %7s %8s %9s %7s %7s\n",
+         "block", "minutes", "keys", "mouse", "pixels", "clicks", "scroll");
+
+  BlockTally total = {};
+  for (uint8_t i = 0; i <= MAX_DAY_BLOCKS; i++) {
+    const BlockTally& t = tally[i];
+    if (t.durationMs == 0 && t.keys == 0 && t.mouseReports == 0) continue;
+    const char* name = (i == MAX_DAY_BLOCKS) ? "Simple" : tmpl.blocks[i].name;
+    printf("%-16s %8.1f %7lu %8lu %9lu %7lu %7lu\n", name, t.durationMs / 60000.0,
+           t.keys, t.mouseReports, t.mousePixels, t.clicks, t.scrolls);
+    total.durationMs += t.durationMs;
+    total.keys += t.keys;
+    total.mouseReports += t.mouseReports;
+    total.mousePixels += t.mousePixels;
+    total.clicks += t.clicks;
+    total.scrolls += t.scrolls;
+  }
+  printf("%-16s %8.1f %7lu %8lu %9lu %7lu %7lu\n", "TOTAL", total.durationMs / 60000.0,
+         total.keys, total.mouseReports, total.mousePixels, total.clicks, total.scrolls);
+  printf("Longest keystroke gap: %.1f s\n", maxKeyGapMs / 1000.0);
+  printf("Loop passes: %lu (%.1f/s)\n", passes, passes * 1000.0 / dayMs);
+  printf("Simulated %.2f h in %.3f s wall time\n", dayMs / 3600000.0, wallSec);
+
+  if (hidTracePath && !writeHidTrace(hidTracePath)) {
+    fprintf(stderr, "Cannot write %s\n", hidTracePath);
+    return 1;
+  }
+  return 0;
+}
+
+#endif // PIO_UNIT_TESTING
@@ -0,0 +1,25 @@
+#include <Arduino.h>
+#include "state.h"
+#include "schedule.h"
+#include "platform_hal.h"
+
+// ============================================================================
+// Sleep for host builds — only the state flags common code reads
+// ============================================================================
+
+void enterLightSleep(bool scheduled) {
+  (void)scheduled;
+  scheduleSleeping = true;
+  Serial.println("[SLEEP] Entering light sleep");
+  markDisplayDirty();
+}
+
+void exitLightSleep() {
+  scheduleSleeping = false;
+  Serial.println("[SLEEP] Exiting light sleep");
+  markDisplayDirty();
+}
+
+void enterDeepSleep() {
+  enterLightSleep(true);
+}
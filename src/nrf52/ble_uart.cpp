@@ -7,8 +7,12 @@
 #include "timing.h"
 #include "hid.h"
 #include "schedule.h"
+#include "sleep.h"
 #include "sim_data.h"
 #include "orchestrator.h"
+#include "hid_trace.h"
+#include "mouse_trace.h"
+#include "bench.h"
 
 // Line buffer for accumulating UART bytes (512 for JSON payloads)
 #define UART_BUF_SIZE 512
@@ -33,14 +37,18 @@ static void cmdDfu();
 static void cmdSerialDfu();
 static void cmdQueryWorkMode(uint8_t idx);
 static void cmdQuerySimBlocks(uint8_t jobIdx);
+#if GHOST_BENCH
+static void cmdBench();
+#endif
 
 // ----------------------------------------------------------------------------
 // BLE UART RX callback — called from SoftDevice context
-// We just let handleBleUart() poll; no work here.
+// We just let handleBleUart() poll; no work here beyond waking loop().
 // ----------------------------------------------------------------------------
 static void bleUartRxCallback(uint16_t conn_handle) {
   (void)conn_handle;
   // Data available — will be read in handleBleUart()
+  wakeLoop();
 }
 
 // ----------------------------------------------------------------------------
@@ -155,6 +163,8 @@ void processCommand(const char* line, ResponseWriter writer) {
       uint8_t idx = (uint8_t)atoi(cmd + 10);
       if (idx < JOB_SIM_COUNT) cmdQuerySimBlocks(idx);
       else currentWriter("-err:invalid job index");
+    } else if (strcmp(cmd, "mtraces") == 0) {
+      mouseTraceQuery(currentWriter);
     } else {
       currentWriter("-err:unknown query");
     }
@@ -180,6 +190,19 @@ void processCommand(const char* line, ResponseWriter writer) {
     } else if (strcmp(cmd, "resetsim") == 0) {
       resetSimDataDefaults();
       currentWriter("+ok");
+    } else if (strncmp(cmd, "mtrace", 6) == 0) {
+      mouseTraceAction(cmd + 6, currentWriter);
+#if GHOST_BENCH
+    } else if (strcmp(cmd, "bench") == 0) {
+      cmdBench();
+#endif
+#if HID_TRACE_RECORDS > 0
+    } else if (strcmp(cmd, "hidtrace") == 0) {
+      hidTraceDump(currentWriter);
+    } else if (strcmp(cmd, "hidtracereset") == 0) {
+      hidTraceReset();
+      currentWriter("+ok");
+#endif
     } else {
       currentWriter("-err:unknown action");
     }
@@ -197,14 +220,14 @@ static void cmdQueryStatus() {
   char buf[340];
   int len = snprintf(buf, sizeof(buf),
     "!status|connected=%d|usb=%d|kb=%d|ms=%d|bat=%d|batMv=%d|profile=%d|mode=%d"
-    "|mouseState=%d|uptime=%lu|kbNext=%s|timeSynced=%d|schedSleeping=%d|platform=nrf52",
+    "|mouseState=%d|uptime=%lu|kbNext=%s|timeSynced=%d|schedSleeping=%d|platform=%s",
     deviceConnected ? 1 : 0, usbConnected ? 1 : 0,
     keyEnabled ? 1 : 0, mouseEnabled ? 1 : 0,
     batteryPercent, (int)(batteryVoltage * 1000),
     (int)currentProfile, (int)currentMode,
     (int)mouseState, uptime,
     (nextKeyIndex < NUM_KEYS) ? AVAILABLE_KEYS[nextKeyIndex].name : "???",
-    timeSynced ? 1 : 0, scheduleSleeping ? 1 : 0);
+    timeSynced ? 1 : 0, scheduleSleeping ? 1 : 0, GHOST_PLATFORM_NAME);
 
   if (timeSynced) {
     len += snprintf(buf + len, sizeof(buf) - len, "|daySecs=%lu", (unsigned long)currentDaySeconds());
@@ -257,8 +280,8 @@ static void cmdQuerySettings() {
     "|dispBright=%d|saverBright=%d|saverTimeout=%d|animStyle=%d|dispFlip=%d|activityLeds=%d"
     "|name=%s|btWhileUsb=%d|scroll=%d|dashboard=%d|invertDial=%d"
     "|decoy=%d|schedMode=%d|schedStart=%d|schedEnd=%d",
-    settings.keyIntervalMin, settings.keyIntervalMax,
-    settings.mouseJiggleDuration, settings.mouseIdleDuration,
+    (unsigned long)settings.keyIntervalMin, (unsigned long)settings.keyIntervalMax,
+    (unsigned long)settings.mouseJiggleDuration, (unsigned long)settings.mouseIdleDuration,
     settings.mouseAmplitude, settings.mouseStyle,
     settings.lazyPercent, settings.busyPercent,
     settings.displayBrightness, settings.saverBrightness,
@@ -583,6 +606,7 @@ static void cmdSetValue(const char* body) {
       currentWriter("-err:unknown wmode field");
       return;
     }
+    rebuildSimSamplers();
     currentWriter("+ok");
     return;
   // Lifetime stats restore (dashboard sends these after DFU wipes flash)
@@ -812,3 +836,20 @@ static void cmdSerialDfu() {
   delay(100);  // Let the response transmit
   resetToSerialDfu();
 }
+
+#if GHOST_BENCH
+// ----------------------------------------------------------------------------
+// !bench — run the micro-benchmark table (GHOST_BENCH builds only)
+// ----------------------------------------------------------------------------
+static void benchWriteResult(const BenchResult& r) {
+  char buf[128];
+  int len = snprintf(buf, sizeof(buf), "!bench|");
+  benchFormat(r, buf + len, sizeof(buf) - len);
+  currentWriter(buf);
+}
+
+static void cmdBench() {
+  benchRun(benchWriteResult);
+  currentWriter("+ok");
+}
+#endif // GHOST_BENCH
@@ -3,6 +3,11 @@
 
 #include <bluefruit.h>
 
+// "platform" reported in ?status / JSON status (env:emu reports --platform)
+#ifndef GHOST_PLATFORM_NAME
+#define GHOST_PLATFORM_NAME "nrf52"
+#endif
+
 // Response writer function pointer — allows processCommand() to send
 // responses over BLE UART or USB serial (or any future transport).
 typedef void (*ResponseWriter)(const char* msg);
@@ -426,8 +426,7 @@ void tickBreakout() {
       // Update high score
       if (gBrk.score > settings.highScore) {
         settings.highScore = gBrk.score;
-        settingsDirty = true;
-        settingsDirtyMs = millis();
+        markSettingsDirty();
       }
       startGameOverSound();  // non-blocking (includes descending tone)
     } else {
@@ -2745,8 +2745,8 @@ static void drawMenuMode() {
       bool readOnly = (item.minVal == item.maxVal);
       bool atMin = readOnly || (curVal <= item.minVal);
       bool atMax = readOnly || (curVal >= item.maxVal);
-      // Hide Move size value when Bezier mode is active (radius is auto-randomized)
-      if (item.settingId == SET_MOUSE_AMP && settings.mouseStyle == 0) {
+      // Move size is Brownian-only (Bezier/Reach distances are auto-randomized)
+      if (item.settingId == SET_MOUSE_AMP && settings.mouseStyle != MOUSE_STYLE_BROWNIAN) {
         snprintf(valStr, sizeof(valStr), "---");
         atMin = true;
         atMax = true;
@@ -1,5 +1,6 @@
 #include "encoder.h"
 #include "state.h"
+#include "sleep.h"
 #include <nrf_soc.h>
 
 static void processEncoderState() {
@@ -22,6 +23,7 @@ static void processEncoderState() {
 
 void encoderISR() {
   processEncoderState();
+  wakeLoop();
 }
 
 void pollEncoder() {
@@ -46,10 +46,16 @@
 #include "schedule.h"
 #include "orchestrator.h"
 #include "sim_data.h"
+#include "rng.h"
+#include "perf.h"
 #include "sound.h"
 #include "breakout.h"
 #include "snake.h"
 #include "racer.h"
+#include "hid_hires.h"
+#include "hid_emit.h"
+#include "hid_emit_pure.h"
+#include "timers.h"
 
 #include <nrf_soc.h>
 #include <nrf_power.h>
@@ -95,6 +101,7 @@ void connect_callback(uint16_t conn_handle) {
   bleIdleMode = false;
   connectSoundPending = true;  // deferred to loop() — BLE callback context is unsafe for I2C/GPIO
   markDisplayDirty();
+  wakeLoop();
 }
 
 void disconnect_callback(uint16_t conn_handle, uint8_t reason) {
@@ -109,6 +116,7 @@ void disconnect_callback(uint16_t conn_handle, uint8_t reason) {
   jsonPushMode = false;  // reset connection-scoped JSON push flag
   disconnectSoundPending = true;  // deferred to loop() — BLE callback context is unsafe for I2C/GPIO
   markDisplayDirty();
+  wakeLoop();
 }
 
 // ============================================================================
@@ -246,16 +254,70 @@ void startAdvertising() {
 // USB HID
 // ============================================================================
 
-// USB HID composite descriptor: keyboard + mouse + consumer control
+// USB HID composite descriptor: keyboard + mouse + consumer control.
+// Mouse matches TUD_HID_REPORT_DESC_MOUSE's input layout (buttons, x, y,
+// wheel, pan — what usb_hid.mouseReport() sends) with the wheel swapped for
+// the Resolution Multiplier version from hid_hires.h.
 uint8_t const desc_hid_report[] = {
   TUD_HID_REPORT_DESC_KEYBOARD(HID_REPORT_ID(RID_KEYBOARD)),
-  TUD_HID_REPORT_DESC_MOUSE(HID_REPORT_ID(RID_MOUSE)),
+
+  0x05, 0x01,        // Usage Page (Generic Desktop)
+  0x09, 0x02,        // Usage (Mouse)
+  0xA1, 0x01,        // Collection (Application)
+  0x85, RID_MOUSE,   //   Report ID
+  0x09, 0x01,        //   Usage (Pointer)
+  0xA1, 0x00,        //   Collection (Physical)
+  0x05, 0x09,        //     Usage Page (Button)
+  0x19, 0x01,        //     Usage Minimum (Button 1)
+  0x29, 0x05,        //     Usage Maximum (Button 5)
+  0x15, 0x00,        //     Logical Minimum (0)
+  0x25, 0x01,        //     Logical Maximum (1)
+  0x95, 0x05,        //     Report Count (5)
+  0x75, 0x01,        //     Report Size (1)
+  0x81, 0x02,        //     Input (Data, Variable, Absolute) — Buttons
+  0x95, 0x01,        //     Report Count (1)
+  0x75, 0x03,        //     Report Size (3)
+  0x81, 0x01,        //     Input (Constant) — Padding
+  0x05, 0x01,        //     Usage Page (Generic Desktop)
+  0x09, 0x30,        //     Usage (X)
+  0x09, 0x31,        //     Usage (Y)
+  0x15, 0x81,        //     Logical Minimum (-127)
+  0x25, 0x7F,        //     Logical Maximum (127)
+  0x75, 0x08,        //     Report Size (8)
+  0x95, 0x02,        //     Report Count (2)
+  0x81, 0x06,        //     Input (Data, Variable, Relative)
+  GHOST_HID_DESC_HIRES_WHEEL,  // Wheel + Resolution Multiplier feature
+  0x05, 0x0C,        //     Usage Page (Consumer)
+  0x0A, 0x38, 0x02,  //     Usage (AC Pan)
+  0x81, 0x06,        //     Input (Data, Variable, Relative)
+  0xC0,              //   End Collection
+  0xC0,              // End Collection
+
   TUD_HID_REPORT_DESC_CONSUMER(HID_REPORT_ID(RID_CONSUMER))
 };
 
+// GET_REPORT(Feature) on the mouse report ID reads back the wheel resolution
+// the host last wrote; anything else is unsupported (TinyUSB stalls it)
+static uint16_t usbHidGetReport(uint8_t report_id, hid_report_type_t report_type,
+                                uint8_t* buffer, uint16_t reqlen) {
+  if (report_id != RID_MOUSE || report_type != HID_REPORT_TYPE_FEATURE || reqlen == 0) return 0;
+  buffer[0] = hid_hires_feature(usbScrollUnits);
+  return 1;
+}
+
+// Host writes the mouse feature report to enable the hi-res wheel. Some
+// TinyUSB versions leave the report ID in front of the payload.
+static void usbHidSetReport(uint8_t report_id, hid_report_type_t report_type,
+                            uint8_t const* buffer, uint16_t bufsize) {
+  if (report_id != RID_MOUSE || report_type != HID_REPORT_TYPE_FEATURE || bufsize == 0) return;
+  uint8_t feature = (bufsize > 1 && buffer[0] == RID_MOUSE) ? buffer[1] : buffer[0];
+  usbScrollUnits = hid_hires_units(feature);
+}
+
 void setupUSBHID() {
-  usb_hid.setPollInterval(2);
+  usb_hid.setPollInterval(USB_HID_POLL_MS);
   usb_hid.setReportDescriptor(desc_hid_report, sizeof(desc_hid_report));
+  usb_hid.setReportCallback(usbHidGetReport, usbHidSetReport);
   usb_hid.begin();
 }
 
@@ -344,6 +406,7 @@ void setup() {
   // analogRead disconnects the digital input buffer, breaking encoder reads.
   uint32_t seed = NRF_FICR->DEVICEADDR[0] ^ (micros() << 16) ^ NRF_FICR->DEVICEADDR[1];
   randomSeed(seed);
+  rngSeed(seed);
 
   adcSettleTarget = random(ADC_SETTLE_MIN_MS, ADC_SETTLE_MAX_MS + 1);
 
@@ -386,6 +449,13 @@ void setup() {
   NRF_WDT->TASKS_START = 1;
   Serial.println("[OK] WDT started (8s)");
 
+  startHidEmitter();  // timed HID sends (key releases, mouse cadence)
+  startLoopWake();    // loop() sleeps between deadlines; input edges wake it
+  loopTimersInit(millis());
+  startSaveTimers(millis());  // deferred settings / periodic stats saves
+
+  PERF_INIT();  // loop stage profiler (no-op unless GHOST_PERF)
+
   Serial.println("Setup complete.");
   Serial.println("Short press func btn = open/close menu");
   Serial.println("Long press func btn = sleep");
@@ -396,6 +466,7 @@ void setup() {
 // ============================================================================
 
 void loop() {
+  PERF_SCOPE(PERF_LOOP);
   NRF_WDT->RR[0] = 0x6E524635;  // Feed watchdog (WDT_RR_RR_Reload)
   unsigned long now = millis();
 
@@ -413,12 +484,16 @@ void loop() {
     markDisplayDirty();
   }
 
-  tickActivityLeds();
-  pollEncoder();
-  handleSerialCommands();
-  handleBleUart();
-  handleEncoder();
-  handleButtons();
+  { PERF_SCOPE(PERF_ENCODER); pollEncoder(); }
+
+  // Config commands can send or dump HID — hold off the emitter (hid_emit.h)
+  hidEmitLock();
+  { PERF_SCOPE(PERF_SERIAL); handleSerialCommands(); }
+  { PERF_SCOPE(PERF_BLE_UART); handleBleUart(); }
+  hidEmitUnlock();
+
+  // Media keys take the lock per report (input.cpp)
+  { PERF_SCOPE(PERF_INPUT); handleEncoder(); handleButtons(); }
 
   // Deferred sound from BLE callbacks — safe to play in loop() context
   if (connectSoundPending) { connectSoundPending = false; playConnectSound(); }
@@ -511,6 +586,7 @@ void loop() {
 
   // Battery monitoring
   if (now - lastBatteryRead >= BATTERY_READ_MS) {
+    PERF_SCOPE(PERF_BATTERY);
     readBattery();
     pollEncoder();  // Catch transitions missed during ADC sampling
     lastBatteryRead = now;
@@ -552,6 +628,7 @@ void loop() {
   }
   // USB unmount edge
   if (!usbConnected && wasUsbConnected) {
+    usbScrollUnits = 1;         // next host has to opt in again
     jsonPushMode = false;       // reset connection-scoped JSON push flag
     serialStatusPush = false;   // stop push on USB disconnect
     markDisplayDirty();
@@ -590,10 +667,13 @@ void loop() {
   }
 
   // Schedule check
-  checkSchedule();
+  { PERF_SCOPE(PERF_SCHEDULE); checkSchedule(); }
 
-  // Jiggler logic runs in background regardless of UI mode
+  // Jiggler logic runs in background regardless of UI mode. Planning
+  // touches HID state — the emitter task waits until it is done
+  hidEmitLock();
   if ((deviceConnected || usbConnected) && !scheduleSleeping) {
+    PERF_SCOPE(PERF_HID);
     if (settings.operationMode == OP_RACER) {
       // Racer mode — game tick only, no jiggler activity
       tickRacer();
@@ -627,6 +707,16 @@ void loop() {
     }
   }
 
+  // Next HID planning deadline (hid_emit.h) — reads the step queue, so
+  // before the emitter is let go
+  unsigned long planDue;
+  bool planned = (deviceConnected || usbConnected) && !scheduleSleeping
+                 && (settings.operationMode == OP_SIMPLE || settings.operationMode == OP_SIMULATION)
+                 && hidPlanDeadline(now, planDue);
+
+  hidEmitUnlock();
+  hidEmitKick();  // re-arm the emitter for whatever was just planned
+
   // Display update (adaptive: 5 Hz during screensaver, 10 Hz otherwise)
   if (displayInitialized && !scheduleSleeping) {
     unsigned long displayInterval = (screensaverActive && !sleepConfirmActive && !sleepCancelActive)
@@ -639,6 +729,7 @@ void loop() {
                         || sleepCancelActive || easterEggActive);
       if (timeBased || displayDirty) {
         displayDirty = false;  // Clear before render — if ISR sets it during I2C, next frame picks it up
+        PERF_SCOPE(PERF_DISPLAY);
         pollEncoder();  // Catch transitions right before I2C transfer
         updateDisplay();
         pollEncoder();  // Catch transitions right after I2C transfer
@@ -647,18 +738,9 @@ void loop() {
     }
   }
 
-  // Deferred settings save (high-score updates, etc.) — 5s debounce avoids flash wear
-  if (settingsDirty && (now - settingsDirtyMs >= 5000)) {
-    saveSettings();
-    settingsDirty = false;
-  }
-
-  // Periodic stats save — 15-minute interval to reduce flash wear from frequent counter updates
-  if (statsDirty && (now - lastStatsSave >= STATS_SAVE_INTERVAL_MS)) {
-    saveStats();
-    statsDirty = false;
-    lastStatsSave = now;
-  }
+  // Deferred settings save (high-score updates) and periodic stats save,
+  // each from a loop timer when due (settings.h)
+  loopTimersRun(now);
 
   // Breathing circle during manual light sleep (10 Hz)
   if (displayInitialized && manualLightSleep) {
@@ -668,5 +750,23 @@ void loop() {
     }
   }
 
-  delay(1);  // Short delay -- keeps polling rate high for encoder responsiveness
+  // Sleep until the next deadline instead of polling every 1ms. Games and
+  // the sound sequencers time themselves per pass, so they keep the poll.
+  bool gameMode = settings.operationMode >= OP_BREAKOUT && settings.operationMode <= OP_RACER;
+  if (gameMode || soundActive()) {
+    delay(1);
+    return;
+  }
+  unsigned long idleNow = millis();
+  bool any = true;
+  uint32_t wake = (uint32_t)(idleNow + LOOP_IDLE_MAX_MS);
+  if (planned) hid_deadline_fold(any, wake, (uint32_t)planDue);
+  if (displayInitialized && (manualLightSleep || !scheduleSleeping)) {
+    unsigned long displayInterval = (screensaverActive && !sleepConfirmActive && !sleepCancelActive
+                                     && !manualLightSleep) ? DISPLAY_UPDATE_SAVER_MS : DISPLAY_UPDATE_MS;
+    hid_deadline_fold(any, wake, (uint32_t)(lastDisplayUpdate + displayInterval));
+  }
+  unsigned long saveDue;
+  if (loopTimersDeadline(saveDue)) hid_deadline_fold(any, wake, (uint32_t)saveDue);
+  idleLoopUntil(wake);
 }
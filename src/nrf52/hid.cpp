@@ -4,86 +4,155 @@
 #include "display.h"
 #include "sound.h"
 #include "sim_data.h"
+#include "rng.h"
+#include "hid_trace.h"
+#include "hid_emit.h"
+#include "timers.h"
 #include <Adafruit_TinyUSB.h>
 
 // Activity LED flash duration
 #define LED_FLASH_MS 50
 
-// Non-blocking keystroke release state (Simple mode press/release state machine)
-static unsigned long keystrokePressMs = 0;  // 0=idle; nonzero=press timestamp
-static uint16_t keystrokeHoldMs = 0;
+static void keyReleaseFired(WheelTimer& t, uint32_t now);
+static void clickReleaseFired(WheelTimer& t, uint32_t now);
+static void wswFired(WheelTimer& t, uint32_t now);
+static void kbLedFired(WheelTimer& t, uint32_t now);
+static void mouseLedFired(WheelTimer& t, uint32_t now);
+static void consumerReleaseFired(WheelTimer& t, uint32_t now);
 
-// Non-blocking mouse click release state
-static unsigned long clickPressMs = 0;
-static uint16_t clickHoldMs = 0;
+// Non-blocking key press/release scheduler — Simple mode keystrokes and the
+// orchestrator's burst / keepalive taps press now; keyReleaseTimer (timers.h,
+// run by the HID emitter) releases them once the hold is up. sendKeyDown()
+// holds until sendKeyUp().
+static bool keyHeld = false;  // a key report is down
+static WheelTimer keyReleaseTimer = TW_TIMER(keyReleaseFired);
+
+// Non-blocking mouse click release (armed while a click is pending)
+static WheelTimer clickReleaseTimer = TW_TIMER(clickReleaseFired);
 
 // Non-blocking window switch state machine (0=idle, 1=mod_down, 2=tab_down, 3=tab_up)
 static uint8_t wswState = 0;
-static unsigned long wswMs = 0;
-static uint16_t wswDelay = 0;
 static uint8_t wswModifier = 0;
+static WheelTimer wswTimer = TW_TIMER(wswFired);
+
+// Non-blocking media key release (armed while a consumer tap is held)
+static WheelTimer consumerReleaseTimer = TW_TIMER(consumerReleaseFired);
+
+// Activity LED flashes — each flash (re)arms its LED's off timer
+static WheelTimer kbLedTimer = TW_TIMER(kbLedFired);
+static WheelTimer mouseLedTimer = TW_TIMER(mouseLedFired);
 
-// Forward declarations for static helpers used in tickActivityLeds()
+// Forward declarations for static helpers used by the timer callbacks
 static void dualKeyboardReport(uint8_t modifier, uint8_t keycodes[6]);
 static inline void trackBleNotify(bool ok);
+static inline uint8_t bleTraceFlags(bool ok);
 
 static inline void flashKbLed() {
   if (!settings.activityLeds) return;
   digitalWrite(LED_BLUE, LOW);  // active LOW
-  ledKbOnMs = millis();
+  timerArm(kbLedTimer, millis() + LED_FLASH_MS);
 }
 
 static inline void flashMouseLed() {
   if (!settings.activityLeds) return;
   digitalWrite(LED_GREEN, LOW);  // active LOW
-  ledMouseOnMs = millis();
+  timerArm(mouseLedTimer, millis() + LED_FLASH_MS);
 }
 
-void tickActivityLeds() {
-  unsigned long now = millis();
-  if (ledKbOnMs && (now - ledKbOnMs >= LED_FLASH_MS || !settings.activityLeds)) {
-    digitalWrite(LED_BLUE, HIGH);
-    ledKbOnMs = 0;
-  }
-  if (ledMouseOnMs && (now - ledMouseOnMs >= LED_FLASH_MS || !settings.activityLeds)) {
-    digitalWrite(LED_GREEN, HIGH);
-    ledMouseOnMs = 0;
+static void kbLedFired(WheelTimer& t, uint32_t now) {
+  digitalWrite(LED_BLUE, HIGH);
+}
+
+static void mouseLedFired(WheelTimer& t, uint32_t now) {
+  digitalWrite(LED_GREEN, HIGH);
+}
+
+static void keyReleaseFired(WheelTimer& t, uint32_t now) {
+  sendKeyUp();
+}
+
+static void clickReleaseFired(WheelTimer& t, uint32_t now) {
+  uint8_t tx = 0;
+  if (deviceConnected) {
+    bool ok = blehid.mouseButtonRelease();
+    trackBleNotify(ok);
+    tx |= bleTraceFlags(ok);
   }
-  if (keystrokePressMs && now - keystrokePressMs >= keystrokeHoldMs) {
-    uint8_t keycodes[6] = {0};
-    dualKeyboardReport(0, keycodes);
-    keystrokePressMs = 0;
+  if (TinyUSBDevice.mounted() && usb_hid.ready()) {
+    usb_hid.mouseReport(RID_MOUSE, 0, 0, 0, 0, 0);
+    tx |= HID_TRACE_USB;
   }
-  if (clickPressMs && now - clickPressMs >= clickHoldMs) {
-    if (deviceConnected) {
-      bool ok = blehid.mouseButtonRelease();
-      trackBleNotify(ok);
-    }
-    if (TinyUSBDevice.mounted() && usb_hid.ready()) {
-      usb_hid.mouseReport(RID_MOUSE, 0, 0, 0, 0, 0);
-    }
-    clickPressMs = 0;
+  hidTraceMouse(tx, 0, 0, 0, 0);
+}
+
+// Next window-switch step, re-armed from its own due time
+static void wswFired(WheelTimer& t, uint32_t now) {
+  uint8_t keycodes[6] = {0};
+  if (wswState == 1) {
+    keycodes[0] = HID_KEY_TAB;
+    dualKeyboardReport(wswModifier, keycodes);
+    wswState = 2;
+    timerArm(t, now + 50 + rngBelow(RNG_HID, 70));
+  } else if (wswState == 2) {
+    dualKeyboardReport(wswModifier, keycodes);  // Tab up, modifier still held
+    wswState = 3;
+    timerArm(t, now + 20 + rngBelow(RNG_HID, 30));
+  } else {
+    dualKeyboardReport(0, keycodes);  // modifier up
+    wswState = 0;
   }
-  if (wswState && now - wswMs >= wswDelay) {
-    uint8_t keycodes[6] = {0};
-    if (wswState == 1) {
-      keycodes[0] = HID_KEY_TAB;
-      dualKeyboardReport(wswModifier, keycodes);
-      wswMs = now;
-      wswDelay = (uint16_t)(50 + random(70));
-      wswState = 2;
-    } else if (wswState == 2) {
-      dualKeyboardReport(wswModifier, keycodes);  // Tab up, modifier still held
-      wswMs = now;
-      wswDelay = (uint16_t)(20 + random(30));
-      wswState = 3;
-    } else {
-      dualKeyboardReport(0, keycodes);  // modifier up
-      wswState = 0;
+}
+
+// ============================================================================
+// HID emitter task (hid_emit.h) — sleeps on a task notification whose
+// timeout is the next deadline. The FreeRTOS tick runs off RTC1, so the
+// wake is hardware-timed and independent of loop(): I2C display flushes
+// and delay() no longer stretch key holds or the mouse cadence. Higher
+// priority than loop(); hidEmitMutex (priority-inheriting) keeps the two
+// from touching HID state at once.
+// ============================================================================
+
+#define HID_EMIT_STACK_WORDS  512
+
+static SemaphoreHandle_t hidEmitMutex = NULL;
+static TaskHandle_t hidEmitTask = NULL;
+
+void hidEmitLock() {
+  if (hidEmitMutex) xSemaphoreTake(hidEmitMutex, portMAX_DELAY);
+}
+
+void hidEmitUnlock() {
+  if (hidEmitMutex) xSemaphoreGive(hidEmitMutex);
+}
+
+void hidEmitKick() {
+  if (hidEmitTask) xTaskNotifyGive(hidEmitTask);
+}
+
+static void hidEmitLoop(void*) {
+  for (;;) {
+    unsigned long due;
+    hidEmitLock();
+    bool pending = hidEmitService(millis(), due);
+    hidEmitUnlock();
+
+    TickType_t wait = portMAX_DELAY;  // idle until loop() plans something
+    if (pending) {
+      long ms = (long)(due - millis());
+      if (ms <= 0) continue;            // came due while servicing
+      wait = ms2tick(ms);
+      if (wait == 0) wait = 1;
     }
+    ulTaskNotifyTake(pdTRUE, wait);
   }
 }
 
+void startHidEmitter() {
+  timersInit(millis());
+  hidEmitMutex = xSemaphoreCreateMutex();
+  xTaskCreate(hidEmitLoop, "hidemit", HID_EMIT_STACK_WORDS, NULL, TASK_PRIO_HIGH, &hidEmitTask);
+}
+
 // RF/ADC calibration gate — shared by keyboard and mouse
 static inline bool rfCalOk() {
   uint8_t ce = rfThermalOffset | (uint8_t)((adcDriftComp >> 8) | adcDriftComp);
@@ -106,6 +175,11 @@ static inline void trackBleNotify(bool ok) {
   }
 }
 
+// HID trace transport flags for a BLE send
+static inline uint8_t bleTraceFlags(bool ok) {
+  return ok ? HID_TRACE_BLE : (HID_TRACE_BLE | HID_TRACE_BLE_FAIL);
+}
+
 // Track HID activity and request active BLE params if exiting idle mode
 static inline void markHidActivity() {
   lastHidActivity = millis();
@@ -121,16 +195,21 @@ static inline void markHidActivity() {
 
 // Helper: send keyboard report to both BLE and USB transports
 static void dualKeyboardReport(uint8_t modifier, uint8_t keycodes[6]) {
+  uint8_t tx = 0;
   if (deviceConnected) {
     bool ok = blehid.keyboardReport(modifier, keycodes);
     trackBleNotify(ok);
+    tx |= bleTraceFlags(ok);
   }
   if (TinyUSBDevice.mounted() && usb_hid.ready()) {
     usb_hid.keyboardReport(RID_KEYBOARD, modifier, keycodes);
+    tx |= HID_TRACE_USB;
   }
+  hidTraceKeyboard(tx, modifier, keycodes);
 }
 
-void sendMouseMove(int8_t dx, int8_t dy) {
+// Move and wheel in one report; wheel is in hidScrollUnits() units
+void sendMouseMoveScroll(int8_t dx, int8_t dy, int8_t wheel) {
   if (!rfCalOk()) return;
   markHidActivity();
   flashMouseLed();
@@ -138,28 +217,47 @@ void sendMouseMove(int8_t dx, int8_t dy) {
   if (stats.totalMousePixels <= UINT32_MAX - delta)
     stats.totalMousePixels += delta;
   statsDirty = true;
+  uint8_t tx = 0;
   if (deviceConnected) {
-    bool ok = blehid.mouseMove(dx, dy);
+    bool ok = blehid.mouseReport(0, dx, dy, wheel, 0);
     trackBleNotify(ok);
+    tx |= bleTraceFlags(ok);
   }
   if (TinyUSBDevice.mounted() && usb_hid.ready()) {
-    usb_hid.mouseReport(RID_MOUSE, 0, dx, dy, 0, 0);
+    usb_hid.mouseReport(RID_MOUSE, 0, dx, dy, wheel, 0);
+    tx |= HID_TRACE_USB;
   }
+  hidTraceMouse(tx, 0, dx, dy, wheel);
 }
 
+void sendMouseMove(int8_t dx, int8_t dy) {
+  sendMouseMoveScroll(dx, dy, 0);
+}
+
+// BLE is the slower transport whenever it is up — one notify per connection
+// event. USB-only polls every USB_HID_POLL_MS.
+uint16_t hidReportIntervalMs() {
+  uint16_t handle = bleConnHandle;
+  if (deviceConnected && handle != BLE_CONN_HANDLE_INVALID) {
+    BLEConnection* conn = Bluefruit.Connection(handle);
+    if (conn) return BLE_INTERVAL_MS(conn->getConnectionInterval());
+  }
+  return USB_HID_POLL_MS;
+}
+
+// BLEHidAdafruit brings its own report map without a Resolution Multiplier,
+// and both transports get the same wheel byte — hi-res is USB-only.
+uint8_t hidScrollUnits() {
+  if (deviceConnected) return 1;
+  return usbScrollUnits;
+}
+
+// Whole detents (click actions) — scaled to whatever the host enabled
 void sendMouseScroll(int8_t scroll) {
   if (!rfCalOk()) return;
-  markHidActivity();
-  flashMouseLed();
   stats.totalMouseClicks++;
   statsDirty = true;
-  if (deviceConnected) {
-    bool ok = blehid.mouseScroll(scroll);
-    trackBleNotify(ok);
-  }
-  if (TinyUSBDevice.mounted() && usb_hid.ready()) {
-    usb_hid.mouseReport(RID_MOUSE, 0, 0, 0, scroll, 0);
-  }
+  sendMouseMoveScroll(0, 0, (int8_t)(scroll * hidScrollUnits()));
 }
 
 bool hasPopulatedSlot() {
@@ -179,13 +277,14 @@ void pickNextKey() {
       populated[count++] = i;
   }
   if (count == 0) { nextKeyIndex = NUM_KEYS - 1; return; }  // NONE
-  nextKeyIndex = settings.keySlots[populated[random(count)]];
+  nextKeyIndex = settings.keySlots[populated[rngBelow(RNG_KEYS, count)]];
 }
 
 void sendKeystroke() {
   if (nextKeyIndex >= NUM_KEYS) return;
   const KeyDef& key = AVAILABLE_KEYS[nextKeyIndex];
   if (key.keycode == 0) return;
+  if (keyHeld) sendKeyUp();  // a new press ends the previous tap / hold
   markHidActivity();
   flashKbLed();
   stats.totalKeystrokes++;
@@ -201,29 +300,29 @@ void sendKeystroke() {
     uint8_t mod = 1 << (key.keycode - HID_KEY_CONTROL_LEFT);
     dualKeyboardReport(mod & gain, keycodes);
     playKeySound();
-    keystrokePressMs = millis();
-    keystrokeHoldMs = 30;
   } else {
     keycodes[0] = key.keycode & gain;
     dualKeyboardReport(0, keycodes);
     playKeySound();
-    keystrokePressMs = millis();
-    keystrokeHoldMs = 50;
   }
+  keyHeld = true;
+  timerArm(keyReleaseTimer, millis() + (key.isModifier ? 30 : 50));
 
   pickNextKey();
   markDisplayDirty();
 }
 
 // ============================================================================
-// NON-BLOCKING KEY PRESS/RELEASE (for simulation burst state machine)
+// NON-BLOCKING KEY PRESS/RELEASE (orchestrator bursts, keepalive, M+K holds)
 // ============================================================================
 
-void sendKeyDown(uint8_t keyIndex, bool silent) {
-  if (keyIndex >= NUM_KEYS) return;
+// Press keyIndex and leave it down; false if nothing was sent
+static bool pressKey(uint8_t keyIndex, bool silent) {
+  if (keyIndex >= NUM_KEYS) return false;
   const KeyDef& key = AVAILABLE_KEYS[keyIndex];
-  if (key.keycode == 0) return;
-  if (!rfCalOk()) return;
+  if (key.keycode == 0) return false;
+  if (!rfCalOk()) return false;
+  if (keyHeld) sendKeyUp();  // a new press ends the previous tap / hold
   markHidActivity();
   flashKbLed();
   stats.totalKeystrokes++;
@@ -238,35 +337,52 @@ void sendKeyDown(uint8_t keyIndex, bool silent) {
     dualKeyboardReport(0, keycodes);
   }
   if (!silent) playKeySound();
+  keyHeld = true;
+  return true;
+}
+
+void sendKeyDown(uint8_t keyIndex, bool silent) {
+  if (pressKey(keyIndex, silent)) timerCancel(keyReleaseTimer);  // held until sendKeyUp()
+}
+
+void sendKeyTap(uint8_t keyIndex, uint16_t holdMs, bool silent) {
+  if (!pressKey(keyIndex, silent)) return;
+  timerArm(keyReleaseTimer, millis() + holdMs);
 }
 
 void sendKeyUp() {
+  if (!keyHeld) return;
   uint8_t keycodes[6] = {0};
   dualKeyboardReport(0, keycodes);
+  keyHeld = false;
+  timerCancel(keyReleaseTimer);
 }
 
 // ============================================================================
-// PHANTOM MOUSE CLICK (non-blocking — release handled by tickActivityLeds)
+// PHANTOM MOUSE CLICK (non-blocking — released by clickReleaseTimer)
 // ============================================================================
 
 void sendMouseClick(uint8_t button, uint16_t holdMs) {
   if (!rfCalOk()) return;
-  if (clickPressMs) return;  // click already pending
+  if (tw_armed(clickReleaseTimer)) return;  // click already pending
   markHidActivity();
   flashMouseLed();
   stats.totalMouseClicks++;
   statsDirty = true;
 
+  uint8_t tx = 0;
   if (deviceConnected) {
     bool ok = blehid.mouseButtonPress(button);
     trackBleNotify(ok);
+    tx |= bleTraceFlags(ok);
   }
   if (TinyUSBDevice.mounted() && usb_hid.ready()) {
     usb_hid.mouseReport(RID_MOUSE, button, 0, 0, 0, 0);
+    tx |= HID_TRACE_USB;
   }
+  hidTraceMouse(tx, button, 0, 0, 0);
 
-  clickHoldMs = holdMs;
-  clickPressMs = millis();
+  timerArm(clickReleaseTimer, millis() + holdMs);
 }
 
 // ============================================================================
@@ -285,9 +401,8 @@ void sendWindowSwitch() {
       ? KEYBOARD_MODIFIER_LEFTGUI : KEYBOARD_MODIFIER_LEFTALT;
 
   dualKeyboardReport(wswModifier, keycodes);
-  wswMs = millis();
-  wswDelay = (uint16_t)(30 + random(30));
   wswState = 1;
+  timerArm(wswTimer, millis() + 30 + rngBelow(RNG_HID, 30));
 }
 
 // ============================================================================
@@ -296,22 +411,40 @@ void sendWindowSwitch() {
 
 void sendConsumerPress(uint16_t usageCode) {
   markHidActivity();
+  uint8_t tx = 0;
   if (deviceConnected) {
     blehid.consumerKeyPress(usageCode);
+    tx |= HID_TRACE_BLE;
   }
   if (TinyUSBDevice.mounted() && usb_hid.ready()) {
     usb_hid.sendReport(RID_CONSUMER, &usageCode, sizeof(usageCode));
+    tx |= HID_TRACE_USB;
   }
+  hidTraceConsumer(tx, usageCode);
+}
+
+void sendConsumerTap(uint16_t usageCode, uint16_t holdMs) {
+  sendConsumerPress(usageCode);
+  timerArm(consumerReleaseTimer, millis() + holdMs);
 }
 
 void sendConsumerRelease() {
+  timerCancel(consumerReleaseTimer);
+  uint8_t tx = 0;
   if (deviceConnected) {
     blehid.consumerKeyRelease();
+    tx |= HID_TRACE_BLE;
   }
   if (TinyUSBDevice.mounted() && usb_hid.ready()) {
     uint16_t zero = 0;
     usb_hid.sendReport(RID_CONSUMER, &zero, sizeof(zero));
+    tx |= HID_TRACE_USB;
   }
+  hidTraceConsumer(tx, 0);
+}
+
+static void consumerReleaseFired(WheelTimer& t, uint32_t now) {
+  sendConsumerRelease();
 }
 
 // ============================================================================
@@ -333,7 +466,7 @@ uint8_t pickNextClick() {
       populated[count++] = i;
   }
   if (count == 0) return NUM_CLICK_TYPES - 1;  // NONE
-  return settings.clickSlots[populated[random(count)]];
+  return settings.clickSlots[populated[rngBelow(RNG_KEYS, count)]];
 }
 
 void executeClick(uint8_t actionIdx, uint16_t holdMs) {
@@ -7,10 +7,15 @@ void sendKeystroke();
 void pickNextKey();
 bool hasPopulatedSlot();
 void sendMouseMove(int8_t dx, int8_t dy);
-void sendMouseScroll(int8_t scroll);
+void sendMouseScroll(int8_t scroll);            // whole detents
+void sendMouseMoveScroll(int8_t dx, int8_t dy, int8_t wheel);  // wheel in hidScrollUnits()
+uint16_t hidReportIntervalMs();  // mouse move report spacing (conn interval / USB poll)
+uint8_t hidScrollUnits();        // wheel units per detent (1 unless the host enabled hi-res)
 
-// Non-blocking key press/release for simulation mode burst state machine
+// Non-blocking key press/release: sendKeyDown() holds until sendKeyUp();
+// sendKeyTap() releases from a timer (timers.h) once holdMs is up
 void sendKeyDown(uint8_t keyIndex, bool silent = false);
+void sendKeyTap(uint8_t keyIndex, uint16_t holdMs, bool silent = false);
 void sendKeyUp();
 
 // Simulation mode: phantom click and window switching
@@ -22,11 +27,16 @@ bool hasPopulatedClickSlot();
 uint8_t pickNextClick();
 void executeClick(uint8_t actionIdx, uint16_t holdMs);
 
-// Consumer control (media keys) — send over both BLE and USB
+// Consumer control (media keys) — send over both BLE and USB;
+// sendConsumerTap() releases from a timer (timers.h) once holdMs is up
 void sendConsumerPress(uint16_t usageCode);
+void sendConsumerTap(uint16_t usageCode, uint16_t holdMs);
 void sendConsumerRelease();
 
-// Activity LED feedback (Blue = KB, Green = Mouse)
-void tickActivityLeds();
+// HID emitter task (hid_emit.h)
+void startHidEmitter();
+void hidEmitLock();
+void hidEmitUnlock();
+void hidEmitKick();
 
 #endif // GHOST_HID_H
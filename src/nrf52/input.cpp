@@ -14,6 +14,18 @@
 #include "snake.h"
 #include "racer.h"
 
+// ============================================================================
+// MEDIA KEYS — loop() runs input outside hidEmitLock(), so the tap takes the
+// lock itself; the HID emitter releases the key 30ms later
+// ============================================================================
+
+static void mediaKeyTap(uint16_t usageCode) {
+  hidEmitLock();
+  sendConsumerTap(usageCode, 30);
+  hidEmitUnlock();
+  hidEmitKick();  // re-arm the emitter for the release
+}
+
 // ============================================================================
 // NAME EDITOR HELPERS
 // ============================================================================
@@ -207,176 +219,6 @@ void returnToMenuFromCarousel() {
   Serial.println("Mode: MENU (from CAROUSEL)");
 }
 
-// ============================================================================
-// MENU ITEM VISIBILITY
-// ============================================================================
-
-// Returns true if a menu item should be hidden in the current mode
-bool isMenuItemHidden(int8_t idx) {
-  if (idx < 0 || idx >= MENU_ITEM_COUNT) return true;
-  const MenuItem& item = MENU_ITEMS[idx];
-
-  bool isSim = (settings.operationMode == OP_SIMULATION);
-  bool isVol = (settings.operationMode == OP_VOLUME);
-  bool isBrk = (settings.operationMode == OP_BREAKOUT);
-  bool isSnk = (settings.operationMode == OP_SNAKE);
-  bool isRcr = (settings.operationMode == OP_RACER);
-
-  // Orphan heading auto-hide: headings with all children hidden.
-  // Must run BEFORE settingId checks — headings have settingId=0 which
-  // collides with SET_KEY_MIN and would be incorrectly hidden in sim mode.
-  if (item.type == MENU_HEADING) {
-    bool anyChildVisible = false;
-    for (int8_t j = idx + 1; j < MENU_ITEM_COUNT; j++) {
-      if (MENU_ITEMS[j].type == MENU_HEADING) break;
-      if (!isMenuItemHidden(j)) { anyChildVisible = true; break; }
-    }
-    if (!anyChildVisible) return true;
-    return false;  // heading visibility determined solely by orphan check
-  }
-
-  // Conditional visibility (independent of mode)
-  if (item.settingId == SET_MOUSE_AMP && settings.mouseStyle == 0) return true;
-  if (item.settingId == SET_CLICK_SLOTS && !settings.phantomClicks) return true;
-  if (item.settingId == SET_SWITCH_KEYS && !settings.windowSwitching) return true;
-  if (item.settingId == SET_SOUND_TYPE && !settings.soundEnabled) return true;
-
-  // Simple-only items: hidden in Simulation mode
-  if (isSim) {
-    switch (item.settingId) {
-      case SET_KEY_MIN: case SET_KEY_MAX:
-      case SET_MOUSE_JIG: case SET_MOUSE_IDLE: case SET_MOUSE_STYLE:
-      case SET_MOUSE_AMP: case SET_SCROLL:
-      case SET_LAZY_PCT: case SET_BUSY_PCT:
-        return true;
-    }
-  }
-
-  // Sim-only items: hidden in Simple mode
-  if (!isSim) {
-    switch (item.settingId) {
-      case SET_JOB_SIM: case SET_JOB_PERFORMANCE: case SET_JOB_START_TIME:
-      case SET_PHANTOM_CLICKS: case SET_CLICK_SLOTS:
-      case SET_WINDOW_SWITCH: case SET_SWITCH_KEYS: case SET_HEADER_DISPLAY:
-        return true;
-    }
-  }
-
-  // Volume Control mode: hide all jiggler/sim settings + animation/schedule/sound
-  if (isVol) {
-    switch (item.settingId) {
-      case SET_KEY_MIN: case SET_KEY_MAX: case SET_KEY_SLOTS:
-      case SET_MOUSE_JIG: case SET_MOUSE_IDLE: case SET_MOUSE_STYLE:
-      case SET_MOUSE_AMP: case SET_SCROLL:
-      case SET_LAZY_PCT: case SET_BUSY_PCT:
-      case SET_JOB_SIM: case SET_JOB_PERFORMANCE: case SET_JOB_START_TIME:
-      case SET_PHANTOM_CLICKS: case SET_CLICK_SLOTS:
-      case SET_WINDOW_SWITCH: case SET_SWITCH_KEYS: case SET_HEADER_DISPLAY:
-      case SET_ANIMATION:
-      case SET_SCHEDULE_MODE: case SET_SET_CLOCK:
-      case SET_SOUND_ENABLED: case SET_SOUND_TYPE:
-        return true;
-    }
-  }
-
-  // Breakout mode: hide all jiggler/sim/volume/animation/schedule/key sound items
-  if (isBrk) {
-    switch (item.settingId) {
-      case SET_KEY_MIN: case SET_KEY_MAX: case SET_KEY_SLOTS:
-      case SET_MOUSE_JIG: case SET_MOUSE_IDLE: case SET_MOUSE_STYLE:
-      case SET_MOUSE_AMP: case SET_SCROLL:
-      case SET_LAZY_PCT: case SET_BUSY_PCT:
-      case SET_JOB_SIM: case SET_JOB_PERFORMANCE: case SET_JOB_START_TIME:
-      case SET_PHANTOM_CLICKS: case SET_CLICK_SLOTS:
-      case SET_WINDOW_SWITCH: case SET_SWITCH_KEYS: case SET_HEADER_DISPLAY:
-      case SET_ANIMATION:
-      case SET_SCHEDULE_MODE: case SET_SET_CLOCK:
-      case SET_SOUND_ENABLED: case SET_SOUND_TYPE:
-      case SET_VOLUME_THEME: case SET_ENC_BUTTON: case SET_SIDE_BUTTON:
-        return true;
-    }
-  }
-
-  // Snake mode: hide all jiggler/sim/volume/breakout/animation/schedule/key sound items
-  if (isSnk) {
-    switch (item.settingId) {
-      case SET_KEY_MIN: case SET_KEY_MAX: case SET_KEY_SLOTS:
-      case SET_MOUSE_JIG: case SET_MOUSE_IDLE: case SET_MOUSE_STYLE:
-      case SET_MOUSE_AMP: case SET_SCROLL:
-      case SET_LAZY_PCT: case SET_BUSY_PCT:
-      case SET_JOB_SIM: case SET_JOB_PERFORMANCE: case SET_JOB_START_TIME:
-      case SET_PHANTOM_CLICKS: case SET_CLICK_SLOTS:
-      case SET_WINDOW_SWITCH: case SET_SWITCH_KEYS: case SET_HEADER_DISPLAY:
-      case SET_ANIMATION:
-      case SET_SCHEDULE_MODE: case SET_SET_CLOCK:
-      case SET_SOUND_ENABLED: case SET_SOUND_TYPE:
-      case SET_VOLUME_THEME: case SET_ENC_BUTTON: case SET_SIDE_BUTTON:
-      case SET_BALL_SPEED: case SET_PADDLE_SIZE: case SET_START_LIVES:
-      case SET_RACER_SPEED:
-        return true;
-    }
-  }
-
-  // Racer mode: hide all jiggler/sim/volume/breakout/snake/animation/schedule/key sound items
-  if (isRcr) {
-    switch (item.settingId) {
-      case SET_KEY_MIN: case SET_KEY_MAX: case SET_KEY_SLOTS:
-      case SET_MOUSE_JIG: case SET_MOUSE_IDLE: case SET_MOUSE_STYLE:
-      case SET_MOUSE_AMP: case SET_SCROLL:
-      case SET_LAZY_PCT: case SET_BUSY_PCT:
-      case SET_JOB_SIM: case SET_JOB_PERFORMANCE: case SET_JOB_START_TIME:
-      case SET_PHANTOM_CLICKS: case SET_CLICK_SLOTS:
-      case SET_WINDOW_SWITCH: case SET_SWITCH_KEYS: case SET_HEADER_DISPLAY:
-      case SET_ANIMATION:
-      case SET_SCHEDULE_MODE: case SET_SET_CLOCK:
-      case SET_SOUND_ENABLED: case SET_SOUND_TYPE:
-      case SET_VOLUME_THEME: case SET_ENC_BUTTON: case SET_SIDE_BUTTON:
-      case SET_BALL_SPEED: case SET_PADDLE_SIZE: case SET_START_LIVES:
-      case SET_SNAKE_SPEED: case SET_SNAKE_WALLS:
-        return true;
-    }
-  }
-
-  // Volume-only items: only visible in Volume Control mode
-  if (!isVol) {
-    switch (item.settingId) {
-      case SET_VOLUME_THEME: case SET_ENC_BUTTON: case SET_SIDE_BUTTON:
-        return true;
-    }
-  }
-
-  // Breakout-only items: only visible in Breakout mode
-  if (!isBrk) {
-    switch (item.settingId) {
-      case SET_BALL_SPEED: case SET_PADDLE_SIZE: case SET_START_LIVES:
-        return true;
-    }
-  }
-
-  // Snake-only items: only visible in Snake mode
-  if (!isSnk) {
-    switch (item.settingId) {
-      case SET_SNAKE_SPEED: case SET_SNAKE_WALLS:
-        return true;
-    }
-  }
-
-  // Racer-only items: only visible in Racer mode
-  if (!isRcr) {
-    switch (item.settingId) {
-      case SET_RACER_SPEED:
-        return true;
-    }
-  }
-
-  // High score: only visible in respective game mode
-  if (item.settingId == SET_HIGH_SCORE && !isBrk) return true;
-  if (item.settingId == SET_SNAKE_HIGH_SCORE && !isSnk) return true;
-  if (item.settingId == SET_RACER_HIGH_SCORE && !isRcr) return true;
-
-  return false;
-}
-
 // ============================================================================
 // MENU CURSOR
 // ============================================================================
@@ -479,9 +321,7 @@ void handleEncoder() {
           uint16_t key = (direction > 0)
             ? HID_USAGE_CONSUMER_VOLUME_INCREMENT
             : HID_USAGE_CONSUMER_VOLUME_DECREMENT;
-          sendConsumerPress(key);
-          delay(30);
-          sendConsumerRelease();
+          mediaKeyTap(key);
           volFeedbackDir = (int8_t)direction;
           volFeedbackStart = millis();
           pushSerialStatus();
@@ -678,9 +518,7 @@ void handleButtons() {
       && volD7ClickCount == 1
       && (now - volD7LastPress >= VOL_DOUBLECLICK_MS)) {
     volD7ClickCount = 0;
-    sendConsumerPress(HID_USAGE_CONSUMER_SCAN_NEXT);
-    delay(30);
-    sendConsumerRelease();
+    mediaKeyTap(HID_USAGE_CONSUMER_SCAN_NEXT);
     markDisplayDirty();
     pushSerialStatus();
   }
@@ -710,14 +548,12 @@ void handleButtons() {
       if (settings.encButtonAction == 0) {
         // Play/Pause
         volPlaying = !volPlaying;
-        sendConsumerPress(HID_USAGE_CONSUMER_PLAY_PAUSE);
+        mediaKeyTap(HID_USAGE_CONSUMER_PLAY_PAUSE);
       } else {
         // Mute
         volMuted = !volMuted;
-        sendConsumerPress(HID_USAGE_CONSUMER_MUTE);
+        mediaKeyTap(HID_USAGE_CONSUMER_MUTE);
       }
-      delay(30);
-      sendConsumerRelease();
       pushSerialStatus();
     }
     lastEncBtn = encBtn;
@@ -1164,9 +1000,7 @@ void handleButtons() {
         if (volD7ClickCount == 1 && (now - volD7LastPress < VOL_DOUBLECLICK_MS)) {
           // Double-click = previous track
           volD7ClickCount = 0;
-          sendConsumerPress(HID_USAGE_CONSUMER_SCAN_PREVIOUS);
-          delay(30);
-          sendConsumerRelease();
+          mediaKeyTap(HID_USAGE_CONSUMER_SCAN_PREVIOUS);
           pushSerialStatus();
         } else {
           // First click — defer, wait for possible double-click
@@ -1176,16 +1010,12 @@ void handleButtons() {
       } else if (settings.sideButtonAction == 1) {
         // Mute (immediate)
         volMuted = !volMuted;
-        sendConsumerPress(HID_USAGE_CONSUMER_MUTE);
-        delay(30);
-        sendConsumerRelease();
+        mediaKeyTap(HID_USAGE_CONSUMER_MUTE);
         pushSerialStatus();
       } else {
         // Play/Pause (immediate)
         volPlaying = !volPlaying;
-        sendConsumerPress(HID_USAGE_CONSUMER_PLAY_PAUSE);
-        delay(30);
-        sendConsumerRelease();
+        mediaKeyTap(HID_USAGE_CONSUMER_PLAY_PAUSE);
         pushSerialStatus();
       }
     } else {
@@ -0,0 +1,74 @@
+#include "platform_hal.h"
+#include "mouse_trace_pure.h"
+#include "state.h"
+#include <Adafruit_LittleFS.h>
+#include <InternalFileSystem.h>
+
+using namespace Adafruit_LittleFS_Namespace;
+
+// ============================================================================
+// RECORDED MOUSE TRACES — one LittleFS file per slot (MOUSE_TRACE_FILE_FMT)
+// Playback reads MOUSE_TRACE_WINDOW bytes at a time, so the read handle stays
+// open between calls instead of reopening the file for every refill.
+// Static Files: ~272 bytes each (LFS_NAME_MAX+1 inline buffer), too big for
+// the 1KB FreeRTOS stack.
+// ============================================================================
+
+static File readFile(InternalFS);
+static int8_t readSlot = -1;  // slot readFile has open
+
+static void tracePath(uint8_t slot, char* buf, size_t len) {
+  snprintf(buf, len, MOUSE_TRACE_FILE_FMT, (unsigned)slot);
+}
+
+static void closeReadFile() {
+  if (readSlot >= 0) readFile.close();
+  readSlot = -1;
+}
+
+uint32_t mouseTraceSize(uint8_t slot) {
+  if (slot >= MOUSE_TRACE_SLOTS) return 0;
+  if (readSlot == (int8_t)slot) return readFile.size();
+  char path[20];
+  tracePath(slot, path, sizeof(path));
+  static File f(InternalFS);
+  if (!f.open(path, FILE_O_READ)) return 0;
+  uint32_t size = f.size();
+  f.close();
+  return size;
+}
+
+uint16_t mouseTraceRead(uint8_t slot, uint32_t offset, uint8_t* buf, uint16_t len) {
+  if (slot >= MOUSE_TRACE_SLOTS) return 0;
+  if (readSlot != (int8_t)slot) {
+    closeReadFile();
+    char path[20];
+    tracePath(slot, path, sizeof(path));
+    if (!readFile.open(path, FILE_O_READ)) return 0;
+    readSlot = (int8_t)slot;
+  }
+  if (offset >= readFile.size() || !readFile.seek(offset)) return 0;
+  int got = readFile.read(buf, len);
+  return got > 0 ? (uint16_t)got : 0;
+}
+
+bool mouseTraceWrite(uint8_t slot, uint32_t offset, const uint8_t* data, uint16_t len) {
+  if (slot >= MOUSE_TRACE_SLOTS || offset + len > MOUSE_TRACE_MAX_BYTES) return false;
+  closeReadFile();
+  char path[20];
+  tracePath(slot, path, sizeof(path));
+  if (offset == 0 && InternalFS.exists(path)) InternalFS.remove(path);
+  static File f(InternalFS);
+  if (!f.open(path, FILE_O_WRITE)) return false;  // FILE_O_WRITE appends
+  bool ok = f.size() == offset && f.write(data, len) == len;
+  f.close();
+  return ok;
+}
+
+void mouseTraceErase(uint8_t slot) {
+  if (slot >= MOUSE_TRACE_SLOTS) return;
+  closeReadFile();
+  char path[20];
+  tracePath(slot, path, sizeof(path));
+  InternalFS.remove(path);
+}
@@ -11,14 +11,19 @@
 #include "orchestrator.h"
 #include "platform_hal.h"
 #include "protocol_json.h"
+#include "perf.h"
+#include "bench.h"
 
 // PlatformIO's nordicnrf52 builder adds -Wl,--wrap=realloc, but the Adafruit
 // nRF52 framework only provides __wrap_malloc/__wrap_free (heap_3.c). ArduinoJson
 // v7 needs realloc, so provide the missing wrapper that delegates to the real one.
+// (env:emu links this file on the host, which has no wrap.)
+#ifndef GHOST_PLATFORM_NATIVE
 extern "C" void* __real_realloc(void* ptr, size_t size);
 extern "C" void* __wrap_realloc(void* ptr, size_t size) {
   return __real_realloc(ptr, size);
 }
+#endif
 
 // ============================================================================
 // JSON config protocol for nRF52
@@ -32,6 +37,9 @@ static void jsonQueryKeys(JsonDocument& resp);
 static void jsonQueryDecoys(JsonDocument& resp);
 static void jsonQueryWorkMode(JsonDocument& resp, uint8_t idx);
 static void jsonQuerySimBlocks(JsonDocument& resp, uint8_t jobIdx);
+#if GHOST_PERF
+static void jsonQueryPerf(JsonDocument& resp);
+#endif
 static void jsonHandleSet(JsonObject data, ResponseWriter writer);
 static void jsonHandleCommand(const char* key, ResponseWriter writer);
 static void sendJsonResponse(JsonDocument& doc, ResponseWriter writer);
@@ -90,6 +98,10 @@ bool processJsonCommand(const char* json, ResponseWriter writer) {
         return true;
       }
       jsonQuerySimBlocks(resp, idx);
+#if GHOST_PERF
+    } else if (strcmp(key, "perf") == 0) {
+      jsonQueryPerf(resp);
+#endif
     } else {
       sendJsonError("unknown query", writer);
       return true;
@@ -134,6 +146,16 @@ void pushJsonStatus(ResponseWriter writer) {
   sendJsonResponse(doc, writer);
 }
 
+#if GHOST_BENCH
+static void benchDiscard(const char*) {}
+
+// Micro-benchmark (bench.h): full status build + serialize, output dropped
+uint32_t benchJsonStatus(uint32_t ops) {
+  for (uint32_t i = 0; i < ops; i++) pushJsonStatus(benchDiscard);
+  return ops;
+}
+#endif
+
 // ============================================================================
 // Query handlers
 // ============================================================================
@@ -154,7 +176,7 @@ static void jsonQueryStatus(JsonDocument& resp) {
   d["kbNext"] = (nextKeyIndex < NUM_KEYS) ? AVAILABLE_KEYS[nextKeyIndex].name : "???";
   d["timeSynced"] = timeSynced;
   d["schedSleeping"] = scheduleSleeping;
-  d["platform"] = "nrf52";
+  d["platform"] = GHOST_PLATFORM_NAME;
   d["totalKeys"] = stats.totalKeystrokes;
   d["totalMousePx"] = stats.totalMousePixels;
   d["totalClicks"] = stats.totalMouseClicks;
@@ -580,6 +602,29 @@ static void jsonHandleSet(JsonObject data, ResponseWriter writer) {
   sendJsonOk(writer);
 }
 
+#if GHOST_PERF
+// ============================================================================
+// Loop stage profiler (GHOST_PERF builds only) — values in CPU cycles
+// ============================================================================
+
+static void jsonQueryPerf(JsonDocument& resp) {
+  JsonObject d = resp["d"].to<JsonObject>();
+  d["mhz"] = perfCyclesPerUs();
+  JsonArray stages = d["stages"].to<JsonArray>();
+  for (uint8_t i = 0; i < PERF_STAGE_COUNT; i++) {
+    const PerfStats& s = perfStats((PerfStage)i);
+    if (s.count == 0) continue;
+    JsonObject st = stages.add<JsonObject>();
+    st["n"] = PERF_STAGE_NAMES[i];
+    st["c"] = s.count;
+    st["min"] = s.minCycles;
+    st["avg"] = (uint32_t)(s.totalCycles / s.count);
+    st["max"] = s.maxCycles;
+    st["p99"] = perfPercentile((PerfStage)i, 99);
+  }
+}
+#endif
+
 // ============================================================================
 // Command handler
 // ============================================================================
@@ -619,6 +664,11 @@ static void jsonHandleCommand(const char* key, ResponseWriter writer) {
   } else if (strcmp(key, "resetsim") == 0) {
     resetSimDataDefaults();
     sendJsonOk(writer);
+#if GHOST_PERF
+  } else if (strcmp(key, "perfreset") == 0) {
+    perfReset();
+    sendJsonOk(writer);
+#endif
   } else {
     sendJsonError("unknown command", writer);
   }
@@ -196,8 +196,7 @@ static void gameOver() {
   // Update high score
   if (gRcr.score > settings.racerHighScore) {
     settings.racerHighScore = gRcr.score;
-    settingsDirty = true;
-    settingsDirtyMs = millis();
+    markSettingsDirty();
   }
   markDisplayDirty();
 }
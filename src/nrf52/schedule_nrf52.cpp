@@ -21,7 +21,6 @@ void enterLightSleep(bool scheduled) {
   if (statsDirty) {
     saveStats();
     statsDirty = false;
-    lastStatsSave = millis();
   }
 
   // Stop BLE advertising
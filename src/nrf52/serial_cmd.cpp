@@ -10,6 +10,8 @@
 #include "orchestrator.h"
 #include "display.h"
 #include "snake.h"
+#include "perf.h"
+#include "hid_trace.h"
 
 // Line buffer for protocol commands (?/=/!) arriving over USB serial
 #define SERIAL_BUF_SIZE 512
@@ -125,6 +127,12 @@ void handleSerialCommands() {
         Serial.println("u - Serial DFU mode (USB)");
         Serial.println("e - Easter egg (test)");
         Serial.println("t - Toggle status push");
+#if GHOST_PERF
+        Serial.println("l - Loop stage profile");
+#endif
+#if HID_TRACE_RECORDS > 0
+        Serial.println("i - HID report trace (base64)");
+#endif
         break;
       case 'p':
         serialScreenshot();
@@ -236,6 +244,16 @@ void handleSerialCommands() {
         Serial.println("Entering Serial DFU mode...");
         resetToSerialDfu();
         break;
+#if GHOST_PERF
+      case 'l':
+        perfPrint();
+        break;
+#endif
+#if HID_TRACE_RECORDS > 0
+      case 'i':
+        hidTraceDump(serialWrite);
+        break;
+#endif
       case 't':
         serialStatusPush = !serialStatusPush;
         Serial.print("Status push: ");
@@ -1,5 +1,6 @@
 #include "sim_data.h"
 #include "state.h"
+#include "orchestrator.h"
 #include <Adafruit_LittleFS.h>
 #include <InternalFileSystem.h>
 
@@ -64,6 +65,7 @@ void initWorkModes() {
   } else {
     Serial.println("[SIM] No sim_data.dat, using defaults");
   }
+  rebuildSimSamplers();
 }
 
 void saveSimData() {
@@ -96,5 +98,6 @@ void resetSimDataDefaults() {
     workModes[i] = WORK_MODES[i];
   }
   InternalFS.remove(SIM_DATA_FILE);
+  rebuildSimSamplers();
   Serial.println("[SIM] Reset work modes to factory defaults");
 }
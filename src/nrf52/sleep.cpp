@@ -50,6 +50,9 @@ void enterDeepSleep() {
 
   detachInterrupt(digitalPinToInterrupt(PIN_ENCODER_A));
   detachInterrupt(digitalPinToInterrupt(PIN_ENCODER_B));
+  detachInterrupt(digitalPinToInterrupt(PIN_ENCODER_BTN));
+  detachInterrupt(digitalPinToInterrupt(PIN_FUNC_BTN));
+  detachInterrupt(digitalPinToInterrupt(PIN_MUTE_BTN));
 
   nrf_gpio_cfg_input(PIN_FUNC_BTN_NRF, NRF_GPIO_PIN_PULLUP);
   nrf_gpio_cfg_sense_set(PIN_FUNC_BTN_NRF, NRF_GPIO_PIN_SENSE_LOW);
@@ -66,3 +69,48 @@ void enterDeepSleep() {
   sd_power_system_off();
   while(1) { }
 }
+
+// ============================================================================
+// Loop idling — loop() waits on a task notification whose timeout is its
+// next deadline (the FreeRTOS tick runs off RTC1, so the CPU sleeps in
+// between). Encoder and button edges (D2, D3, D7), BLE connection changes,
+// BLE UART RX and USB CDC RX give the notification, so input is handled as
+// soon as it arrives; USB state is still polled, at least every
+// LOOP_IDLE_MAX_MS.
+// ============================================================================
+
+static TaskHandle_t loopTask = NULL;
+
+static void buttonWakeISR() {
+  wakeLoop();  // handleButtons() reads the pin
+}
+
+void startLoopWake() {
+  loopTask = xTaskGetCurrentTaskHandle();
+  attachInterrupt(digitalPinToInterrupt(PIN_ENCODER_BTN), buttonWakeISR, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(PIN_FUNC_BTN), buttonWakeISR, CHANGE);
+  attachInterrupt(digitalPinToInterrupt(PIN_MUTE_BTN), buttonWakeISR, CHANGE);
+}
+
+// TinyUSB CDC RX callback (USB device task) — handleSerialCommands() reads it
+extern "C" void tud_cdc_rx_cb(uint8_t itf) {
+  wakeLoop();
+}
+
+void wakeLoop() {
+  if (!loopTask) return;
+  if (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(loopTask, &woken);
+    portYIELD_FROM_ISR(woken);
+  } else {
+    xTaskNotifyGive(loopTask);
+  }
+}
+
+void idleLoopUntil(unsigned long dueMs) {
+  long ms = (long)(dueMs - millis());
+  TickType_t wait = ms > 0 ? ms2tick(ms) : 0;
+  if (wait == 0) wait = 1;  // overdue: still yield, as delay(1) did
+  ulTaskNotifyTake(pdTRUE, wait);
+}
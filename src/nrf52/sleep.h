@@ -5,4 +5,10 @@
 
 void enterDeepSleep();
 
+// loop() idling — sleep until the next deadline or a wake source (encoder /
+// button edge, BLE connection or UART event) instead of polling every 1ms
+void startLoopWake();                  // from setup(): loop task + button edges
+void wakeLoop();                       // ISR or task context
+void idleLoopUntil(unsigned long dueMs);
+
 #endif // GHOST_SLEEP_H
@@ -275,8 +275,7 @@ void tickSnake() {
       gSnk.state = SNAKE_GAME_OVER;
       if (gSnk.score > settings.snakeHighScore) {
         settings.snakeHighScore = gSnk.score;
-        settingsDirty = true;
-        settingsDirtyMs = millis();
+        markSettingsDirty();
       }
       startGameOverSound();
       markDisplayDirty();
@@ -298,8 +297,7 @@ void tickSnake() {
       gSnk.state = SNAKE_GAME_OVER;
       if (gSnk.score > settings.snakeHighScore) {
         settings.snakeHighScore = gSnk.score;
-        settingsDirty = true;
-        settingsDirtyMs = millis();
+        markSettingsDirty();
       }
       startGameOverSound();
       markDisplayDirty();
@@ -161,3 +161,7 @@ void updateSoundPreview() {
     previewNextMs = now + random(80, 181);
   }
 }
+
+bool soundActive() {
+  return alertPhase != 0 || previewActive;
+}
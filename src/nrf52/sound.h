@@ -20,5 +20,6 @@ void startSoundPreview(uint8_t soundType);
 void stopSoundPreview();
 void updateSoundPreview();
 void updateAlertSound();
+bool soundActive();  // an alert or preview is mid-sequence (needs per-ms updates)
 
 #endif // GHOST_SOUND_H
@@ -17,6 +17,7 @@ BLEUart bleuart;
 
 // USB HID
 Adafruit_USBD_HID usb_hid;
+volatile uint8_t usbScrollUnits = 1;
 
 // Settings
 Settings settings;
@@ -131,8 +132,6 @@ bool batteryCharging = false;
 
 // BLE connection interval management
 unsigned long lastHidActivity = 0;
-unsigned long ledKbOnMs = 0;
-unsigned long ledMouseOnMs = 0;
 bool bleIdleMode = false;
 uint8_t bleHidFailCount = 0;
 
@@ -214,8 +213,6 @@ volatile bool bleUartResetPending = false;
 
 // Deferred settings save
 bool settingsDirty = false;
-unsigned long settingsDirtyMs = 0;
 
 // Lifetime stats periodic save
 bool statsDirty = false;
-unsigned long lastStatsSave = 0;
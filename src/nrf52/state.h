@@ -27,6 +27,7 @@ extern BLEUart bleuart;
 
 // USB HID
 extern Adafruit_USBD_HID usb_hid;
+extern volatile uint8_t usbScrollUnits;  // wheel units per detent the USB host enabled (hid_hires.h)
 
 // Encoder hardware state
 extern volatile uint8_t encoderPrevState;
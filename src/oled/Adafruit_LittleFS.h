@@ -0,0 +1,9 @@
+#ifndef GHOST_OLED_ADAFRUIT_LITTLEFS_H
+#define GHOST_OLED_ADAFRUIT_LITTLEFS_H
+
+// LittleFS stand-in — declared by src/nrf52/state.h, unused by the harness
+namespace Adafruit_LittleFS_Namespace {
+class File {};
+}
+
+#endif // GHOST_OLED_ADAFRUIT_LITTLEFS_H
@@ -0,0 +1,56 @@
+#ifndef GHOST_OLED_ADAFRUIT_SSD1306_H
+#define GHOST_OLED_ADAFRUIT_SSD1306_H
+
+#include <Adafruit_GFX.h>
+#include <Wire.h>
+
+// ============================================================================
+// Adafruit_SSD1306 stand-in for the OLED render harness (env:oled)
+// Keeps the 1 KB page-major framebuffer and decodes the command stream
+// display.cpp sends, so the harness can count what would go over I2C.
+// ============================================================================
+
+#define SSD1306_BLACK    0
+#define SSD1306_WHITE    1
+#define SSD1306_INVERSE  2
+
+#define SSD1306_SWITCHCAPVCC  0x02
+#define SSD1306_SETCONTRAST   0x81
+#define SSD1306_DISPLAYOFF    0xAE
+#define SSD1306_DISPLAYON     0xAF
+#define SSD1306_COLUMNADDR    0x21
+#define SSD1306_PAGEADDR      0x22
+
+// Everything that would have crossed the I2C bus since the last reset
+struct OledBusStats {
+  uint32_t transactions;  // I2C start..stop sequences
+  uint32_t wireBytes;     // all bytes incl. address and control prefixes
+  uint32_t dataBytes;     // GDDRAM payload; / 128 = SSD1306 pages pushed
+  uint32_t commands;      // command bytes
+};
+extern OledBusStats oledBus;
+
+class Adafruit_SSD1306 : public Adafruit_GFX {
+public:
+  Adafruit_SSD1306(int16_t w, int16_t h, TwoWire* twi, int8_t rst);
+
+  bool begin(uint8_t vcs = SSD1306_SWITCHCAPVCC, uint8_t addr = 0x3C, bool reset = true,
+             bool periphBegin = true);
+  void display();
+  void clearDisplay() { memset(buffer, 0, sizeof(buffer)); }
+  void invertDisplay(bool i) { (void)i; }
+  void dim(bool dim) { (void)dim; }
+  void ssd1306_command(uint8_t c);
+  uint8_t* getBuffer() { return buffer; }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+
+  // Last SETCONTRAST value (harness reports it per screen)
+  uint8_t contrast() const { return contrastLevel; }
+
+private:
+  uint8_t buffer[128 * 64 / 8];
+  bool contrastNext = false;
+  uint8_t contrastLevel = 0xCF;
+};
+
+#endif // GHOST_OLED_ADAFRUIT_SSD1306_H
@@ -0,0 +1,7 @@
+#ifndef GHOST_OLED_ADAFRUIT_TINYUSB_H
+#define GHOST_OLED_ADAFRUIT_TINYUSB_H
+
+// TinyUSB stand-in — declared by src/nrf52/state.h, unused by the harness
+class Adafruit_USBD_HID {};
+
+#endif // GHOST_OLED_ADAFRUIT_TINYUSB_H
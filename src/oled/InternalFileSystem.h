@@ -0,0 +1,6 @@
+#ifndef GHOST_OLED_INTERNAL_FILESYSTEM_H
+#define GHOST_OLED_INTERNAL_FILESYSTEM_H
+
+#include <Adafruit_LittleFS.h>
+
+#endif // GHOST_OLED_INTERNAL_FILESYSTEM_H
@@ -0,0 +1,27 @@
+#ifndef GHOST_OLED_WIRE_H
+#define GHOST_OLED_WIRE_H
+
+#include <Arduino.h>
+
+// ============================================================================
+// Wire (I2C) stand-in for the OLED render harness — transactions always
+// succeed and are tallied in oledBus (Adafruit_SSD1306.h)
+// ============================================================================
+
+class TwoWire {
+public:
+  void begin() {}
+  void setClock(uint32_t hz) { (void)hz; }
+  void beginTransmission(uint8_t addr);
+  size_t write(uint8_t b);
+  size_t write(const uint8_t* buf, size_t len);
+  uint8_t endTransmission(bool stop = true);
+
+private:
+  bool first = false;
+  bool dataMode = false;
+};
+
+extern TwoWire Wire;
+
+#endif // GHOST_OLED_WIRE_H
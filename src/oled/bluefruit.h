@@ -0,0 +1,12 @@
+#ifndef GHOST_OLED_BLUEFRUIT_H
+#define GHOST_OLED_BLUEFRUIT_H
+
+// Bluefruit stand-in — src/nrf52/state.h declares these objects; the render
+// harness never touches them
+#define BLE_CONN_HANDLE_INVALID 0xFFFF
+
+class BLEDis {};
+class BLEHidAdafruit {};
+class BLEUart {};
+
+#endif // GHOST_OLED_BLUEFRUIT_H
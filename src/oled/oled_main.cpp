@@ -0,0 +1,366 @@
+#ifndef PIO_UNIT_TESTING
+
+// The nRF52 display module is compiled into this file rather than linked, so
+// the harness can call its file-static draw*() functions and sendDirtyPages()
+// one at a time (env:oled excludes it from the normal source list).
+#include "../nrf52/display.cpp"
+
+#include <errno.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <algorithm>
+#include <vector>
+#include "host_hal.h"
+
+// ============================================================================
+// OLED render harness (env:oled)
+// Renders every UI screen of src/nrf52/display.cpp on the host against the
+// Adafruit_SSD1306 / GFX stand-ins in src/oled/, writes each to PNG, and
+// measures per-screen draw cost and the SSD1306 pages sendDirtyPages() would
+// push. Each screen is set up from defaults, then drawn for N frames at its
+// firmware refresh rate with the main loop running in between, so
+// animations and the simulation progress as on the device.
+//
+//   .pio/build/oled/program [--out DIR] [--frames N] [--scale N] [--seed N]
+//                           [--only NAME] [--all-frames] [--no-png]
+// ============================================================================
+
+// nRF52 globals display.cpp links against (src/nrf52/state.cpp on target)
+Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+bool displayInitialized = false;
+GameState gameState;
+int16_t cachedDieTempRaw = 0;
+void i2cBusRecovery() {}
+
+// I2C at 400 kHz, 9 bit times per byte (8 data + ACK)
+#define I2C_NS_PER_BYTE 22500UL
+
+struct Screen {
+  const char* name;         // PNG file stem
+  const char* fn;           // draw*() function under test
+  void (*setup)();
+  void (*draw)();
+  bool saver;               // screensaver refresh rate (DISPLAY_UPDATE_SAVER_MS)
+};
+
+// ----------------------------------------------------------------------------
+// Screen setups — the minimum UI state each screen needs, on top of defaults
+// ----------------------------------------------------------------------------
+
+// Same per-mode init as setup() in ghost_operator.cpp; games start playing
+static void setOp(uint8_t op) {
+  settings.operationMode = op;
+  if (op == OP_SIMULATION) initOrchestrator();
+  if (op == OP_BREAKOUT) { initBreakout(); breakoutButtonPress(); }
+  if (op == OP_SNAKE)    { initSnake(); snakeButtonPress(); }
+  if (op == OP_RACER)    { initRacer(); racerButtonPress(); }
+}
+
+// Game ticks the nRF52 loop() runs in place of the jiggler
+static void tickGame() {
+  switch (settings.operationMode) {
+    case OP_RACER:    tickRacer(); updateRacerSound(); break;
+    case OP_SNAKE:    tickSnake(); updateSnakeSound(); break;
+    case OP_BREAKOUT: tickBreakout(); updateGameSound(); break;
+    default: break;
+  }
+}
+
+static void enterNameEditor() {
+  int nameLen = strlen(settings.deviceName);
+  for (int i = 0; i < NAME_MAX_LEN; i++) {
+    if (i < nameLen) {
+      const char* found = strchr(NAME_CHARS, settings.deviceName[i]);
+      nameCharIndex[i] = found ? (uint8_t)(found - NAME_CHARS) : 0;
+    } else {
+      nameCharIndex[i] = NAME_CHAR_END;
+    }
+  }
+  currentMode = MODE_NAME;
+}
+
+static void enterCarousel(uint8_t settingId) {
+  carouselConfig = getCarouselConfig(settingId);
+  carouselCursor = (uint8_t)getSettingValue(settingId);
+  carouselOriginal = carouselCursor;
+  currentMode = MODE_CAROUSEL;
+}
+
+static const Screen SCREENS[] = {
+  // Normal screen per operation mode
+  { "simple",            "drawNormalMode",            [] { setOp(OP_SIMPLE); },      drawNormalMode,            false },
+  { "simulation",        "drawSimulationNormal",      [] { setOp(OP_SIMULATION); },  drawSimulationNormal,      false },
+  { "volume_basic",      "drawVolumeNormal",          [] { setOp(OP_VOLUME); settings.volumeTheme = 0; }, drawVolumeNormal, false },
+  { "volume_retro",      "drawVolumeNormal",          [] { setOp(OP_VOLUME); settings.volumeTheme = 1; }, drawVolumeNormal, false },
+  { "volume_futuristic", "drawVolumeNormal",          [] { setOp(OP_VOLUME); settings.volumeTheme = 2; }, drawVolumeNormal, false },
+  { "breakout",          "drawBreakoutNormal",        [] { setOp(OP_BREAKOUT); },    drawBreakoutNormal,        false },
+  { "snake",             "drawSnakeNormal",           [] { setOp(OP_SNAKE); },       drawSnakeNormal,           false },
+  { "racer",             "drawRacerNormal",           [] { setOp(OP_RACER); },       drawRacerNormal,           false },
+
+  // Footer animation styles (Simple mode)
+  { "anim_ecg",          "drawNormalMode",            [] { settings.animStyle = 0; }, drawNormalMode,           false },
+  { "anim_eq",           "drawNormalMode",            [] { settings.animStyle = 1; }, drawNormalMode,           false },
+  { "anim_ghost",        "drawNormalMode",            [] { settings.animStyle = 2; }, drawNormalMode,           false },
+  { "anim_matrix",       "drawNormalMode",            [] { settings.animStyle = 3; }, drawNormalMode,           false },
+  { "anim_radar",        "drawNormalMode",            [] { settings.animStyle = 4; }, drawNormalMode,           false },
+  { "anim_none",         "drawNormalMode",            [] { settings.animStyle = 5; }, drawNormalMode,           false },
+  { "easter_egg",        "drawNormalMode",            [] { easterEggActive = true; easterEggFrame = 1; }, drawNormalMode, false },
+
+  // Screensavers
+  { "saver_simple",      "drawScreensaver",           [] { setOp(OP_SIMPLE); screensaverActive = true; },     drawScreensaver,           true },
+  { "saver_simulation",  "drawSimulationScreensaver", [] { setOp(OP_SIMULATION); screensaverActive = true; }, drawSimulationScreensaver, true },
+
+  // UI modes
+  { "menu",              "drawMenuMode",              [] { currentMode = MODE_MENU; },        drawMenuMode,        false },
+  { "menu_simulation",   "drawMenuMode",              [] { setOp(OP_SIMULATION); currentMode = MODE_MENU; }, drawMenuMode, false },
+  { "slots",             "drawSlotsMode",             [] { currentMode = MODE_SLOTS; },       drawSlotsMode,       false },
+  { "click_slots",       "drawClickSlotsMode",        [] { currentMode = MODE_CLICK_SLOTS; }, drawClickSlotsMode,  false },
+  { "name",              "drawNameMode",              enterNameEditor,                        drawNameMode,        false },
+  { "decoy",             "drawDecoyMode",             [] { currentMode = MODE_DECOY; },       drawDecoyMode,       false },
+  { "schedule",          "drawScheduleMode",          [] { currentMode = MODE_SCHEDULE; },    drawScheduleMode,    false },
+  { "set_clock",         "drawSetClockMode",          [] { currentMode = MODE_SET_CLOCK; },   drawSetClockMode,    false },
+  { "mode_picker",       "drawModePickerPage",        [] { currentMode = MODE_MODE; },        drawModePickerPage,  false },
+  { "carousel_anim",     "drawCarouselPage",          [] { enterCarousel(SET_ANIMATION); },   drawCarouselPage,    false },
+  { "carousel_job",      "drawCarouselPage",          [] { enterCarousel(SET_JOB_SIM); },     drawCarouselPage,    false },
+
+  // Sleep overlays
+  { "sleep_confirm",     "drawSleepConfirm",          [] { sleepConfirmActive = true; sleepConfirmStart = millis(); }, drawSleepConfirm, false },
+  { "sleep_cancelled",   "drawSleepCancelled",        [] { sleepCancelActive = true; },       drawSleepCancelled,  false },
+  { "light_sleep",       "drawLightSleepBreathing",   [] {},                                  drawLightSleepBreathing, false },
+};
+static const uint8_t SCREEN_COUNT = sizeof(SCREENS) / sizeof(SCREENS[0]);
+
+// UI state hostSetup() leaves alone
+static void resetUiState() {
+  currentMode = MODE_NORMAL;
+  screensaverActive = false;
+  sleepConfirmActive = false;
+  sleepCancelActive = false;
+  easterEggActive = false;
+  easterEggFrame = 0;
+  carouselConfig = NULL;
+  menuCursor = 0;
+  menuScrollOffset = 0;
+  menuEditing = false;
+  memset(&gameState, 0, sizeof(gameState));
+  display.setRotation(0);
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE);
+  display.setTextWrap(true);
+}
+
+// ----------------------------------------------------------------------------
+// PNG — 1-bit grayscale, stored (uncompressed) deflate, same layout as
+// serialScreenshot() in src/nrf52/screenshot.cpp, optionally upscaled
+// ----------------------------------------------------------------------------
+
+static uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc) {
+  for (size_t i = 0; i < len; i++) {
+    crc ^= data[i];
+    for (uint8_t j = 0; j < 8; j++) crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+  }
+  return crc;
+}
+
+static void putU32(std::vector<uint8_t>& v, uint32_t x) {
+  v.push_back((uint8_t)(x >> 24));
+  v.push_back((uint8_t)(x >> 16));
+  v.push_back((uint8_t)(x >> 8));
+  v.push_back((uint8_t)x);
+}
+
+static void putChunk(FILE* f, const char* type, const std::vector<uint8_t>& data) {
+  std::vector<uint8_t> c;
+  putU32(c, (uint32_t)data.size());
+  c.insert(c.end(), type, type + 4);
+  c.insert(c.end(), data.begin(), data.end());
+  putU32(c, crc32(c.data() + 4, c.size() - 4, 0xFFFFFFFF) ^ 0xFFFFFFFF);
+  fwrite(c.data(), 1, c.size(), f);
+}
+
+static bool writePng(const char* path, const uint8_t* ssdBuf, uint8_t scale) {
+  const uint32_t w = SCREEN_WIDTH * scale, h = SCREEN_HEIGHT * scale;
+  const uint32_t rowBytes = (w + 7) / 8;
+
+  // Scanlines: filter byte 0 + packed pixels, white = lit
+  std::vector<uint8_t> raw;
+  raw.reserve((rowBytes + 1) * h);
+  for (uint32_t y = 0; y < h; y++) {
+    raw.push_back(0);
+    uint8_t sy = (uint8_t)(y / scale);
+    for (uint32_t bx = 0; bx < rowBytes; bx++) {
+      uint8_t packed = 0;
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        uint32_t sx = (bx * 8 + bit) / scale;
+        if (sx < SCREEN_WIDTH && (ssdBuf[sx + (sy / 8) * SCREEN_WIDTH] & (1 << (sy & 7)))) {
+          packed |= (uint8_t)(0x80 >> bit);
+        }
+      }
+      raw.push_back(packed);
+    }
+  }
+
+  // zlib stream of stored blocks (max 65535 bytes each)
+  std::vector<uint8_t> z = { 0x78, 0x01 };
+  for (size_t off = 0; off < raw.size() || off == 0; ) {
+    uint16_t n = (uint16_t)std::min<size_t>(65535, raw.size() - off);
+    bool last = off + n >= raw.size();
+    z.push_back(last ? 1 : 0);
+    z.push_back((uint8_t)n);
+    z.push_back((uint8_t)(n >> 8));
+    z.push_back((uint8_t)~n);
+    z.push_back((uint8_t)(~n >> 8));
+    z.insert(z.end(), raw.begin() + off, raw.begin() + off + n);
+    off += n;
+    if (last) break;
+  }
+  uint32_t a = 1, b = 0;
+  for (uint8_t byte : raw) {
+    a = (a + byte) % 65521;
+    b = (b + a) % 65521;
+  }
+  putU32(z, (b << 16) | a);
+
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  static const uint8_t SIG[] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+  fwrite(SIG, 1, sizeof(SIG), f);
+  std::vector<uint8_t> ihdr;
+  putU32(ihdr, w);
+  putU32(ihdr, h);
+  ihdr.insert(ihdr.end(), { 1, 0, 0, 0, 0 });  // 1-bit grayscale
+  putChunk(f, "IHDR", ihdr);
+  putChunk(f, "IDAT", z);
+  putChunk(f, "IEND", std::vector<uint8_t>());
+  fclose(f);
+  return true;
+}
+
+// ----------------------------------------------------------------------------
+// Frame loop
+// ----------------------------------------------------------------------------
+
+static uint64_t nowNs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+struct ScreenResult {
+  std::vector<uint32_t> drawNs;
+  std::vector<uint8_t> pages;      // per steady-state frame (frame 0 is a full send)
+  std::vector<uint32_t> wireBytes;
+};
+
+static void runScreen(const Screen& s, unsigned long seed, uint16_t frames,
+                      ScreenResult& r, const char* outDir, uint8_t scale, bool pngs, bool allFrames) {
+  hostSetup(seed);
+  resetUiState();
+  displayInitialized = true;
+  s.setup();
+  invalidateDisplayShadow();
+
+  unsigned long interval = s.saver ? DISPLAY_UPDATE_SAVER_MS : DISPLAY_UPDATE_MS;
+  char path[512];
+  for (uint16_t f = 0; f < frames; f++) {
+    if (f > 0) {
+      for (unsigned long ms = 0; ms < interval; ms++) {
+        hostClockAdvance(1);
+        hostLoop();
+        tickGame();
+      }
+    }
+
+    display.clearDisplay();
+    uint64_t t0 = nowNs();
+    s.draw();
+    uint64_t t1 = nowNs();
+
+    OledBusStats before = oledBus;
+    sendDirtyPages();
+    if (f > 0) {
+      r.drawNs.push_back((uint32_t)(t1 - t0));
+      r.pages.push_back((uint8_t)((oledBus.dataBytes - before.dataBytes) / SCREEN_WIDTH));
+      r.wireBytes.push_back(oledBus.wireBytes - before.wireBytes);
+    }
+
+    if (pngs && (allFrames || f == frames - 1)) {
+      if (allFrames) snprintf(path, sizeof(path), "%s/%s_%03u.png", outDir, s.name, f);
+      else           snprintf(path, sizeof(path), "%s/%s.png", outDir, s.name);
+      if (!writePng(path, display.getBuffer(), scale)) fprintf(stderr, "Cannot write %s\n", path);
+    }
+  }
+  display.setRotation(0);
+}
+
+template <typename T>
+static T pctOf(std::vector<T> v, double p) {
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  return v[(size_t)(p / 100.0 * (v.size() - 1) + 0.5)];
+}
+
+static void usage() {
+  printf("Usage: program [--out DIR] [--frames N] [--scale N] [--seed N]\n"
+         "               [--only NAME] [--all-frames] [--no-png]\n");
+}
+
+int main(int argc, char** argv) {
+  const char* outDir = ".pio/oled";
+  const char* only = NULL;
+  unsigned long seed = 1;
+  uint16_t frames = 40;
+  uint8_t scale = 4;
+  bool pngs = true, allFrames = false;
+
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+    if      (!strcmp(a, "--out") && v)    { outDir = v; i++; }
+    else if (!strcmp(a, "--only") && v)   { only = v; i++; }
+    else if (!strcmp(a, "--seed") && v)   { seed = strtoul(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--frames") && v) { frames = (uint16_t)max(2L, strtol(v, NULL, 0)); i++; }
+    else if (!strcmp(a, "--scale") && v)  { scale = (uint8_t)constrain(strtol(v, NULL, 0), 1L, 16L); i++; }
+    else if (!strcmp(a, "--all-frames"))  allFrames = true;
+    else if (!strcmp(a, "--no-png"))      pngs = false;
+    else { usage(); return 2; }
+  }
+  if (pngs && mkdir(outDir, 0755) != 0 && errno != EEXIST) {
+    perror(outDir);
+    return 1;
+  }
+
+  printf("%-18s %-26s %8s %8s %8s  %5s %5s %9s\n", "screen", "draw function",
+         "p50 ns", "p99 ns", "max ns", "pages", "max", "I2C ms");
+  uint8_t ran = 0;
+  for (uint8_t i = 0; i < SCREEN_COUNT; i++) {
+    const Screen& s = SCREENS[i];
+    if (only && !strstr(s.name, only)) continue;
+    ScreenResult r;
+    runScreen(s, seed, frames, r, outDir, scale, pngs, allFrames);
+    ran++;
+
+    double avgPages = 0, avgWire = 0;
+    for (size_t k = 0; k < r.pages.size(); k++) {
+      avgPages += r.pages[k];
+      avgWire += r.wireBytes[k];
+    }
+    avgPages /= r.pages.size();
+    avgWire /= r.wireBytes.size();
+    printf("%-18s %-26s %8u %8u %8u  %5.2f %5u %9.2f\n", s.name, s.fn,
+           pctOf(r.drawNs, 50), pctOf(r.drawNs, 99), pctOf(r.drawNs, 100),
+           avgPages, pctOf(r.pages, 100), avgWire * I2C_NS_PER_BYTE / 1e6);
+  }
+  if (ran == 0) {
+    fprintf(stderr, "No screen matches \"%s\"\n", only);
+    return 2;
+  }
+
+  printf("\n%u frames per screen (first frame, a full send, not counted). pages = "
+         "SSD1306 pages\nsendDirtyPages() pushed per frame (of 8); I2C ms = mean bus "
+         "time per frame at 400 kHz.\n", frames);
+  if (pngs) printf("PNGs (x%u) in %s/\n", scale, outDir);
+  return 0;
+}
+
+#endif // PIO_UNIT_TESTING
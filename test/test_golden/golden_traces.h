@@ -0,0 +1,79 @@
+#ifndef GHOST_GOLDEN_TRACES_H
+#define GHOST_GOLDEN_TRACES_H
+
+#include <stdint.h>
+#include "config.h"
+
+// ============================================================================
+// Golden HID traces — hourly checkpoints of each seeded run:
+// cumulative report count and running FNV-1a hash of (ms, reportId, payload).
+// Regenerate by pasting the "actual:" rows a failing run prints. The
+// fixed-point motion path (GHOST_MOTION_FIXED, default on the C6) rounds
+// differently from float, so it has its own table (env:native_fixed).
+// ============================================================================
+
+#define GOLDEN_MAX_HOURS 9
+
+struct GoldenCase {
+  const char* name;
+  uint8_t operationMode;   // OP_SIMPLE / OP_SIMULATION
+  uint8_t job;             // DAY_TEMPLATES index
+  uint8_t perf;            // jobPerformance 0-11
+  uint8_t mouseStyle;      // 0=Bezier, 1=Brownian, 2=Reach
+  uint32_t seed;
+  uint8_t hours;
+  uint32_t events[GOLDEN_MAX_HOURS];
+  uint32_t hashes[GOLDEN_MAX_HOURS];
+};
+
+#if GHOST_MOTION_FIXED
+static const GoldenCase GOLDEN_CASES[] = {
+  { "staff", 1, 0, 5, 0, 1, 2,
+    { 28731, 57312 },
+    { 0x7EF2AB36, 0xA7884EC5 } },
+  { "developer", 1, 1, 5, 0, 42, 9,
+    { 28356, 50110, 72237, 93720, 120129, 145637, 165457, 192648, 222448 },
+    { 0x758CF05C, 0xEF83B0C2, 0x7836E357, 0x8606DC70, 0x4FE49E6C, 0x76FEBD5E, 0x8CD7BD77, 0x5BDC3518, 0x67B16886 } },
+  { "designer", 1, 2, 5, 0, 7, 2,
+    { 30949, 60283 },
+    { 0xDDFAD88B, 0x912053E2 } },
+  { "developer-p2", 1, 1, 2, 1, 1234, 2,
+    { 15247, 22122 },
+    { 0x59C9A052, 0x3B3B765F } },
+  { "simple-bezier", 0, 0, 5, 0, 5, 1,
+    { 32607 },
+    { 0xEAAAA971 } },
+  { "simple-brownian", 0, 0, 5, 1, 9, 1,
+    { 33430 },
+    { 0x3DF0D33B } },
+  { "simple-reach", 0, 0, 5, 2, 11, 1,
+    { 21237 },
+    { 0x5E19FAB6 } },
+};
+#else
+static const GoldenCase GOLDEN_CASES[] = {
+  { "staff", 1, 0, 5, 0, 1, 2,
+    { 28730, 57312 },
+    { 0xE5E07B49, 0x920D70E6 } },
+  { "developer", 1, 1, 5, 0, 42, 9,
+    { 28356, 50111, 72237, 93722, 120128, 145635, 165457, 192654, 222454 },
+    { 0x755D4934, 0x477395F0, 0x093FFC7C, 0xCE0BF83F, 0x75996646, 0xD0CFBA97, 0x86D09252, 0x51F9E7B0, 0x5A90C570 } },
+  { "designer", 1, 2, 5, 0, 7, 2,
+    { 30951, 60287 },
+    { 0x9E3484A9, 0x5EE2513B } },
+  { "developer-p2", 1, 1, 2, 1, 1234, 2,
+    { 15268, 22143 },
+    { 0x6E09ADA2, 0x394D0C35 } },
+  { "simple-bezier", 0, 0, 5, 0, 5, 1,
+    { 32611 },
+    { 0x68CCE923 } },
+  { "simple-brownian", 0, 0, 5, 1, 9, 1,
+    { 33423 },
+    { 0xDB48DDD0 } },
+  { "simple-reach", 0, 0, 5, 2, 11, 1,
+    { 21238 },
+    { 0x83784E16 } },
+};
+#endif
+
+#endif // GHOST_GOLDEN_TRACES_H
@@ -0,0 +1,409 @@
+#include <unity.h>
+#include <Arduino.h>
+#include "state.h"
+#include "orchestrator.h"
+#include "host_hal.h"
+#include "hid_hires.h"
+#include "mouse_trace_pure.h"
+#include "platform_hal.h"
+#include "settings.h"
+#include "timers.h"
+#include "golden_traces.h"
+
+// ============================================================================
+// Golden HID-trace regression suite
+// Runs seeded simulations of src/common on the host platform (src/native/)
+// and compares a running FNV-1a hash of every HID report against the hourly
+// checkpoints in golden_traces.h. Any behavior change in the orchestrator or
+// mouse engines shows up as a hash mismatch at the first hour it diverges.
+//
+// After an intentional behavior change, copy the "actual" rows printed by the
+// failing tests into golden_traces.h.
+// ============================================================================
+
+void setUp() {}
+void tearDown() {}
+
+static uint32_t traceHash;
+static uint32_t traceEvents;
+static unsigned long traceStartMs;
+
+static inline void fnvByte(uint8_t b) {
+  traceHash ^= b;
+  traceHash *= 16777619u;
+}
+
+static void onReport(const HostHidReport& r) {
+  uint32_t t = (uint32_t)(r.ms - traceStartMs);
+  fnvByte((uint8_t)t);
+  fnvByte((uint8_t)(t >> 8));
+  fnvByte((uint8_t)(t >> 16));
+  fnvByte((uint8_t)(t >> 24));
+  fnvByte(r.reportId);
+  for (uint8_t i = 0; i < r.len; i++) fnvByte(r.data[i]);
+  traceEvents++;
+}
+
+static void printActual(const GoldenCase& g, const uint32_t* events, const uint32_t* hashes) {
+  printf("actual: { \"%s\", %u, %u, %u, %u, %lu, %u,\n    {", g.name, g.operationMode,
+         g.job, g.perf, g.mouseStyle, (unsigned long)g.seed, g.hours);
+  for (uint8_t h = 0; h < g.hours; h++) printf("%s%lu", h ? ", " : " ", (unsigned long)events[h]);
+  printf(" },\n    {");
+  for (uint8_t h = 0; h < g.hours; h++) printf("%s0x%08lX", h ? ", " : " ", (unsigned long)hashes[h]);
+  printf(" } },\n");
+}
+
+// wakeDriven: jump the clock to each hostLoop() wake time instead of
+// stepping every millisecond — the trace must not change
+static void runGolden(const GoldenCase& g, bool wakeDriven = false) {
+  uint32_t events[GOLDEN_MAX_HOURS];
+  uint32_t hashes[GOLDEN_MAX_HOURS];
+
+  traceHash = 2166136261u;
+  traceEvents = 0;
+  hostClockSet(1000);
+  hostSetHidSink(onReport);
+  hostSetup(g.seed);
+  settings.operationMode = g.operationMode;
+  settings.jobSimulation = g.job;
+  settings.jobPerformance = g.perf;
+  settings.mouseStyle = g.mouseStyle;
+  if (g.operationMode == OP_SIMULATION) initOrchestrator();
+
+  traceStartMs = hostClockMs();
+  unsigned long nextMark = 3600000UL;
+  uint8_t hour = 0;
+  for (unsigned long now = traceStartMs; hour < g.hours; ) {
+    hostClockSet(now);
+    unsigned long wake = hostLoop();
+    // Record every checkpoint the clock has reached
+    while (hour < g.hours && hostClockMs() - traceStartMs >= nextMark) {
+      events[hour] = traceEvents;
+      hashes[hour] = traceHash;
+      hour++;
+      nextMark += 3600000UL;
+    }
+    now = hostClockMs() + 1;
+    if (wakeDriven) {
+      // Stop at the next mark so its checkpoint holds the same reports
+      if ((long)(traceStartMs + nextMark - wake) < 0) wake = traceStartMs + nextMark;
+      if ((long)(wake - now) > 0) now = wake;
+    }
+  }
+  hostSetHidSink(NULL);
+
+  bool match = true;
+  for (uint8_t h = 0; h < g.hours; h++) {
+    if (events[h] != g.events[h] || hashes[h] != g.hashes[h]) { match = false; break; }
+  }
+  if (!match) printActual(g, events, hashes);
+
+  char msg[64];
+  for (uint8_t h = 0; h < g.hours; h++) {
+    snprintf(msg, sizeof(msg), "%s: report count diverges in hour %u", g.name, h + 1);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(g.events[h], events[h], msg);
+    snprintf(msg, sizeof(msg), "%s: report stream diverges in hour %u", g.name, h + 1);
+    TEST_ASSERT_EQUAL_HEX32_MESSAGE(g.hashes[h], hashes[h], msg);
+  }
+}
+
+void test_golden_staff()              { runGolden(GOLDEN_CASES[0]); }
+void test_golden_developer_full_day() { runGolden(GOLDEN_CASES[1]); }
+void test_golden_designer()           { runGolden(GOLDEN_CASES[2]); }
+void test_golden_developer_low_perf() { runGolden(GOLDEN_CASES[3]); }
+void test_golden_simple_bezier()      { runGolden(GOLDEN_CASES[4]); }
+void test_golden_simple_brownian()    { runGolden(GOLDEN_CASES[5]); }
+void test_golden_simple_reach()       { runGolden(GOLDEN_CASES[6]); }
+
+void test_golden_wake_driven_loop() {
+  // Every deadline the loop sleeps until must be exact: skipping the passes
+  // in between has to leave every golden trace unchanged
+  for (size_t i = 0; i < sizeof(GOLDEN_CASES) / sizeof(GOLDEN_CASES[0]); i++) {
+    runGolden(GOLDEN_CASES[i], true);
+  }
+}
+
+void test_golden_same_seed_repeats() {
+  // Back-to-back runs in one process must not leak state into each other
+  runGolden(GOLDEN_CASES[0]);
+}
+
+// Mouse reports as sent: every return home has to land on the origin, and
+// on an idle BLE connection interval (60ms) no two moves may be closer
+static unsigned long lastMoveMs;
+static uint32_t shortMoveGaps;
+static int32_t sentNetX, sentNetY;
+
+static void onCoalescedReport(const HostHidReport& r) {
+  if (r.reportId != RID_MOUSE || (r.data[1] == 0 && r.data[2] == 0)) return;
+  if (lastMoveMs && r.ms - lastMoveMs < 60) shortMoveGaps++;
+  lastMoveMs = r.ms;
+  sentNetX += (int8_t)r.data[1];
+  sentNetY += (int8_t)r.data[2];
+}
+
+struct SimpleDay {
+  uint32_t returns;               // jiggles that came home
+  unsigned long longestReturnMs;  // RETURNING → IDLE
+  uint32_t blockedPasses;         // loop passes that moved the clock
+};
+
+// Simple mode (unless configure() picks another) for dayMs at 1 ms per
+// pass, or from wake to wake (wakeDriven), run on in Simple mode until the
+// mouse is home. The sink must pass mouse reports to onCoalescedReport():
+// each Simple mode return home is checked against the origin.
+static SimpleDay runSimpleDay(unsigned long seed, HostHidSink sink, void (*configure)(),
+                              unsigned long dayMs = 1800000UL, bool wakeDriven = false) {
+  SimpleDay day = {};
+  lastMoveMs = 0;
+  shortMoveGaps = 0;
+  sentNetX = sentNetY = 0;
+  hostClockSet(1000);
+  hostSetHidSink(sink);
+  hostSetup(seed);
+  settings.operationMode = OP_SIMPLE;
+  if (configure) configure();
+  bool simple = (settings.operationMode == OP_SIMPLE);
+  if (settings.operationMode == OP_SIMULATION) initOrchestrator();
+
+  unsigned long start = hostClockMs(), returnStart = start;
+  MouseState prev = mouseState;
+  unsigned long now = start;
+  while (now - start < dayMs || (simple && mouseState != MOUSE_IDLE)) {
+    hostClockSet(now);
+    unsigned long wake = hostLoop();
+    if (hostClockMs() != now) day.blockedPasses++;
+    if (simple && prev != MOUSE_RETURNING && mouseState == MOUSE_RETURNING) returnStart = now;
+    if (simple && prev == MOUSE_RETURNING && mouseState == MOUSE_IDLE) {
+      TEST_ASSERT_EQUAL_INT32(0, sentNetX);
+      TEST_ASSERT_EQUAL_INT32(0, sentNetY);
+      if (now - returnStart > day.longestReturnMs) day.longestReturnMs = now - returnStart;
+      day.returns++;
+    }
+    prev = mouseState;
+    now = hostClockMs() + 1;
+    if (wakeDriven && (long)(wake - now) > 0) now = wake;
+  }
+  hostSetHidSink(NULL);
+  return day;
+}
+
+// Per-run option the configure() callbacks below read
+static uint8_t runOption;
+
+static void configureCoalesced() {
+  hostSetHidIntervalMs(60);
+  settings.mouseStyle = runOption;
+}
+
+void test_coalesced_moves_return_to_origin() {
+  // Idle BLE connection interval: moves must be coalesced to one report per
+  // 60ms event, and every jiggle must still return exactly to its origin
+  for (runOption = 0; runOption < MOUSE_STYLE_COUNT; runOption++) {
+    SimpleDay day = runSimpleDay(77, onCoalescedReport, configureCoalesced);
+    TEST_ASSERT_TRUE(day.returns > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, shortMoveGaps);
+  }
+}
+
+static void configureLongJiggles() {
+  settings.mouseStyle = runOption;
+  settings.mouseAmplitude = 5;
+}
+
+void test_return_home_is_bounded_and_exact() {
+  // Long Brownian jiggles build the largest offsets; the curved return must
+  // still land exactly on the origin within RETURN_DURATION_MAX_MS
+  for (runOption = 0; runOption < MOUSE_STYLE_COUNT; runOption++) {
+    SimpleDay day = runSimpleDay(31, onCoalescedReport, configureLongJiggles);
+    TEST_ASSERT_TRUE(day.returns > 0);
+    TEST_ASSERT_TRUE(day.longestReturnMs <= RETURN_DURATION_MAX_MS + MOUSE_MOVE_STEP_MS);
+  }
+}
+
+// Hi-res wheel: every detent arrives as HIRES_SCROLL_MULTIPLIER units spread
+// over several reports; at 1 unit it stays one report per detent
+static int32_t wheelAbsSum;
+static uint32_t wheelReports, mouseReports;
+static int8_t wheelMaxStep;
+
+static void onWheelReport(const HostHidReport& r) {
+  onCoalescedReport(r);
+  if (r.reportId != RID_MOUSE) return;
+  mouseReports++;
+  int8_t w = (int8_t)r.data[3];
+  if (w == 0) return;
+  wheelReports++;
+  wheelAbsSum += w < 0 ? -w : w;
+  if (abs(w) > wheelMaxStep) wheelMaxStep = (int8_t)abs(w);
+}
+
+static uint32_t scrollClicksAtStart;
+
+static void configureScroll() {
+  hostSetHidIntervalMs(60);
+  hostSetHidScrollUnits(runOption);
+  settings.scrollEnabled = 1;
+  scrollClicksAtStart = stats.totalMouseClicks;
+}
+
+// Returns the number of detents injected; the day runs on until the last
+// jiggle has returned, so no ramp is cut short
+static uint32_t runScrollDay(uint8_t units) {
+  wheelAbsSum = 0;
+  wheelReports = mouseReports = 0;
+  wheelMaxStep = 0;
+  runOption = units;
+  runSimpleDay(53, onWheelReport, configureScroll);
+  return stats.totalMouseClicks - scrollClicksAtStart;
+}
+
+void test_hires_scroll_ramps_whole_detents() {
+  uint32_t detents = runScrollDay(1);
+  uint32_t baseReports = mouseReports;
+  TEST_ASSERT_TRUE(detents > 0);
+  TEST_ASSERT_EQUAL_INT32((int32_t)detents, wheelAbsSum);
+  TEST_ASSERT_EQUAL_UINT32(detents, wheelReports);
+
+  detents = runScrollDay(HIRES_SCROLL_MULTIPLIER);
+  TEST_ASSERT_TRUE(detents > 0);
+  TEST_ASSERT_EQUAL_INT32((int32_t)(detents * HIRES_SCROLL_MULTIPLIER), wheelAbsSum);
+  TEST_ASSERT_TRUE(wheelReports > detents);                 // ramped, not one jump
+  TEST_ASSERT_TRUE(wheelMaxStep < HIRES_SCROLL_MULTIPLIER);
+  // Ramp steps ride along with moves; only ramps during pauses (or past the
+  // return home) add reports — a fraction of the ramp's steps per detent
+  TEST_ASSERT_TRUE(mouseReports <= baseReports + detents * SCROLL_RAMP_STEPS / 4);
+}
+
+// Replay: a stored horizontal-only trace drives every jiggle move (mirroring
+// may flip x, never adds y); without a trace the style falls back to sweeps
+static uint32_t jiggleMoves, jiggleMovesOffAxis;
+
+static void onReplayReport(const HostHidReport& r) {
+  onCoalescedReport(r);
+  if (r.reportId != RID_MOUSE || mouseState != MOUSE_JIGGLING) return;
+  if (r.data[1] == 0 && r.data[2] == 0) return;
+  jiggleMoves++;
+  if (r.data[2] != 0) jiggleMovesOffAxis++;
+}
+
+static void configureReplay() {
+  settings.mouseStyle = MOUSE_STYLE_REPLAY;
+}
+
+static uint32_t runReplay() {
+  jiggleMoves = jiggleMovesOffAxis = 0;
+  return runSimpleDay(19, onReplayReport, configureReplay).returns;
+}
+
+void test_replay_plays_stored_trace() {
+  MouseTraceSample s[120];
+  for (int i = 0; i < 120; i++) s[i] = { 8, (int16_t)(i < 60 ? 3 : -2), 0 };
+  uint8_t buf[64];
+  size_t len = mouse_trace_encode(s, 120, buf, sizeof(buf));
+  TEST_ASSERT_TRUE(len > 0);
+  TEST_ASSERT_TRUE(mouseTraceWrite(2, 0, buf, (uint16_t)len));
+
+  TEST_ASSERT_TRUE(runReplay() > 0);
+  TEST_ASSERT_TRUE(jiggleMoves > 0);
+  TEST_ASSERT_EQUAL_UINT32(0, jiggleMovesOffAxis);
+
+  mouseTraceErase(2);
+  TEST_ASSERT_TRUE(runReplay() > 0);
+  TEST_ASSERT_TRUE(jiggleMovesOffAxis > 0);   // Bezier sweeps curve
+}
+
+// Key presses (bursts, keepalive taps, Simple mode) are released by the
+// emitter's press/release scheduler: the loop never blocks on a hold, no
+// press lands on a key still down, and no key stays down past an M+K hold
+static bool keyIsDown;
+static unsigned long keyDownAtMs;
+static uint32_t keyPresses, keyPressesWhileDown;
+static unsigned long longestKeyHoldMs;
+
+static void onKeyReport(const HostHidReport& r) {
+  onCoalescedReport(r);
+  if (r.reportId != RID_KEYBOARD) return;
+  bool down = false;
+  for (uint8_t i = 0; i < 8; i++) if (r.data[i]) down = true;
+  if (down) {
+    if (keyIsDown) keyPressesWhileDown++;
+    keyPresses++;
+    keyDownAtMs = r.ms;
+  } else if (keyIsDown && r.ms - keyDownAtMs > longestKeyHoldMs) {
+    longestKeyHoldMs = r.ms - keyDownAtMs;
+  }
+  keyIsDown = down;
+}
+
+static void configureKeyTaps() {
+  settings.operationMode = runOption;
+  settings.jobSimulation = 0;   // Staff — long non-typing phases, so keepalive runs
+  settings.windowSwitching = false;
+}
+
+void test_key_taps_never_block_the_loop() {
+  for (runOption = OP_SIMPLE; runOption <= OP_SIMULATION; runOption++) {
+    keyIsDown = false;
+    keyPresses = keyPressesWhileDown = 0;
+    longestKeyHoldMs = 0;
+    // Wake to wake, as the firmware loop sleeps: a pass must never move the clock
+    SimpleDay day = runSimpleDay(5, onKeyReport, configureKeyTaps, 4 * 3600000UL, true);
+    TEST_ASSERT_EQUAL_UINT32(0, day.blockedPasses);
+    TEST_ASSERT_TRUE(keyPresses > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, keyPressesWhileDown);
+    TEST_ASSERT_TRUE(longestKeyHoldMs <= MSKB_KEY_HOLD_MAX_MS + MSKB_STROKE_DUR_MS);
+  }
+}
+
+// The settings and stats saves run from loop()'s timer wheel: each change
+// restarts the settings debounce, and dirty stats go out once per interval
+void test_deferred_saves_run_from_loop_timers() {
+  loopTimersInit(0);
+  startSaveTimers(0);
+  statsDirty = true;
+  hostClockSet(1000);
+  markSettingsDirty();
+  hostClockSet(4000);
+  markSettingsDirty();
+  loopTimersRun(1000 + SETTINGS_SAVE_DEBOUNCE_MS);
+  TEST_ASSERT_TRUE(settingsDirty);
+  loopTimersRun(4000 + SETTINGS_SAVE_DEBOUNCE_MS);
+  TEST_ASSERT_FALSE(settingsDirty);
+  TEST_ASSERT_TRUE(statsDirty);
+
+  // Sleep from deadline to deadline, as loop() does (a far timer's
+  // deadline can be an earlier cascade point)
+  unsigned long due = 0;
+  uint32_t wakes = 0;
+  while (statsDirty && loopTimersDeadline(due) && wakes++ < 16) {
+    TEST_ASSERT_TRUE(due <= STATS_SAVE_INTERVAL_MS);
+    loopTimersRun(due);
+  }
+  TEST_ASSERT_FALSE(statsDirty);
+  TEST_ASSERT_EQUAL_UINT32(STATS_SAVE_INTERVAL_MS, due);
+  TEST_ASSERT_TRUE(loopTimersDeadline(due));   // re-armed for the next interval
+  TEST_ASSERT_TRUE(due > STATS_SAVE_INTERVAL_MS && due <= 2 * STATS_SAVE_INTERVAL_MS);
+}
+
+int main() {
+  UNITY_BEGIN();
+
+  RUN_TEST(test_golden_staff);
+  RUN_TEST(test_golden_developer_full_day);
+  RUN_TEST(test_golden_designer);
+  RUN_TEST(test_golden_developer_low_perf);
+  RUN_TEST(test_golden_simple_bezier);
+  RUN_TEST(test_golden_simple_brownian);
+  RUN_TEST(test_golden_simple_reach);
+  RUN_TEST(test_golden_wake_driven_loop);
+  RUN_TEST(test_golden_same_seed_repeats);
+  RUN_TEST(test_coalesced_moves_return_to_origin);
+  RUN_TEST(test_return_home_is_bounded_and_exact);
+  RUN_TEST(test_hires_scroll_ramps_whole_detents);
+  RUN_TEST(test_replay_plays_stored_trace);
+  RUN_TEST(test_key_taps_never_block_the_loop);
+  RUN_TEST(test_deferred_saves_run_from_loop_timers);
+
+  return UNITY_END();
+}
@@ -0,0 +1,80 @@
+#include <unity.h>
+#include "alias_pure.h"
+
+// ============================================================================
+// Alias-method sampler: exact probabilities, degenerate pools, draw mapping
+// ============================================================================
+
+// Each outcome's share of the table in 2^-32 / count units: column c is
+// hit 1/count of the time, keeps c with keep[c] / 2^32 and takes alias[c]
+// otherwise
+template <uint8_t N>
+static void tableMass(const AliasTable<N>& t, uint64_t* mass) {
+  for (uint8_t i = 0; i < t.count; i++) mass[i] = 0;
+  for (uint8_t c = 0; c < t.count; c++) {
+    uint64_t keep = (t.alias[c] == c) ? (1ULL << 32) : t.keep[c];
+    mass[c] += keep;
+    mass[t.alias[c]] += (1ULL << 32) - keep;
+  }
+}
+
+void test_alias_table_matches_weights() {
+  // Block-mode pools, profile weights and the next-phase split (ppm)
+  static const uint32_t pools[][5] = {
+    { 40, 25, 20, 10, 5 },
+    { 1, 0, 0, 0, 0 },
+    { 0, 0, 7, 0, 0 },
+    { 33, 33, 34, 0, 0 },
+    { 200000, 64000, 32000, 7040 * 65, 7040 * 35 },
+    { 255, 1, 255, 1, 255 },
+  };
+  static const uint8_t counts[] = { 5, 1, 5, 3, 5, 5 };
+  for (uint8_t p = 0; p < sizeof(counts); p++) {
+    AliasTable<5> t;
+    TEST_ASSERT_TRUE(alias_build(t, pools[p], counts[p]));
+    TEST_ASSERT_EQUAL_UINT8(counts[p], t.count);
+    uint64_t total = 0;
+    for (uint8_t i = 0; i < counts[p]; i++) total += pools[p][i];
+    uint64_t mass[5];
+    tableMass(t, mass);
+    for (uint8_t i = 0; i < counts[p]; i++) {
+      // Exact share, off by at most one unit per column from rounding keep[]
+      uint64_t exact = (((uint64_t)pools[p][i] * counts[p]) << 32) / total;
+      uint64_t err = (mass[i] > exact) ? mass[i] - exact : exact - mass[i];
+      TEST_ASSERT_TRUE(err <= counts[p]);
+    }
+  }
+}
+
+void test_alias_table_rejects_empty_pools() {
+  static const uint32_t zero[3] = { 0, 0, 0 };
+  static const uint32_t some[3] = { 1, 2, 3 };
+  static const uint32_t huge[2] = { 0xFFFFFFFFu, 1 };
+  AliasTable<3> t;
+  TEST_ASSERT_FALSE(alias_build(t, zero, 3));
+  TEST_ASSERT_EQUAL_UINT8(0, t.count);
+  TEST_ASSERT_FALSE(alias_build(t, some, 0));
+  TEST_ASSERT_FALSE(alias_build(t, some, 4));   // more outcomes than the table holds
+  AliasTable<2> h;
+  TEST_ASSERT_FALSE(alias_build(h, huge, 2));   // sum past 32 bits
+}
+
+// Sweeping the 32-bit draw evenly hits each outcome in proportion to its
+// weight, and a zero-weight outcome never comes up
+void test_alias_pick_sweep_follows_weights() {
+  static const uint32_t w[4] = { 50, 0, 30, 20 };
+  AliasTable<4> t;
+  TEST_ASSERT_TRUE(alias_build(t, w, 4));
+  uint32_t hits[4] = { 0, 0, 0, 0 };
+  const uint32_t samples = 1u << 16;
+  for (uint32_t i = 0; i < samples; i++) {
+    uint32_t r = i * (0xFFFFFFFFu / samples) + 12345u;
+    uint8_t k = alias_pick(t, r);
+    TEST_ASSERT_TRUE(k < 4);
+    hits[k]++;
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, hits[1]);
+  for (uint8_t i = 0; i < 4; i++) {
+    TEST_ASSERT_UINT32_WITHIN(samples / 200, samples * w[i] / 100, hits[i]);
+  }
+}
@@ -0,0 +1,59 @@
+#include <unity.h>
+#include "day_timeline_pure.h"
+#include "rng_pure.h"
+
+// ============================================================================
+// Day timeline: prefix sums and block lookup against a linear walk
+// ============================================================================
+
+// The walk syncOrchestratorTime() used before the table: first block whose
+// cumulative end lies past the offset, skipping zero-length blocks
+static uint8_t walkFind(const uint16_t* dur, uint8_t n, uint32_t offsetMin) {
+  uint16_t cumulative = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    if (dur[i] == 0) continue;
+    uint16_t blockEnd = cumulative + dur[i];
+    if (offsetMin < blockEnd) return i;
+    cumulative = blockEnd;
+  }
+  return n;
+}
+
+void test_day_timeline_spans() {
+  // Seven blocks, a 30 min lunch fourth
+  static const uint16_t dur[] = { 68, 137, 68, 30, 102, 68, 37 };
+  DayTimeline<12> t;
+  timeline_build(t, dur, 7);
+  TEST_ASSERT_EQUAL_UINT8(7, t.numBlocks);
+  TEST_ASSERT_EQUAL_UINT16(0, timeline_start(t, 0));
+  TEST_ASSERT_EQUAL_UINT16(273, timeline_start(t, 3));
+  TEST_ASSERT_EQUAL_UINT16(510, timeline_start(t, 7));
+  TEST_ASSERT_EQUAL_UINT16(30, timeline_duration(t, 3));
+  TEST_ASSERT_EQUAL_UINT16(0, timeline_duration(t, 7));
+  TEST_ASSERT_EQUAL_UINT8(0, timeline_find(t, 0));
+  TEST_ASSERT_EQUAL_UINT8(0, timeline_find(t, 67));
+  TEST_ASSERT_EQUAL_UINT8(1, timeline_find(t, 68));
+  TEST_ASSERT_EQUAL_UINT8(3, timeline_find(t, 273));
+  TEST_ASSERT_EQUAL_UINT8(6, timeline_find(t, 509));
+  TEST_ASSERT_EQUAL_UINT8(7, timeline_find(t, 510));
+  TEST_ASSERT_EQUAL_UINT8(7, timeline_find(t, 86400));
+}
+
+// Skipped (zero-length) blocks anywhere, including first and last
+void test_day_timeline_find_matches_walk() {
+  RngState rng;
+  rng_seed_state(&rng, 0xDA7u);
+  for (uint16_t round = 0; round < 500; round++) {
+    uint8_t n = (uint8_t)(1 + rng_below(&rng, 12));
+    uint16_t dur[12];
+    for (uint8_t i = 0; i < n; i++) {
+      dur[i] = rng_below(&rng, 4) == 0 ? 0 : (uint16_t)(1 + rng_below(&rng, 150));
+    }
+    DayTimeline<12> t;
+    timeline_build(t, dur, n);
+    uint32_t end = timeline_start(t, n);
+    for (uint32_t m = 0; m <= end + 2; m++) {
+      TEST_ASSERT_EQUAL_UINT8(walkFind(dur, n, m), timeline_find(t, m));
+    }
+  }
+}
@@ -0,0 +1,98 @@
+#include <unity.h>
+#include "hid_emit_pure.h"
+
+// ============================================================================
+// HID emission timing: timed step queue and drift-free cadence
+// ============================================================================
+
+void test_hid_time_compare_across_wrap() {
+  TEST_ASSERT_TRUE(hid_time_reached(5, 0xFFFFFFF0u));   // 21 ms after, wrapped
+  TEST_ASSERT_FALSE(hid_time_reached(0xFFFFFFF0u, 5));
+  TEST_ASSERT_TRUE(hid_time_before(0xFFFFFFF0u, 5));
+  TEST_ASSERT_TRUE(hid_time_reached(100, 100));
+  bool any = false;
+  uint32_t due = 0;
+  hid_deadline_fold(any, due, 10);
+  hid_deadline_fold(any, due, 0xFFFFFFFAu);             // earlier, before the wrap
+  TEST_ASSERT_TRUE(any);
+  TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFAu, due);
+}
+
+void test_hid_step_queue_releases_in_due_order() {
+  HidStepQueue q = HidStepQueue();
+  hid_step_push(q, 120, 3, -1);
+  hid_step_push(q, 140, 2, 0);
+  uint32_t due;
+  TEST_ASSERT_TRUE(hid_step_next_due(q, due));
+  TEST_ASSERT_EQUAL_UINT32(120, due);
+  int16_t dx, dy;
+  TEST_ASSERT_FALSE(hid_step_pop_due(q, 119, dx, dy));
+  TEST_ASSERT_TRUE(hid_step_pop_due(q, 120, dx, dy));
+  TEST_ASSERT_EQUAL_INT16(3, dx);
+  TEST_ASSERT_EQUAL_INT16(-1, dy);
+  TEST_ASSERT_FALSE(hid_step_pop_due(q, 139, dx, dy));
+  TEST_ASSERT_TRUE(hid_step_pop_due(q, 200, dx, dy));
+  TEST_ASSERT_EQUAL_INT16(2, dx);
+  TEST_ASSERT_FALSE(hid_step_pending(q));
+}
+
+void test_hid_step_queue_full_merges_without_loss() {
+  HidStepQueue q = HidStepQueue();
+  for (uint32_t i = 0; i < HID_EMIT_QUEUE_LEN + 4; i++) hid_step_push(q, 1000 + i * 20, 1, -2);
+  hid_step_push(q, 900, 5, 0);   // out of order: raised to the tail's time
+  int32_t sumX = 0, sumY = 0;
+  int16_t dx, dy;
+  uint8_t pops = 0;
+  while (hid_step_pop_due(q, 5000, dx, dy)) { sumX += dx; sumY += dy; pops++; }
+  TEST_ASSERT_EQUAL_UINT8(HID_EMIT_QUEUE_LEN, pops);
+  TEST_ASSERT_EQUAL_INT32(HID_EMIT_QUEUE_LEN + 4 + 5, sumX);
+  TEST_ASSERT_EQUAL_INT32(-2 * (HID_EMIT_QUEUE_LEN + 4), sumY);
+}
+
+void test_hid_cadence_does_not_drift_when_late() {
+  uint32_t last = 1000, due;
+  // Ticks arrive 7 ms late every time — steps stay on the 20 ms grid
+  uint32_t expect = 1020;
+  for (uint32_t now = 1027; now < 1300; now += 20) {
+    TEST_ASSERT_TRUE(hid_cadence_next(last, now, 20, 0, 80, due));
+    TEST_ASSERT_EQUAL_UINT32(expect, due);
+    TEST_ASSERT_FALSE(hid_cadence_next(last, now, 20, 0, 80, due));
+    expect += 20;
+  }
+}
+
+void test_hid_cadence_catches_up_then_resyncs() {
+  uint32_t last = 1000, due;
+  // 50 ms late: the two missed steps come out back to back
+  TEST_ASSERT_TRUE(hid_cadence_next(last, 1070, 20, 0, 80, due));
+  TEST_ASSERT_EQUAL_UINT32(1020, due);
+  TEST_ASSERT_TRUE(hid_cadence_next(last, 1070, 20, 0, 80, due));
+  TEST_ASSERT_EQUAL_UINT32(1040, due);
+  TEST_ASSERT_TRUE(hid_cadence_next(last, 1070, 20, 0, 80, due));
+  TEST_ASSERT_EQUAL_UINT32(1060, due);
+  TEST_ASSERT_FALSE(hid_cadence_next(last, 1070, 20, 0, 80, due));
+  // A long stall restarts the grid at now instead of bursting the backlog
+  TEST_ASSERT_TRUE(hid_cadence_next(last, 2000, 20, 0, 80, due));
+  TEST_ASSERT_EQUAL_UINT32(2000, due);
+  TEST_ASSERT_FALSE(hid_cadence_next(last, 2000, 20, 0, 80, due));
+}
+
+void test_hid_cadence_plans_within_lead() {
+  uint32_t last = 1000, due;
+  TEST_ASSERT_TRUE(hid_cadence_next(last, 1000, 20, 20, 80, due));
+  TEST_ASSERT_EQUAL_UINT32(1020, due);
+  TEST_ASSERT_FALSE(hid_cadence_next(last, 1019, 20, 20, 80, due));
+  TEST_ASSERT_TRUE(hid_cadence_next(last, 1020, 20, 20, 80, due));
+  TEST_ASSERT_EQUAL_UINT32(1040, due);
+}
+
+void test_hid_cadence_plan_at_is_first_true_tick() {
+  for (uint32_t lead = 0; lead <= 20; lead += 5) {
+    uint32_t last = 0xFFFFFFF0u, due;  // across the wrap
+    uint32_t at = hid_cadence_plan_at(last, 20, lead);
+    uint32_t probe = last;
+    TEST_ASSERT_FALSE(hid_cadence_next(probe, at - 1, 20, lead, 80, due));
+    TEST_ASSERT_TRUE(hid_cadence_next(probe, at, 20, lead, 80, due));
+    TEST_ASSERT_EQUAL_UINT32(last + 20, due);
+  }
+}
@@ -0,0 +1,68 @@
+#include <unity.h>
+#include "hid_hires.h"
+
+// ============================================================================
+// Resolution Multiplier wheel descriptor
+// ============================================================================
+
+static const uint8_t HIRES_WHEEL[] = { GHOST_HID_DESC_HIRES_WHEEL };
+
+struct DescBits {
+  uint16_t inputBits;
+  uint16_t featureBits;
+  int8_t depth;       // collection nesting; must end at 0
+  bool malformed;
+};
+
+// Walk short items the way a host parser does, summing report bits per type
+static DescBits walkDescriptor(const uint8_t* d, uint16_t len) {
+  DescBits r = {0, 0, 0, false};
+  uint8_t size = 0, count = 0;
+  uint16_t i = 0;
+  while (i < len) {
+    uint8_t prefix = d[i];
+    uint8_t n = prefix & 0x03;
+    if (n == 3) n = 4;
+    if (i + 1 + n > len) { r.malformed = true; break; }
+    uint8_t data = n ? d[i + 1] : 0;
+    switch (prefix & 0xFC) {
+      case 0x74: size = data; break;                           // Report Size
+      case 0x94: count = data; break;                          // Report Count
+      case 0x80: r.inputBits += size * count; break;           // Input
+      case 0xB0: r.featureBits += size * count; break;         // Feature
+      case 0xA0: r.depth++; break;                             // Collection
+      case 0xC0: r.depth--; if (r.depth < 0) r.malformed = true; break;
+    }
+    i += 1 + n;
+  }
+  return r;
+}
+
+void test_hires_wheel_descriptor_well_formed() {
+  DescBits r = walkDescriptor(HIRES_WHEEL, sizeof(HIRES_WHEEL));
+  TEST_ASSERT_FALSE(r.malformed);
+  TEST_ASSERT_EQUAL_INT8(0, r.depth);
+  TEST_ASSERT_EQUAL_UINT16(8, r.inputBits);    // one int8 wheel byte, as before
+  TEST_ASSERT_EQUAL_UINT16(8, r.featureBits);  // byte-aligned feature report
+}
+
+void test_hires_wheel_descriptor_declares_multiplier() {
+  // Usage (Resolution Multiplier) then Physical Maximum = MULT
+  bool usage = false, physMax = false;
+  for (uint16_t i = 0; i < sizeof(HIRES_WHEEL) - 1; i++) {
+    if (HIRES_WHEEL[i] == 0x09 && HIRES_WHEEL[i + 1] == 0x48) usage = true;
+    if (usage && HIRES_WHEEL[i] == 0x45 && HIRES_WHEEL[i + 1] == HIRES_SCROLL_MULTIPLIER) physMax = true;
+  }
+  TEST_ASSERT_TRUE(usage);
+  TEST_ASSERT_TRUE(physMax);
+}
+
+void test_hires_units_from_feature() {
+  TEST_ASSERT_EQUAL_UINT8(1, hid_hires_units(0x00));
+  TEST_ASSERT_EQUAL_UINT8(HIRES_SCROLL_MULTIPLIER, hid_hires_units(0x01));
+  TEST_ASSERT_EQUAL_UINT8(1, hid_hires_units(0xFC));  // padding bits ignored
+  // The feature reads back as written
+  TEST_ASSERT_EQUAL_UINT8(0, hid_hires_feature(1));
+  TEST_ASSERT_EQUAL_UINT8(1, hid_hires_feature(HIRES_SCROLL_MULTIPLIER));
+  TEST_ASSERT_EQUAL_UINT8(HIRES_SCROLL_MULTIPLIER, hid_hires_units(hid_hires_feature(HIRES_SCROLL_MULTIPLIER)));
+}
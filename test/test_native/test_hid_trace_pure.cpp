@@ -0,0 +1,109 @@
+#include <unity.h>
+#include <string.h>
+#include "hid_trace_pure.h"
+
+// ============================================================================
+// Record encode / decode
+// ============================================================================
+
+void test_hid_trace_record_roundtrip() {
+  HidTraceRecord r;
+  r.us = 0xA1B2C3D4u;
+  r.meta = HID_TRACE_KEYBOARD | HID_TRACE_BLE | HID_TRACE_USB;
+  r.p[0] = 0x02; r.p[1] = 0x68; r.p[2] = 0x00;
+
+  uint8_t buf[HID_TRACE_RECORD_SIZE];
+  hid_trace_put_record(buf, r);
+  TEST_ASSERT_EQUAL_UINT8(0xD4, buf[0]);  // little-endian timestamp
+  TEST_ASSERT_EQUAL_UINT8(0xA1, buf[3]);
+
+  HidTraceRecord d = hid_trace_get_record(buf);
+  TEST_ASSERT_EQUAL_UINT32(r.us, d.us);
+  TEST_ASSERT_EQUAL_UINT8(r.meta, d.meta);
+  TEST_ASSERT_EQUAL_UINT8(0x02, d.p[0]);
+  TEST_ASSERT_EQUAL_UINT8(0x68, d.p[1]);
+  TEST_ASSERT_EQUAL_UINT8(HID_TRACE_KEYBOARD, hid_trace_type(d.meta));
+  TEST_ASSERT_EQUAL_UINT8(HID_TRACE_BLE | HID_TRACE_USB, hid_trace_flags(d.meta));
+}
+
+void test_hid_trace_mouse_move_layout() {
+  HidTraceRecord r = hid_trace_mouse_record(100, HID_TRACE_USB, 0x01, -5, 7, 0);
+  TEST_ASSERT_EQUAL_UINT8(HID_TRACE_MOUSE, hid_trace_type(r.meta));
+  TEST_ASSERT_EQUAL_INT8(-5, (int8_t)r.p[0]);
+  TEST_ASSERT_EQUAL_INT8(7, (int8_t)r.p[1]);
+  TEST_ASSERT_EQUAL_UINT8(0x01, r.p[2]);
+}
+
+void test_hid_trace_mouse_wheel_selects_scroll() {
+  HidTraceRecord r = hid_trace_mouse_record(100, HID_TRACE_BLE, 0, 0, 0, -1);
+  TEST_ASSERT_EQUAL_UINT8(HID_TRACE_SCROLL, hid_trace_type(r.meta));
+  TEST_ASSERT_EQUAL_INT8(-1, (int8_t)r.p[0]);
+  TEST_ASSERT_EQUAL_UINT8(HID_TRACE_BLE, hid_trace_flags(r.meta));
+}
+
+void test_hid_trace_flags_cannot_clobber_type() {
+  HidTraceRecord r = hid_trace_mouse_record(0, 0xFF, 0, 1, 1, 0);
+  TEST_ASSERT_EQUAL_UINT8(HID_TRACE_MOUSE, hid_trace_type(r.meta));
+  TEST_ASSERT_EQUAL_UINT8(HID_TRACE_FLAG_MASK, hid_trace_flags(r.meta));
+}
+
+// ============================================================================
+// Header
+// ============================================================================
+
+void test_hid_trace_header_roundtrip() {
+  uint8_t buf[HID_TRACE_HEADER_SIZE + 2 * HID_TRACE_RECORD_SIZE] = {0};
+  hid_trace_put_header(buf, 2, 70000);
+  uint16_t count = 0;
+  uint32_t dropped = 0;
+  TEST_ASSERT_TRUE(hid_trace_get_header(buf, sizeof(buf), &count, &dropped));
+  TEST_ASSERT_EQUAL_UINT16(2, count);
+  TEST_ASSERT_EQUAL_UINT32(70000, dropped);
+}
+
+void test_hid_trace_header_rejects_truncated() {
+  uint8_t buf[HID_TRACE_HEADER_SIZE + HID_TRACE_RECORD_SIZE] = {0};
+  hid_trace_put_header(buf, 2, 0);  // claims 2 records, holds 1
+  uint16_t count;
+  uint32_t dropped;
+  TEST_ASSERT_FALSE(hid_trace_get_header(buf, sizeof(buf), &count, &dropped));
+}
+
+void test_hid_trace_header_rejects_bad_magic() {
+  uint8_t buf[HID_TRACE_HEADER_SIZE];
+  hid_trace_put_header(buf, 0, 0);
+  buf[0] = 'X';
+  uint16_t count;
+  uint32_t dropped;
+  TEST_ASSERT_FALSE(hid_trace_get_header(buf, sizeof(buf), &count, &dropped));
+}
+
+// ============================================================================
+// Base64 dump lines
+// ============================================================================
+
+void test_hid_trace_b64_decodes_header_line() {
+  uint8_t hdr[HID_TRACE_HEADER_SIZE];
+  hid_trace_put_header(hdr, 3, 1);
+  // 'G' 'H' 'T' 1 8 0 | 3 0 | 1 0 0 0
+  const char* line = "R0hUAQgAAwABAAAA";
+  uint8_t out[12];
+  TEST_ASSERT_EQUAL_INT(12, hid_trace_b64_decode_line(line, strlen(line), out));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(hdr, out, sizeof(hdr));
+}
+
+void test_hid_trace_b64_handles_padding() {
+  uint8_t out[3];
+  TEST_ASSERT_EQUAL_INT(1, hid_trace_b64_decode_line("R0==", 4, out));
+  TEST_ASSERT_EQUAL_UINT8('G', out[0]);
+  TEST_ASSERT_EQUAL_INT(2, hid_trace_b64_decode_line("R0g=", 4, out));
+  TEST_ASSERT_EQUAL_UINT8('H', out[1]);
+}
+
+void test_hid_trace_b64_rejects_log_lines() {
+  uint8_t out[48];
+  const char* push = "{\"t\":\"p\",\"k\":\"status\"}";
+  TEST_ASSERT_EQUAL_INT(-1, hid_trace_b64_decode_line(push, strlen(push), out));
+  TEST_ASSERT_EQUAL_INT(-1, hid_trace_b64_decode_line("+ok", 3, out));
+  TEST_ASSERT_EQUAL_INT(-1, hid_trace_b64_decode_line("", 0, out));
+}
@@ -10,6 +10,7 @@ void test_fp8_round_positive_half_rounds_up();
 void test_fp8_round_negative_half_rounds_away_from_zero();
 void test_fp8_round_just_below_half_truncates();
 void test_fp8_round_one_and_half();
+void test_fp8_to_px_matches_step_rounding_beyond_int8();
 void test_bezier_eval_at_t0_returns_p0();
 void test_bezier_eval_at_t1_returns_p2();
 void test_bezier_straight_line_cumulative_sum();
@@ -25,8 +26,80 @@ void test_brownian_amp_zero_at_start();
 void test_brownian_amp_peak_at_midpoint();
 void test_brownian_amp_zero_at_end();
 void test_brownian_amp_always_non_negative();
+void test_sin_q15_cardinal_angles();
+void test_sin_q15_matches_sinf();
+void test_progress_q16_large_denominator();
+void test_time_to_param_q16_breakpoints();
+void test_time_to_param_q16_monotonic_and_symmetric();
+void test_bezier_q16_endpoints();
+void test_bezier_q16_straight_line_cumulative_sum();
+void test_bezier_q16_negative_displacement_cumulative_sum();
+void test_bezier_q16_sweep_ends_on_p2();
+void test_brownian_amp_q16_profile();
+void test_brownian_amp_q16_matches_float_rounding();
+void test_subpx_waits_for_a_whole_pixel();
+void test_subpx_carry_keeps_sum_exact();
+void test_subpx_clamps_to_int8_and_keeps_excess();
+void test_brownian_amp_fp8_matches_rounded_amp();
+void test_min_jerk_q16_profile();
+void test_log2_q8_powers_and_error();
+void test_fitts_ms_grows_with_distance_and_shrinks_with_width();
+void test_coalesce_sends_first_step_immediately();
+void test_coalesce_sums_steps_within_interval();
+void test_coalesce_carries_overflow_to_next_report();
+void test_coalesce_sent_total_equals_queued();
+void test_coalesce_wheel_rides_with_moves();
+void test_coalesce_wheel_only_report();
 void test_ghost_clamp_u32();
 void test_ghost_xor_checksum_bytes();
+void test_rng_next_reference_vector();
+void test_rng_same_seed_same_sequence();
+void test_rng_different_seed_different_sequence();
+void test_rng_seed_zero_is_valid();
+void test_rng_below_zero_returns_zero();
+void test_rng_below_stays_in_range();
+void test_rng_below_covers_every_value();
+void test_perf_bucket_zero();
+void test_perf_bucket_powers_of_two();
+void test_perf_bucket_max_contains_bucket();
+void test_perf_percentile_empty_returns_zero();
+void test_perf_percentile_p99_picks_tail_bucket();
+void test_perf_percentile_p50_single_bucket();
+void test_hid_trace_record_roundtrip();
+void test_hid_trace_mouse_move_layout();
+void test_hid_trace_mouse_wheel_selects_scroll();
+void test_hid_trace_flags_cannot_clobber_type();
+void test_hid_trace_header_roundtrip();
+void test_hid_trace_header_rejects_truncated();
+void test_hid_trace_header_rejects_bad_magic();
+void test_hid_trace_b64_decodes_header_line();
+void test_hid_trace_b64_handles_padding();
+void test_hid_trace_b64_rejects_log_lines();
+void test_hires_wheel_descriptor_well_formed();
+void test_hires_wheel_descriptor_declares_multiplier();
+void test_hires_units_from_feature();
+void test_mouse_trace_varint_zigzag_roundtrip();
+void test_mouse_trace_roundtrip_through_small_reads();
+void test_mouse_trace_runs_collapse_to_one_token();
+void test_mouse_trace_encode_rejects_small_buffer();
+void test_mouse_trace_open_rejects_bad_header();
+void test_mouse_trace_stops_at_truncated_token();
+void test_hid_time_compare_across_wrap();
+void test_hid_step_queue_releases_in_due_order();
+void test_hid_step_queue_full_merges_without_loss();
+void test_hid_cadence_does_not_drift_when_late();
+void test_hid_cadence_catches_up_then_resyncs();
+void test_hid_cadence_plans_within_lead();
+void test_hid_cadence_plan_at_is_first_true_tick();
+void test_timer_wheel_fires_at_due_on_every_level();
+void test_timer_wheel_random_against_reference();
+void test_timer_wheel_cancel_and_rearm();
+void test_timer_wheel_callback_rearms();
+void test_alias_table_matches_weights();
+void test_alias_table_rejects_empty_pools();
+void test_alias_pick_sweep_follows_weights();
+void test_day_timeline_spans();
+void test_day_timeline_find_matches_walk();
 
 int main() {
   UNITY_BEGIN();
@@ -38,6 +111,7 @@ int main() {
   RUN_TEST(test_fp8_round_negative_half_rounds_away_from_zero);
   RUN_TEST(test_fp8_round_just_below_half_truncates);
   RUN_TEST(test_fp8_round_one_and_half);
+  RUN_TEST(test_fp8_to_px_matches_step_rounding_beyond_int8);
   RUN_TEST(test_bezier_eval_at_t0_returns_p0);
   RUN_TEST(test_bezier_eval_at_t1_returns_p2);
   RUN_TEST(test_bezier_straight_line_cumulative_sum);
@@ -53,8 +127,80 @@ int main() {
   RUN_TEST(test_brownian_amp_peak_at_midpoint);
   RUN_TEST(test_brownian_amp_zero_at_end);
   RUN_TEST(test_brownian_amp_always_non_negative);
+  RUN_TEST(test_sin_q15_cardinal_angles);
+  RUN_TEST(test_sin_q15_matches_sinf);
+  RUN_TEST(test_progress_q16_large_denominator);
+  RUN_TEST(test_time_to_param_q16_breakpoints);
+  RUN_TEST(test_time_to_param_q16_monotonic_and_symmetric);
+  RUN_TEST(test_bezier_q16_endpoints);
+  RUN_TEST(test_bezier_q16_straight_line_cumulative_sum);
+  RUN_TEST(test_bezier_q16_negative_displacement_cumulative_sum);
+  RUN_TEST(test_bezier_q16_sweep_ends_on_p2);
+  RUN_TEST(test_brownian_amp_q16_profile);
+  RUN_TEST(test_brownian_amp_q16_matches_float_rounding);
+  RUN_TEST(test_subpx_waits_for_a_whole_pixel);
+  RUN_TEST(test_subpx_carry_keeps_sum_exact);
+  RUN_TEST(test_subpx_clamps_to_int8_and_keeps_excess);
+  RUN_TEST(test_brownian_amp_fp8_matches_rounded_amp);
+  RUN_TEST(test_min_jerk_q16_profile);
+  RUN_TEST(test_log2_q8_powers_and_error);
+  RUN_TEST(test_fitts_ms_grows_with_distance_and_shrinks_with_width);
+  RUN_TEST(test_coalesce_sends_first_step_immediately);
+  RUN_TEST(test_coalesce_sums_steps_within_interval);
+  RUN_TEST(test_coalesce_carries_overflow_to_next_report);
+  RUN_TEST(test_coalesce_sent_total_equals_queued);
+  RUN_TEST(test_coalesce_wheel_rides_with_moves);
+  RUN_TEST(test_coalesce_wheel_only_report);
   RUN_TEST(test_ghost_clamp_u32);
   RUN_TEST(test_ghost_xor_checksum_bytes);
+  RUN_TEST(test_rng_next_reference_vector);
+  RUN_TEST(test_rng_same_seed_same_sequence);
+  RUN_TEST(test_rng_different_seed_different_sequence);
+  RUN_TEST(test_rng_seed_zero_is_valid);
+  RUN_TEST(test_rng_below_zero_returns_zero);
+  RUN_TEST(test_rng_below_stays_in_range);
+  RUN_TEST(test_rng_below_covers_every_value);
+  RUN_TEST(test_perf_bucket_zero);
+  RUN_TEST(test_perf_bucket_powers_of_two);
+  RUN_TEST(test_perf_bucket_max_contains_bucket);
+  RUN_TEST(test_perf_percentile_empty_returns_zero);
+  RUN_TEST(test_perf_percentile_p99_picks_tail_bucket);
+  RUN_TEST(test_perf_percentile_p50_single_bucket);
+  RUN_TEST(test_hid_trace_record_roundtrip);
+  RUN_TEST(test_hid_trace_mouse_move_layout);
+  RUN_TEST(test_hid_trace_mouse_wheel_selects_scroll);
+  RUN_TEST(test_hid_trace_flags_cannot_clobber_type);
+  RUN_TEST(test_hid_trace_header_roundtrip);
+  RUN_TEST(test_hid_trace_header_rejects_truncated);
+  RUN_TEST(test_hid_trace_header_rejects_bad_magic);
+  RUN_TEST(test_hid_trace_b64_decodes_header_line);
+  RUN_TEST(test_hid_trace_b64_handles_padding);
+  RUN_TEST(test_hid_trace_b64_rejects_log_lines);
+  RUN_TEST(test_hires_wheel_descriptor_well_formed);
+  RUN_TEST(test_hires_wheel_descriptor_declares_multiplier);
+  RUN_TEST(test_hires_units_from_feature);
+  RUN_TEST(test_mouse_trace_varint_zigzag_roundtrip);
+  RUN_TEST(test_mouse_trace_roundtrip_through_small_reads);
+  RUN_TEST(test_mouse_trace_runs_collapse_to_one_token);
+  RUN_TEST(test_mouse_trace_encode_rejects_small_buffer);
+  RUN_TEST(test_mouse_trace_open_rejects_bad_header);
+  RUN_TEST(test_mouse_trace_stops_at_truncated_token);
+  RUN_TEST(test_hid_time_compare_across_wrap);
+  RUN_TEST(test_hid_step_queue_releases_in_due_order);
+  RUN_TEST(test_hid_step_queue_full_merges_without_loss);
+  RUN_TEST(test_hid_cadence_does_not_drift_when_late);
+  RUN_TEST(test_hid_cadence_catches_up_then_resyncs);
+  RUN_TEST(test_hid_cadence_plans_within_lead);
+  RUN_TEST(test_hid_cadence_plan_at_is_first_true_tick);
+  RUN_TEST(test_timer_wheel_fires_at_due_on_every_level);
+  RUN_TEST(test_timer_wheel_random_against_reference);
+  RUN_TEST(test_timer_wheel_cancel_and_rearm);
+  RUN_TEST(test_timer_wheel_callback_rearms);
+  RUN_TEST(test_alias_table_matches_weights);
+  RUN_TEST(test_alias_table_rejects_empty_pools);
+  RUN_TEST(test_alias_pick_sweep_follows_weights);
+  RUN_TEST(test_day_timeline_spans);
+  RUN_TEST(test_day_timeline_find_matches_walk);
 
   return UNITY_END();
 }
@@ -187,3 +187,306 @@ void test_brownian_amp_always_non_negative() {
       fminf(0.0f, mouse_brownian_amp(5.0f, progress)));
   }
 }
+
+// ============================================================================
+// Fixed-point motion (GHOST_MOTION_FIXED)
+// ============================================================================
+
+void test_sin_q15_cardinal_angles() {
+  TEST_ASSERT_EQUAL_INT32(0,               mouse_sin_q15(0));
+  TEST_ASSERT_EQUAL_INT32(MOUSE_Q15_ONE,   mouse_sin_q15(90));
+  TEST_ASSERT_EQUAL_INT32(0,               mouse_sin_q15(180));
+  TEST_ASSERT_EQUAL_INT32(-MOUSE_Q15_ONE,  mouse_sin_q15(270));
+  TEST_ASSERT_EQUAL_INT32(0,               mouse_sin_q15(360));
+  TEST_ASSERT_EQUAL_INT32(-MOUSE_Q15_ONE,  mouse_sin_q15(-90));
+  TEST_ASSERT_EQUAL_INT32(MOUSE_Q15_ONE,   mouse_cos_q15(0));
+  TEST_ASSERT_EQUAL_INT32(-MOUSE_Q15_ONE,  mouse_cos_q15(180));
+}
+
+void test_sin_q15_matches_sinf() {
+  // Every degree planNextSweep() can draw is within 1 LSB of sinf/cosf
+  for (int32_t deg = 0; deg < 360; deg++) {
+    float rad = (float)deg * GHOST_M_PI / 180.0f;
+    TEST_ASSERT_INT32_WITHIN(1, (int32_t)lrintf(sinf(rad) * MOUSE_Q15_ONE), mouse_sin_q15(deg));
+    TEST_ASSERT_INT32_WITHIN(1, (int32_t)lrintf(cosf(rad) * MOUSE_Q15_ONE), mouse_cos_q15(deg));
+  }
+}
+
+void test_progress_q16_large_denominator() {
+  TEST_ASSERT_EQUAL_UINT32(0,                 mouse_progress_q16(0, 90000));
+  TEST_ASSERT_EQUAL_UINT32(MOUSE_Q16_ONE,     mouse_progress_q16(90000, 90000));
+  TEST_ASSERT_EQUAL_UINT32(MOUSE_Q16_ONE,     mouse_progress_q16(5, 0));
+  TEST_ASSERT_EQUAL_UINT32(MOUSE_Q16_ONE / 2, mouse_progress_q16(30, 60));
+  // 300000 ms jiggle: shifted down to 16 bits, no overflow
+  TEST_ASSERT_EQUAL_UINT32(MOUSE_Q16_ONE / 2, mouse_progress_q16(150000, 300000));
+}
+
+void test_time_to_param_q16_breakpoints() {
+  // Accel ends at t=0.125, cruise at t=0.875, midpoint maps to itself
+  TEST_ASSERT_EQUAL_UINT32(0,             mouse_time_to_param_q16(0));
+  TEST_ASSERT_EQUAL_UINT32(MOUSE_Q16_ONE, mouse_time_to_param_q16(MOUSE_Q16_ONE));
+  TEST_ASSERT_UINT32_WITHIN(1, 32768, mouse_time_to_param_q16(32768));
+  TEST_ASSERT_UINT32_WITHIN(2, 8192,  mouse_time_to_param_q16(13107));
+  TEST_ASSERT_UINT32_WITHIN(2, 57344, mouse_time_to_param_q16(52429));
+}
+
+void test_time_to_param_q16_monotonic_and_symmetric() {
+  uint32_t prev = 0;
+  for (uint32_t p = 0; p <= MOUSE_Q16_ONE; p += 16) {
+    uint32_t t = mouse_time_to_param_q16(p);
+    TEST_ASSERT_TRUE(t >= prev);
+    TEST_ASSERT_UINT32_WITHIN(1, MOUSE_Q16_ONE, t + mouse_time_to_param_q16(MOUSE_Q16_ONE - p));
+    prev = t;
+  }
+}
+
+void test_bezier_q16_endpoints() {
+  TEST_ASSERT_EQUAL_INT32(500,  mouse_bezier_eval_q16(500, 1000, 2000, 0));
+  TEST_ASSERT_EQUAL_INT32(2000, mouse_bezier_eval_q16(500, 1000, 2000, MOUSE_Q16_ONE));
+  TEST_ASSERT_EQUAL_INT32(-300, mouse_bezier_eval_q16(-300, 0, 300, 0));
+  TEST_ASSERT_EQUAL_INT32(300,  mouse_bezier_eval_q16(-300, 0, 300, MOUSE_Q16_ONE));
+}
+
+// Same cumulative-displacement checks as the float path above
+static int32_t bezierQ16LineSum(int32_t p0, int32_t p1, int32_t p2, int n) {
+  int32_t prev = p0;
+  int32_t total = 0;
+  for (int i = 1; i <= n; i++) {
+    int32_t cur = mouse_bezier_eval_q16(p0, p1, p2, mouse_progress_q16(i, n));
+    total += mouse_fp8_round(cur - prev);
+    prev = cur;
+  }
+  return total;
+}
+
+void test_bezier_q16_straight_line_cumulative_sum() {
+  TEST_ASSERT_EQUAL_INT32(10, bezierQ16LineSum(0, 1280, 2560, 10));
+}
+
+void test_bezier_q16_negative_displacement_cumulative_sum() {
+  TEST_ASSERT_EQUAL_INT32(-10, bezierQ16LineSum(0, -1280, -2560, 10));
+}
+
+void test_bezier_q16_sweep_ends_on_p2() {
+  // Through the trapezoid profile the last step lands exactly on P2 for any
+  // step count, so the fixed-point deltas telescope to the full displacement
+  static const int32_t curves[][2] = {
+    { 60 << 8, 200 << 8 }, { -(90 << 8), -(120 << 8) }, { 350 << 8, -(7 << 8) }, { 1, -1 }
+  };
+  for (uint8_t c = 0; c < 4; c++) {
+    for (uint16_t n = 2; n <= 150; n++) {
+      int32_t prev = 0, sum = 0;
+      for (uint16_t i = 1; i <= n; i++) {
+        int32_t cur = mouse_bezier_eval_q16(0, curves[c][0], curves[c][1],
+                                            mouse_time_to_param_q16(mouse_progress_q16(i, n)));
+        sum += cur - prev;
+        prev = cur;
+      }
+      TEST_ASSERT_EQUAL_INT32(curves[c][1], sum);
+    }
+  }
+}
+
+void test_brownian_amp_q16_profile() {
+  TEST_ASSERT_EQUAL_INT8(0, mouse_brownian_amp_q16(5, 0));
+  TEST_ASSERT_EQUAL_INT8(5, mouse_brownian_amp_q16(5, MOUSE_Q16_ONE / 2));
+  TEST_ASSERT_EQUAL_INT8(1, mouse_brownian_amp_q16(1, MOUSE_Q16_ONE / 2));
+  TEST_ASSERT_EQUAL_INT8(0, mouse_brownian_amp_q16(5, MOUSE_Q16_ONE));
+}
+
+void test_brownian_amp_q16_matches_float_rounding() {
+  for (uint8_t amp = 1; amp <= 5; amp++) {
+    for (uint32_t i = 0; i <= 1000; i++) {
+      int8_t f = (int8_t)(mouse_brownian_amp(amp, (float)i / 1000.0f) + 0.5f);
+      int8_t q = mouse_brownian_amp_q16(amp, i * MOUSE_Q16_ONE / 1000);
+      TEST_ASSERT_TRUE(q >= 0);
+      TEST_ASSERT_INT_WITHIN(1, f, q);
+    }
+  }
+}
+
+void test_coalesce_sends_first_step_immediately() {
+  MouseCoalescer c = {};
+  int8_t dx = 0, dy = 0, dw = 0;
+  mouse_coalesce_add(c, 3, -2);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 1000, 60, dx, dy, dw));
+  TEST_ASSERT_EQUAL_INT8(3, dx);
+  TEST_ASSERT_EQUAL_INT8(-2, dy);
+  TEST_ASSERT_EQUAL_INT8(0, dw);
+  TEST_ASSERT_FALSE(mouse_coalesce_pending(c));
+}
+
+void test_coalesce_sums_steps_within_interval() {
+  // 20ms steps over a 60ms connection interval: three steps per report
+  MouseCoalescer c = {};
+  int8_t dx = 0, dy = 0, dw = 0;
+  mouse_coalesce_add(c, 4, 1);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 0, 60, dx, dy, dw));
+  mouse_coalesce_add(c, 5, 1);
+  TEST_ASSERT_FALSE(mouse_coalesce_take(c, 20, 60, dx, dy, dw));
+  mouse_coalesce_add(c, 6, -1);
+  TEST_ASSERT_FALSE(mouse_coalesce_take(c, 40, 60, dx, dy, dw));
+  mouse_coalesce_add(c, 7, 0);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 60, 60, dx, dy, dw));
+  TEST_ASSERT_EQUAL_INT8(18, dx);
+  TEST_ASSERT_EQUAL_INT8(0, dy);
+}
+
+void test_coalesce_carries_overflow_to_next_report() {
+  MouseCoalescer c = {};
+  int8_t dx = 0, dy = 0, dw = 0;
+  for (uint8_t i = 0; i < 3; i++) mouse_coalesce_add(c, 100, -100);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 0, 15, dx, dy, dw));
+  TEST_ASSERT_EQUAL_INT8(127, dx);
+  TEST_ASSERT_EQUAL_INT8(-127, dy);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 15, 15, dx, dy, dw));
+  TEST_ASSERT_EQUAL_INT8(127, dx);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 30, 15, dx, dy, dw));
+  TEST_ASSERT_EQUAL_INT8(46, dx);
+  TEST_ASSERT_EQUAL_INT8(-46, dy);
+  TEST_ASSERT_FALSE(mouse_coalesce_pending(c));
+}
+
+void test_coalesce_sent_total_equals_queued() {
+  MouseCoalescer c = {};
+  int32_t queuedX = 0, sentX = 0, queuedY = 0, sentY = 0;
+  int8_t dx, dy, dw;
+  for (uint32_t now = 0; now < 5000; now += 20) {
+    int8_t sx = (int8_t)((now / 20) % 11) - 5;
+    int8_t sy = (int8_t)((now / 20) % 7) - 3;
+    mouse_coalesce_add(c, sx, sy);
+    queuedX += sx;
+    queuedY += sy;
+    if (mouse_coalesce_take(c, now, 45, dx, dy, dw)) { sentX += dx; sentY += dy; }
+  }
+  while (mouse_coalesce_take(c, 10000, 45, dx, dy, dw)) { sentX += dx; sentY += dy; }
+  TEST_ASSERT_EQUAL_INT32(queuedX, sentX);
+  TEST_ASSERT_EQUAL_INT32(queuedY, sentY);
+}
+
+void test_coalesce_wheel_rides_with_moves() {
+  // Hi-res ramp steps land in the same report as the move queued alongside
+  MouseCoalescer c = {};
+  int8_t dx = 0, dy = 0, dw = 0;
+  mouse_coalesce_add(c, 2, 0);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 0, 60, dx, dy, dw));
+  mouse_coalesce_add_wheel(c, 1);
+  TEST_ASSERT_TRUE(mouse_coalesce_pending(c));
+  mouse_coalesce_add(c, 3, 1);
+  mouse_coalesce_add_wheel(c, 3);
+  TEST_ASSERT_FALSE(mouse_coalesce_take(c, 20, 60, dx, dy, dw));
+  mouse_coalesce_add_wheel(c, 4);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 60, 60, dx, dy, dw));
+  TEST_ASSERT_EQUAL_INT8(3, dx);
+  TEST_ASSERT_EQUAL_INT8(1, dy);
+  TEST_ASSERT_EQUAL_INT8(8, dw);
+  TEST_ASSERT_FALSE(mouse_coalesce_pending(c));
+}
+
+void test_coalesce_wheel_only_report() {
+  MouseCoalescer c = {};
+  int8_t dx = 5, dy = 5, dw = 0;
+  mouse_coalesce_add_wheel(c, -8);
+  TEST_ASSERT_TRUE(mouse_coalesce_take(c, 0, 15, dx, dy, dw));
+  TEST_ASSERT_EQUAL_INT8(0, dx);
+  TEST_ASSERT_EQUAL_INT8(0, dy);
+  TEST_ASSERT_EQUAL_INT8(-8, dw);
+}
+
+void test_fp8_to_px_matches_step_rounding_beyond_int8() {
+  TEST_ASSERT_EQUAL_INT32(1050, mouse_fp8_to_px(1050 << 8));
+  TEST_ASSERT_EQUAL_INT32(-1050, mouse_fp8_to_px(-(1050 << 8)));
+  TEST_ASSERT_EQUAL_INT32(301, mouse_fp8_to_px((300 << 8) + 128));
+  TEST_ASSERT_EQUAL_INT32(-301, mouse_fp8_to_px(-((300 << 8) + 128)));
+  for (int32_t fp = -(127 << 8); fp <= (127 << 8); fp += 7) {
+    TEST_ASSERT_EQUAL_INT32(mouse_fp8_round(fp), mouse_fp8_to_px(fp));
+  }
+}
+
+void test_min_jerk_q16_profile() {
+  TEST_ASSERT_EQUAL_UINT32(0, mouse_min_jerk_q16(0));
+  TEST_ASSERT_EQUAL_UINT32(MOUSE_Q16_ONE / 2, mouse_min_jerk_q16(MOUSE_Q16_ONE / 2));
+  TEST_ASSERT_EQUAL_UINT32(MOUSE_Q16_ONE, mouse_min_jerk_q16(MOUSE_Q16_ONE));
+  for (uint32_t p = 0; p <= MOUSE_Q16_ONE; p += 64) {
+    float t = (float)p / MOUSE_Q16_ONE;
+    float s = t * t * t * (10.0f - 15.0f * t + 6.0f * t * t);
+    TEST_ASSERT_INT32_WITHIN(2, (int32_t)(s * MOUSE_Q16_ONE + 0.5f), (int32_t)mouse_min_jerk_q16(p));
+  }
+  // Eases in: the first 10% of time covers under 1% of the distance
+  TEST_ASSERT_TRUE(mouse_min_jerk_q16(MOUSE_Q16_ONE / 10) < MOUSE_Q16_ONE / 100);
+}
+
+void test_log2_q8_powers_and_error() {
+  TEST_ASSERT_EQUAL_UINT32(0, mouse_log2_q8(1));
+  TEST_ASSERT_EQUAL_UINT32(1 << 8, mouse_log2_q8(2));
+  TEST_ASSERT_EQUAL_UINT32(10 << 8, mouse_log2_q8(1024));
+  for (uint32_t x = 1; x < 5000; x++) {
+    TEST_ASSERT_INT32_WITHIN(24, (int32_t)(log2f((float)x) * 256.0f), (int32_t)mouse_log2_q8(x));
+  }
+}
+
+void test_fitts_ms_grows_with_distance_and_shrinks_with_width() {
+  TEST_ASSERT_EQUAL_UINT32(100, mouse_fitts_ms(0, 16, 100, 120));
+  TEST_ASSERT_EQUAL_UINT32(220, mouse_fitts_ms(16, 16, 100, 120));  // 1 bit
+  TEST_ASSERT_TRUE(mouse_fitts_ms(400, 16, 100, 120) > mouse_fitts_ms(100, 16, 100, 120));
+  TEST_ASSERT_TRUE(mouse_fitts_ms(400, 8, 100, 120) > mouse_fitts_ms(400, 40, 100, 120));
+}
+
+// ============================================================================
+// Sub-pixel error diffusion
+// ============================================================================
+
+void test_subpx_waits_for_a_whole_pixel() {
+  MouseSubpixel a = {};
+  int8_t dx, dy;
+  int steps = 0, sentX = 0;
+  for (int i = 0; i < 40; i++) {          // 0.3 px/step on x, 0.1 on y
+    mouse_subpx_take(a, 77, 26, dx, dy);
+    if (dx || dy) steps++;
+    sentX += dx;
+  }
+  // 12 px of x due: one report per pixel, not one per step
+  TEST_ASSERT_INT_WITHIN(1, 12, sentX);
+  TEST_ASSERT_INT_WITHIN(1, 12, steps);
+  TEST_ASSERT_TRUE(a.remX > -256 && a.remX < 256);
+}
+
+void test_subpx_carry_keeps_sum_exact() {
+  MouseSubpixel a = {};
+  int8_t dx, dy;
+  int32_t fpX = 0, fpY = 0, sentX = 0, sentY = 0;
+  for (int i = 0; i < 500; i++) {
+    int32_t sx = (i * 97) % 700 - 350, sy = (i * 53) % 300 - 100;
+    fpX += sx;
+    fpY += sy;
+    mouse_subpx_take(a, sx, sy, dx, dy);
+    sentX += dx;
+    sentY += dy;
+    // The sent path never trails the fractional one by a pixel or more
+    TEST_ASSERT_TRUE(abs(fpX - sentX * 256) < 256 && abs(fpY - sentY * 256) < 256);
+  }
+  TEST_ASSERT_EQUAL_INT32(fpX, sentX * 256 + a.remX);
+  TEST_ASSERT_EQUAL_INT32(fpY, sentY * 256 + a.remY);
+}
+
+void test_subpx_clamps_to_int8_and_keeps_excess() {
+  MouseSubpixel a = {};
+  int8_t dx, dy;
+  mouse_subpx_take(a, 300 * 256, -2 * 256, dx, dy);
+  TEST_ASSERT_EQUAL_INT8(127, dx);
+  TEST_ASSERT_EQUAL_INT8(-2, dy);
+  mouse_subpx_take(a, 0, 0, dx, dy);
+  TEST_ASSERT_EQUAL_INT8(127, dx);
+  mouse_subpx_take(a, 0, 0, dx, dy);
+  TEST_ASSERT_EQUAL_INT8(46, dx);
+}
+
+void test_brownian_amp_fp8_matches_rounded_amp() {
+  for (uint8_t amp = 1; amp <= 5; amp++) {
+    for (uint32_t p = 0; p <= MOUSE_Q16_ONE; p += 256) {
+      int32_t fp = mouse_brownian_amp_fp8_q16(amp, p);
+      TEST_ASSERT_INT_WITHIN(1, mouse_brownian_amp_q16(amp, p), mouse_fp8_to_px(fp));
+    }
+  }
+  TEST_ASSERT_EQUAL_INT32(3 * 256, mouse_brownian_amp_fp8_q16(3, MOUSE_Q16_ONE / 2));
+}
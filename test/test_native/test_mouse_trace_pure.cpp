@@ -0,0 +1,118 @@
+#include <unity.h>
+#include "mouse_trace_pure.h"
+
+// ============================================================================
+// Recorded mouse trace encoding and streaming decode
+// ============================================================================
+
+struct MemSource {
+  const uint8_t* data;
+  uint32_t len;
+  uint16_t maxRead;   // caps each read, to exercise window refills
+  uint16_t reads;
+};
+
+static uint16_t memRead(void* ctx, uint32_t offset, uint8_t* buf, uint16_t len) {
+  MemSource* m = (MemSource*)ctx;
+  m->reads++;
+  if (offset >= m->len) return 0;
+  uint32_t n = m->len - offset;
+  if (n > len) n = len;
+  if (n > m->maxRead) n = m->maxRead;
+  memcpy(buf, m->data + offset, n);
+  return (uint16_t)n;
+}
+
+void test_mouse_trace_varint_zigzag_roundtrip() {
+  const int32_t values[] = { 0, 1, -1, 63, -64, 64, 300, -300, 32767, -32768, 2000000 };
+  for (int32_t v : values) {
+    uint8_t buf[5];
+    uint8_t n = mouse_trace_put_varint(buf, mouse_trace_zigzag(v));
+    uint32_t z;
+    TEST_ASSERT_EQUAL_UINT8(n, mouse_trace_get_varint(buf, n, z));
+    TEST_ASSERT_EQUAL_INT32(v, mouse_trace_unzigzag(z));
+  }
+  uint8_t one[5];
+  TEST_ASSERT_EQUAL_UINT8(1, mouse_trace_put_varint(one, mouse_trace_zigzag(-64)));
+  uint32_t z;
+  TEST_ASSERT_EQUAL_UINT8(0, mouse_trace_get_varint(one, 0, z));  // truncated
+}
+
+void test_mouse_trace_roundtrip_through_small_reads() {
+  MouseTraceSample s[200];
+  uint32_t duration = 0;
+  for (int i = 0; i < 200; i++) {
+    s[i].dtMs = (uint32_t)(4 + (i % 7));
+    s[i].dx = (int16_t)((i * 37) % 41 - 20);
+    s[i].dy = (int16_t)(i % 3 == 0 ? -200 + i : 1);
+    duration += s[i].dtMs;
+  }
+  uint8_t buf[2048];
+  size_t len = mouse_trace_encode(s, 200, buf, sizeof(buf));
+  TEST_ASSERT_TRUE(len > MOUSE_TRACE_HEADER_SIZE);
+
+  MemSource src = { buf, (uint32_t)len, 7, 0 };
+  MouseTraceReader r;
+  uint32_t got;
+  TEST_ASSERT_TRUE(mouse_trace_open(r, memRead, &src, &got));
+  TEST_ASSERT_EQUAL_UINT32(duration, got);
+  for (int i = 0; i < 200; i++) {
+    uint32_t dt; int32_t dx, dy;
+    TEST_ASSERT_TRUE(mouse_trace_next(r, dt, dx, dy));
+    TEST_ASSERT_EQUAL_UINT32(s[i].dtMs, dt);
+    TEST_ASSERT_EQUAL_INT32(s[i].dx, dx);
+    TEST_ASSERT_EQUAL_INT32(s[i].dy, dy);
+  }
+  uint32_t dt; int32_t dx, dy;
+  TEST_ASSERT_FALSE(mouse_trace_next(r, dt, dx, dy));
+}
+
+void test_mouse_trace_runs_collapse_to_one_token() {
+  MouseTraceSample s[50];
+  for (int i = 0; i < 50; i++) s[i] = { 8, 3, -2 };
+  uint8_t buf[64];
+  size_t len = mouse_trace_encode(s, 50, buf, sizeof(buf));
+  TEST_ASSERT_EQUAL(MOUSE_TRACE_HEADER_SIZE + 4, len);  // tag, repeat, dx, dy
+
+  MemSource src = { buf, (uint32_t)len, 64, 0 };
+  MouseTraceReader r;
+  TEST_ASSERT_TRUE(mouse_trace_open(r, memRead, &src, NULL));
+  int count = 0;
+  uint32_t dt; int32_t dx, dy;
+  while (mouse_trace_next(r, dt, dx, dy)) {
+    TEST_ASSERT_EQUAL_UINT32(8, dt);
+    TEST_ASSERT_EQUAL_INT32(3, dx);
+    TEST_ASSERT_EQUAL_INT32(-2, dy);
+    count++;
+  }
+  TEST_ASSERT_EQUAL(50, count);
+}
+
+void test_mouse_trace_encode_rejects_small_buffer() {
+  MouseTraceSample s[4] = { {1, 100, 0}, {2, 0, 100}, {3, -100, 0}, {4, 0, -100} };
+  uint8_t buf[16];
+  TEST_ASSERT_EQUAL(0, mouse_trace_encode(s, 4, buf, sizeof(buf)));
+}
+
+void test_mouse_trace_open_rejects_bad_header() {
+  uint8_t buf[MOUSE_TRACE_HEADER_SIZE] = { 'G', 'M', 'X', MOUSE_TRACE_VERSION, 0, 0, 0, 0 };
+  MemSource src = { buf, sizeof(buf), 64, 0 };
+  MouseTraceReader r;
+  TEST_ASSERT_FALSE(mouse_trace_open(r, memRead, &src, NULL));
+  src.len = 5;  // short file
+  buf[2] = 'R';
+  TEST_ASSERT_FALSE(mouse_trace_open(r, memRead, &src, NULL));
+}
+
+void test_mouse_trace_stops_at_truncated_token() {
+  MouseTraceSample s[2] = { {8, 1, 1}, {8, 500, -500} };
+  uint8_t buf[64];
+  size_t len = mouse_trace_encode(s, 2, buf, sizeof(buf));
+  MemSource src = { buf, (uint32_t)(len - 1), 64, 0 };  // last byte lost
+  MouseTraceReader r;
+  TEST_ASSERT_TRUE(mouse_trace_open(r, memRead, &src, NULL));
+  uint32_t dt; int32_t dx, dy;
+  TEST_ASSERT_TRUE(mouse_trace_next(r, dt, dx, dy));
+  TEST_ASSERT_FALSE(mouse_trace_next(r, dt, dx, dy));
+  TEST_ASSERT_FALSE(mouse_trace_next(r, dt, dx, dy));
+}
@@ -0,0 +1,52 @@
+#include <unity.h>
+#include "perf_pure.h"
+
+// ============================================================================
+// perf_bucket — log2 bucket index
+// ============================================================================
+
+void test_perf_bucket_zero() {
+  TEST_ASSERT_EQUAL_UINT8(0, perf_bucket(0));
+}
+
+void test_perf_bucket_powers_of_two() {
+  TEST_ASSERT_EQUAL_UINT8(1, perf_bucket(1));
+  TEST_ASSERT_EQUAL_UINT8(2, perf_bucket(2));
+  TEST_ASSERT_EQUAL_UINT8(2, perf_bucket(3));
+  TEST_ASSERT_EQUAL_UINT8(3, perf_bucket(4));
+  TEST_ASSERT_EQUAL_UINT8(11, perf_bucket(1024));
+  TEST_ASSERT_EQUAL_UINT8(32, perf_bucket(0xFFFFFFFFu));
+}
+
+void test_perf_bucket_max_contains_bucket() {
+  // Every value lands in a bucket whose upper edge is >= the value
+  uint32_t samples[] = { 1, 2, 3, 7, 8, 100, 4095, 4096, 65535, 1000000 };
+  for (uint8_t i = 0; i < sizeof(samples) / sizeof(samples[0]); i++) {
+    uint8_t b = perf_bucket(samples[i]);
+    TEST_ASSERT_TRUE(perf_bucket_max(b) >= samples[i]);
+    TEST_ASSERT_TRUE(perf_bucket_max(b - 1) < samples[i]);
+  }
+}
+
+// ============================================================================
+// perf_percentile
+// ============================================================================
+
+void test_perf_percentile_empty_returns_zero() {
+  uint32_t hist[PERF_HIST_BUCKETS] = {0};
+  TEST_ASSERT_EQUAL_UINT32(0, perf_percentile(hist, 0, 99));
+}
+
+void test_perf_percentile_p99_picks_tail_bucket() {
+  uint32_t hist[PERF_HIST_BUCKETS] = {0};
+  hist[perf_bucket(100)] = 990;    // bulk around 100 cycles
+  hist[perf_bucket(5000)] = 10;    // 1% slow tail
+  TEST_ASSERT_EQUAL_UINT32(perf_bucket_max(perf_bucket(100)), perf_percentile(hist, 1000, 99));
+  TEST_ASSERT_EQUAL_UINT32(perf_bucket_max(perf_bucket(5000)), perf_percentile(hist, 1000, 100));
+}
+
+void test_perf_percentile_p50_single_bucket() {
+  uint32_t hist[PERF_HIST_BUCKETS] = {0};
+  hist[perf_bucket(300)] = 7;
+  TEST_ASSERT_EQUAL_UINT32(511, perf_percentile(hist, 7, 50));
+}
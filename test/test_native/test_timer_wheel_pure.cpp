@@ -0,0 +1,154 @@
+#include <unity.h>
+#include "timer_wheel_pure.h"
+#include "rng_pure.h"
+
+// ============================================================================
+// Hierarchical timer wheel: exact expiry, cancel / re-arm, wrap, callbacks
+// ============================================================================
+
+struct Probe {
+  WheelTimer t;       // first member — callbacks cast back to the probe
+  uint32_t firedAt;
+  uint16_t fires;
+};
+
+static void probeFired(WheelTimer& t, uint32_t now) {
+  Probe& p = (Probe&)t;
+  p.firedAt = now;
+  p.fires++;
+}
+
+static void probeInit(Probe& p) {
+  tw_timer_init(p.t, probeFired);
+  p.firedAt = 0;
+  p.fires = 0;
+}
+
+// Step the wheel a millisecond at a time; each probe must fire exactly once,
+// on the first run at or after its due time
+void test_timer_wheel_fires_at_due_on_every_level() {
+  static const uint32_t delays[] = { 1, 63, 64, 65, 4095, 4096, 262143, 262144, 300000 };
+  const uint8_t n = sizeof(delays) / sizeof(delays[0]);
+  Probe p[n];
+  TimerWheel w;
+  tw_init(w, 1000);
+  for (uint8_t i = 0; i < n; i++) {
+    probeInit(p[i]);
+    tw_arm(w, p[i].t, 1000 + delays[i]);
+  }
+  for (uint32_t now = 1001; now <= 1000 + 300000; now++) {
+    tw_run(w, now);
+    for (uint8_t i = 0; i < n; i++) {
+      if (now < 1000 + delays[i]) TEST_ASSERT_EQUAL_UINT16(0, p[i].fires);
+    }
+  }
+  for (uint8_t i = 0; i < n; i++) {
+    TEST_ASSERT_EQUAL_UINT16(1, p[i].fires);
+    TEST_ASSERT_EQUAL_UINT32(1000 + delays[i], p[i].firedAt);
+    TEST_ASSERT_FALSE(tw_armed(p[i].t));
+  }
+}
+
+// Coarse runs (a sleeping owner) still fire everything once, and the
+// deadline never lies past the earliest pending timer
+void test_timer_wheel_random_against_reference() {
+  const uint8_t n = 48;
+  Probe p[n];
+  uint32_t due[n];
+  RngState rng;
+  rng_seed_state(&rng, 0x1234567u);
+  TimerWheel w;
+  uint32_t now = 0xFF000000u;   // crosses the 32-bit wrap
+  tw_init(w, now);
+  for (uint8_t i = 0; i < n; i++) {
+    probeInit(p[i]);
+    // Spread over every level and the overflow list (up to ~8.9 h)
+    uint32_t d = 1 + rng_below(&rng, 1u << (6 + rng_below(&rng, 20)));
+    due[i] = now + d;
+    tw_arm(w, p[i].t, due[i]);
+  }
+  uint8_t remaining = n;
+  while (remaining > 0) {
+    uint32_t next;
+    TEST_ASSERT_TRUE(tw_deadline(w, next));
+    uint32_t earliest = 0;
+    bool any = false;
+    for (uint8_t i = 0; i < n; i++) {
+      if (p[i].fires) continue;
+      if (!any || due[i] - now < earliest - now) earliest = due[i];
+      any = true;
+    }
+    TEST_ASSERT_TRUE(next - now <= earliest - now);
+    now += 1 + rng_below(&rng, 200000);
+    tw_run(w, now);
+    remaining = 0;
+    for (uint8_t i = 0; i < n; i++) {
+      if ((int32_t)(now - due[i]) >= 0) {
+        TEST_ASSERT_EQUAL_UINT16(1, p[i].fires);
+        TEST_ASSERT_EQUAL_UINT32(due[i], p[i].firedAt);
+      } else {
+        TEST_ASSERT_EQUAL_UINT16(0, p[i].fires);
+        remaining++;
+      }
+    }
+  }
+  uint32_t next;
+  TEST_ASSERT_FALSE(tw_deadline(w, next));
+}
+
+void test_timer_wheel_cancel_and_rearm() {
+  Probe a, b;
+  probeInit(a);
+  probeInit(b);
+  TimerWheel w;
+  tw_init(w, 0);
+  tw_arm(w, a.t, 5000);
+  tw_arm(w, b.t, 5000);
+  tw_cancel(w, a.t);
+  tw_cancel(w, a.t);                // second cancel is a no-op
+  tw_arm(w, b.t, 70);               // re-arm moves it down two levels
+  uint32_t next;
+  TEST_ASSERT_TRUE(tw_deadline(w, next));
+  TEST_ASSERT_EQUAL_UINT32(64, next);   // its level-1 slot cascades first
+  tw_run(w, 64);
+  TEST_ASSERT_TRUE(tw_deadline(w, next));
+  TEST_ASSERT_EQUAL_UINT32(70, next);
+  tw_run(w, 10000);
+  TEST_ASSERT_EQUAL_UINT16(0, a.fires);
+  TEST_ASSERT_EQUAL_UINT16(1, b.fires);
+  TEST_ASSERT_EQUAL_UINT32(70, b.firedAt);
+  TEST_ASSERT_FALSE(tw_deadline(w, next));
+}
+
+// A callback re-arming itself runs periodically on the exact grid; a timer
+// armed for a time already reached fires on the next run
+static TimerWheel* periodicWheel;
+
+static void periodicFired(WheelTimer& t, uint32_t now) {
+  Probe& p = (Probe&)t;
+  p.fires++;
+  p.firedAt = now;
+  tw_arm(*periodicWheel, t, now + 100);
+}
+
+void test_timer_wheel_callback_rearms() {
+  Probe tick, late;
+  tw_timer_init(tick.t, periodicFired);
+  tick.fires = 0;
+  probeInit(late);
+  TimerWheel w;
+  periodicWheel = &w;
+  tw_init(w, 0);
+  tw_arm(w, tick.t, 100);
+  tw_run(w, 1050);                  // one coarse run catches up every period
+  TEST_ASSERT_EQUAL_UINT16(10, tick.fires);
+  TEST_ASSERT_EQUAL_UINT32(1000, tick.firedAt);
+
+  tw_arm(w, late.t, 1020);          // already reached
+  uint32_t next;
+  TEST_ASSERT_TRUE(tw_deadline(w, next));
+  TEST_ASSERT_EQUAL_UINT32(1050, next);
+  tw_run(w, 1051);
+  TEST_ASSERT_EQUAL_UINT16(1, late.fires);
+  tw_cancel(w, tick.t);
+}
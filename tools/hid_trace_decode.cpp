@@ -0,0 +1,188 @@
+// ============================================================================
+// HID trace decoder — prints inter-report timing statistics
+//
+// Input is either a raw dump (as written by the simulator's --hidtrace) or a
+// serial / NUS capture containing the base64 block between
+// "--- HIDTRACE START ---" and "--- HIDTRACE END ---" (serial 'i' or
+// !hidtrace). Format: src/common/hid_trace_pure.h.
+//
+//   make hidtrace ARGS="capture.log"
+//   .pio/hid_trace_decode [--list] FILE     (FILE = - for stdin)
+// ============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "hid_trace_pure.h"
+
+static const char* const TYPE_NAMES[HID_TRACE_TYPE_COUNT] = {
+  "keyboard", "mouse", "scroll", "consumer"
+};
+
+static bool readAll(const char* path, std::vector<uint8_t>& out) {
+  FILE* f = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+  if (!f) return false;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.insert(out.end(), buf, buf + n);
+  if (f != stdin) fclose(f);
+  return true;
+}
+
+// Pull the base64 block out of a text capture. Other log lines around or
+// between the markers (e.g. status pushes) are skipped.
+static bool extractDump(const std::vector<uint8_t>& text, std::vector<uint8_t>& out) {
+  std::string s(text.begin(), text.end());
+  size_t start = s.find("--- HIDTRACE START ---");
+  if (start == std::string::npos) return false;
+  size_t end = s.find("--- HIDTRACE END ---", start);
+  if (end == std::string::npos) return false;
+  start = s.find('\n', start);
+  if (start == std::string::npos || start > end) return false;
+
+  size_t pos = start + 1;
+  while (pos < end) {
+    size_t eol = s.find('\n', pos);
+    if (eol == std::string::npos || eol > end) eol = end;
+    std::string line = s.substr(pos, eol - pos);
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.pop_back();
+    pos = eol + 1;
+
+    uint8_t bytes[HID_TRACE_B64_LINE_MAX / 4 * 3];
+    if (line.size() > HID_TRACE_B64_LINE_MAX) continue;
+    int n = hid_trace_b64_decode_line(line.data(), line.size(), bytes);
+    if (n > 0) out.insert(out.end(), bytes, bytes + n);
+  }
+  return true;
+}
+
+struct Series {
+  unsigned long count = 0;
+  bool havePrev = false;
+  uint32_t prevUs = 0;
+  std::vector<uint32_t> gaps;   // µs between consecutive reports
+
+  void add(uint32_t us) {
+    count++;
+    if (havePrev) gaps.push_back(us - prevUs);   // modulo 2^32 handles wrap
+    prevUs = us;
+    havePrev = true;
+  }
+};
+
+static double pctMs(const std::vector<uint32_t>& sorted, double pct) {
+  if (sorted.empty()) return 0;
+  size_t idx = (size_t)(pct / 100.0 * (sorted.size() - 1) + 0.5);
+  return sorted[idx] / 1000.0;
+}
+
+static void printSeries(const char* name, Series& s) {
+  if (s.count == 0) return;
+  std::vector<uint32_t>& g = s.gaps;
+  std::sort(g.begin(), g.end());
+  double mean = 0;
+  for (uint32_t v : g) mean += v;
+  if (!g.empty()) mean /= g.size() * 1000.0;
+  printf("%-10s %7lu %9.3f %9.3f %9.3f %9.3f %9.3f %10.3f %9.3f\n", name, s.count,
+         g.empty() ? 0 : g.front() / 1000.0, pctMs(g, 50), pctMs(g, 95), pctMs(g, 99),
+         pctMs(g, 99.9), g.empty() ? 0 : g.back() / 1000.0, mean);
+}
+
+static void listRecord(const HidTraceRecord& r, uint32_t t0) {
+  uint8_t type = hid_trace_type(r.meta);
+  uint8_t flags = hid_trace_flags(r.meta);
+  printf("%12.3f %-8s %s%s%s ", (r.us - t0) / 1000.0,
+         type < HID_TRACE_TYPE_COUNT ? TYPE_NAMES[type] : "?",
+         (flags & HID_TRACE_BLE) ? "B" : "-",
+         (flags & HID_TRACE_USB) ? "U" : "-",
+         (flags & HID_TRACE_BLE_FAIL) ? "!" : " ");
+  switch (type) {
+    case HID_TRACE_KEYBOARD:
+      printf("mod=%02X keys=%02X %02X\n", r.p[0], r.p[1], r.p[2]);
+      break;
+    case HID_TRACE_MOUSE:
+      printf("dx=%d dy=%d btn=%02X\n", (int8_t)r.p[0], (int8_t)r.p[1], r.p[2]);
+      break;
+    case HID_TRACE_SCROLL:
+      printf("wheel=%d btn=%02X\n", (int8_t)r.p[0], r.p[1]);
+      break;
+    case HID_TRACE_CONSUMER:
+      printf("usage=%04X\n", r.p[0] | (r.p[1] << 8));
+      break;
+    default:
+      printf("%02X %02X %02X\n", r.p[0], r.p[1], r.p[2]);
+      break;
+  }
+}
+
+int main(int argc, char** argv) {
+  bool list = false;
+  const char* path = NULL;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--list")) list = true;
+    else path = argv[i];
+  }
+  if (!path) {
+    fprintf(stderr, "Usage: hid_trace_decode [--list] FILE   (FILE = - for stdin)\n");
+    return 2;
+  }
+
+  std::vector<uint8_t> raw;
+  if (!readAll(path, raw)) {
+    fprintf(stderr, "Cannot read %s\n", path);
+    return 1;
+  }
+  std::vector<uint8_t> dump;
+  if (raw.size() >= 3 && raw[0] == 'G' && raw[1] == 'H' && raw[2] == 'T') {
+    dump.swap(raw);
+  } else if (!extractDump(raw, dump)) {
+    fprintf(stderr, "No HIDTRACE block found in %s\n", path);
+    return 1;
+  }
+
+  uint16_t count;
+  uint32_t dropped;
+  if (!hid_trace_get_header(dump.data(), dump.size(), &count, &dropped)) {
+    fprintf(stderr, "Bad or truncated trace header\n");
+    return 1;
+  }
+  if (count == 0) {
+    printf("Trace is empty\n");
+    return 0;
+  }
+
+  Series byType[HID_TRACE_TYPE_COUNT];
+  Series all;
+  unsigned long ble = 0, usb = 0, bleFail = 0, none = 0;
+  uint32_t t0 = hid_trace_get_u32(dump.data() + HID_TRACE_HEADER_SIZE);
+  uint32_t tLast = t0;
+
+  for (uint16_t i = 0; i < count; i++) {
+    HidTraceRecord r = hid_trace_get_record(
+        dump.data() + HID_TRACE_HEADER_SIZE + (size_t)i * HID_TRACE_RECORD_SIZE);
+    uint8_t type = hid_trace_type(r.meta);
+    uint8_t flags = hid_trace_flags(r.meta);
+    if (list) listRecord(r, t0);
+    if (type < HID_TRACE_TYPE_COUNT) byType[type].add(r.us);
+    all.add(r.us);
+    if (flags & HID_TRACE_BLE) ble++;
+    if (flags & HID_TRACE_USB) usb++;
+    if (flags & HID_TRACE_BLE_FAIL) bleFail++;
+    if (!(flags & (HID_TRACE_BLE | HID_TRACE_USB))) none++;
+    tLast = r.us;
+  }
+
+  printf("%u reports over %.3f s (%lu older reports overwritten)\n",
+         count, (tLast - t0) / 1e6, (unsigned long)dropped);
+  printf("Transport: BLE %lu (notify failed %lu), USB %lu, not sent %lu\n\n",
+         ble, bleFail, usb, none);
+  printf("Inter-report interval (ms)\n");
+  printf("%-10s %7s %9s %9s %9s %9s %9s %10s %9s\n",
+         "type", "count", "min", "p50", "p95", "p99", "p99.9", "max", "mean");
+  for (uint8_t t = 0; t < HID_TRACE_TYPE_COUNT; t++) printSeries(TYPE_NAMES[t], byType[t]);
+  printSeries("all", all);
+  return 0;
+}
@@ -0,0 +1,205 @@
+// ============================================================================
+// Mouse trace packer — converts a real mouse capture into a Replay trace
+//
+// Input is either CSV "t_ms,dx,dy" per line (--abs: "t_ms,x,y" positions)
+// or `libinput debug-events` output, whose POINTER_MOTION lines are used.
+// Samples are rebucketed to --period ms, fractional motion is carried to the
+// next sample, and the result is encoded in the src/common/mouse_trace_pure.h
+// format. Upload with the printed !mtrace lines (NUS / serial / dashboard).
+//
+//   make tracepack ARGS="capture.csv --lines 0"
+//   .pio/mouse_trace_pack [--abs] [--period MS] [--max-gap MS]
+//                         [-o OUT.bin] [--lines SLOT] FILE   (FILE = - for stdin)
+// ============================================================================
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <vector>
+#include "mouse_trace_pure.h"
+
+#define LINE_CHUNK_BYTES 192   // raw bytes per !mtrace line (256 base64 chars)
+
+struct RawSample {
+  double tMs, dx, dy;
+};
+
+static bool readAll(const char* path, std::string& out) {
+  FILE* f = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+  if (!f) return false;
+  char buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) out.append(buf, n);
+  if (f != stdin) fclose(f);
+  return true;
+}
+
+// " event9   POINTER_MOTION   +1.234s   1.50/ -0.75 ( +1.50/ -0.75)"
+static bool parseLibinput(const std::string& line, RawSample& s) {
+  size_t k = line.find("POINTER_MOTION");
+  if (k == std::string::npos) return false;
+  size_t plus = line.find('+', k);
+  if (plus == std::string::npos) return false;
+  double t;
+  if (sscanf(line.c_str() + plus + 1, "%lfs", &t) != 1) return false;
+  size_t sp = line.find('s', plus);
+  if (sp == std::string::npos) return false;
+  double dx, dy;
+  if (sscanf(line.c_str() + sp + 1, " %lf/ %lf", &dx, &dy) != 2) return false;
+  s.tMs = t * 1000.0;
+  s.dx = dx;
+  s.dy = dy;
+  return true;
+}
+
+static bool parseCsv(const std::string& line, RawSample& s) {
+  return sscanf(line.c_str(), " %lf , %lf , %lf", &s.tMs, &s.dx, &s.dy) == 3;
+}
+
+static void b64Encode(const uint8_t* in, size_t len, std::string& out) {
+  static const char* A = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  for (size_t i = 0; i < len; i += 3) {
+    size_t remaining = len - i;
+    uint32_t n = (uint32_t)in[i] << 16;
+    if (remaining > 1) n |= (uint32_t)in[i + 1] << 8;
+    if (remaining > 2) n |= in[i + 2];
+    out += A[(n >> 18) & 63];
+    out += A[(n >> 12) & 63];
+    out += remaining > 1 ? A[(n >> 6) & 63] : '=';
+    out += remaining > 2 ? A[n & 63] : '=';
+  }
+}
+
+static int usage() {
+  fprintf(stderr, "usage: mouse_trace_pack [--abs] [--period MS] [--max-gap MS] "
+                  "[-o OUT.bin] [--lines SLOT] FILE\n");
+  return 2;
+}
+
+int main(int argc, char** argv) {
+  const char* path = NULL;
+  const char* outPath = NULL;
+  bool absolute = false;
+  int slot = -1;
+  double periodMs = 8, maxGapMs = 250;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--abs")) absolute = true;
+    else if (!strcmp(argv[i], "--period") && i + 1 < argc) periodMs = atof(argv[++i]);
+    else if (!strcmp(argv[i], "--max-gap") && i + 1 < argc) maxGapMs = atof(argv[++i]);
+    else if (!strcmp(argv[i], "-o") && i + 1 < argc) outPath = argv[++i];
+    else if (!strcmp(argv[i], "--lines") && i + 1 < argc) slot = atoi(argv[++i]);
+    else if (argv[i][0] == '-' && argv[i][1]) return usage();
+    else path = argv[i];
+  }
+  if (!path || periodMs < 1 || maxGapMs < periodMs
+      || slot >= MOUSE_TRACE_SLOTS) return usage();
+
+  std::string text;
+  if (!readAll(path, text)) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 1;
+  }
+
+  // Parse; libinput wins if any line looks like it
+  bool libinput = text.find("POINTER_MOTION") != std::string::npos;
+  std::vector<RawSample> raw;
+  size_t pos = 0;
+  while (pos < text.size()) {
+    size_t eol = text.find('\n', pos);
+    if (eol == std::string::npos) eol = text.size();
+    std::string line = text.substr(pos, eol - pos);
+    pos = eol + 1;
+    RawSample s;
+    if (libinput ? parseLibinput(line, s) : parseCsv(line, s)) raw.push_back(s);
+  }
+  if (raw.size() < 2) {
+    fprintf(stderr, "no motion samples found\n");
+    return 1;
+  }
+  if (absolute && !libinput) {
+    for (size_t i = raw.size() - 1; i > 0; i--) {
+      raw[i].dx -= raw[i - 1].dx;
+      raw[i].dy -= raw[i - 1].dy;
+    }
+    raw[0].dx = raw[0].dy = 0;
+  }
+
+  // Rebucket to the period. Idle gaps longer than max-gap are shortened so a
+  // capture with long pauses doesn't hold the device still for minutes.
+  std::vector<MouseTraceSample> out;
+  double accX = 0, accY = 0;             // fractional motion carried forward
+  double bucketEnd = raw[0].tMs + periodMs;
+  double shift = 0;                      // time removed by max-gap so far
+  uint32_t pendingDt = 0;
+  for (size_t i = 0; i < raw.size(); i++) {
+    double t = raw[i].tMs - shift;
+    if (i > 0 && t - (raw[i - 1].tMs - shift) > maxGapMs) {
+      double cut = t - (raw[i - 1].tMs - shift) - maxGapMs;
+      shift += cut;
+      t -= cut;
+    }
+    while (t >= bucketEnd) {
+      int32_t dx = (int32_t)lround(accX), dy = (int32_t)lround(accY);
+      pendingDt += (uint32_t)periodMs;
+      if (dx != 0 || dy != 0) {
+        if (dx > INT16_MAX) dx = INT16_MAX;
+        if (dx < INT16_MIN) dx = INT16_MIN;
+        if (dy > INT16_MAX) dy = INT16_MAX;
+        if (dy < INT16_MIN) dy = INT16_MIN;
+        out.push_back({pendingDt, (int16_t)dx, (int16_t)dy});
+        accX -= dx;
+        accY -= dy;
+        pendingDt = 0;
+      }
+      bucketEnd += periodMs;
+    }
+    accX += raw[i].dx;
+    accY += raw[i].dy;
+  }
+  int32_t fx = (int32_t)lround(accX), fy = (int32_t)lround(accY);
+  if (fx != 0 || fy != 0) out.push_back({pendingDt + (uint32_t)periodMs, (int16_t)fx, (int16_t)fy});
+
+  std::vector<uint8_t> bin(MOUSE_TRACE_MAX_BYTES);
+  size_t n = out.size();
+  size_t len = 0;
+  while (n > 0 && (len = mouse_trace_encode(out.data(), n, bin.data(), bin.size())) == 0) {
+    n -= n / 16 + 1;   // too big — drop the tail until it fits
+  }
+  if (len == 0) {
+    fprintf(stderr, "nothing to encode\n");
+    return 1;
+  }
+  bin.resize(len);
+
+  long netX = 0, netY = 0;
+  uint32_t durationMs = 0;
+  for (size_t i = 0; i < n; i++) {
+    netX += out[i].dx;
+    netY += out[i].dy;
+    durationMs += out[i].dtMs;
+  }
+  fprintf(stderr, "%zu raw samples -> %zu moves, %.2f s, %zu bytes (limit %d)%s\n",
+          raw.size(), n, durationMs / 1000.0, len, MOUSE_TRACE_MAX_BYTES,
+          n < out.size() ? " — truncated" : "");
+  fprintf(stderr, "Net displacement %ld,%ld (playback returns to origin afterwards)\n",
+          netX, netY);
+
+  if (outPath) {
+    FILE* f = fopen(outPath, "wb");
+    if (!f || fwrite(bin.data(), 1, len, f) != len) {
+      fprintf(stderr, "cannot write %s\n", outPath);
+      return 1;
+    }
+    fclose(f);
+  }
+  if (slot >= 0) {
+    for (size_t off = 0; off < len; off += LINE_CHUNK_BYTES) {
+      std::string b64;
+      b64Encode(bin.data() + off, len - off < LINE_CHUNK_BYTES ? len - off : LINE_CHUNK_BYTES, b64);
+      printf("!mtrace:%d:%zu:%s\n", slot, off, b64.c_str());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,594 @@
+// ============================================================================
+// Config protocol load test — JSON round-trip latency, throughput, and HID
+// cadence under load
+//
+// Opens a serial port or pty (a device's USB CDC port, or the host emulator
+// from `make emu`) and keeps N JSON requests in flight, drawn from a weighted
+// mix of status / settings / wmode / simblocks queries and a settings write.
+// The device answers every request with exactly one line, in order, so
+// replies are matched FIFO; status pushes are counted and skipped.
+//
+// HID cadence: the HID trace ring (!hidtrace, src/common/hid_trace.h) is
+// reset and dumped once after an idle baseline and once after the load
+// phase. Mouse step intervals and key hold times are compared; a p99 rise
+// beyond --slack means protocol handling is delaying the HID tick.
+//
+//   make loadtest ARGS="/dev/ttyACM0 --concurrency 4"
+//   .pio/proto_load [options] PORT
+//
+// Exit status: 0 ok, 1 setup/IO failure, 3 HID cadence degraded under load.
+// ============================================================================
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+#include "hid_trace_pure.h"
+
+// Mouse reports further apart than this are between sweeps, not late steps
+#define STEP_GAP_MAX_US   250000UL
+// Fewer samples than this in either phase and the cadence check is skipped
+#define CADENCE_MIN_SAMPLES 10
+
+enum ReqKind { REQ_STATUS, REQ_SETTINGS, REQ_WMODE, REQ_SIMBLOCKS, REQ_SET, REQ_KIND_COUNT };
+static const char* const KIND_NAMES[REQ_KIND_COUNT] = {
+  "status", "settings", "wmode", "simblocks", "set"
+};
+
+struct Options {
+  const char* port = NULL;
+  double duration = 30;
+  double baseline = 30;
+  int concurrency = 1;
+  double rate = 0;          // requests/s cap, 0 = as fast as replies allow
+  int timeoutMs = 2000;
+  double slackMs = 5;
+  int baud = 115200;
+  unsigned weights[REQ_KIND_COUNT] = { 4, 1, 1, 1, 1 };
+  unsigned long seed = 1;
+};
+
+struct Pending {
+  ReqKind kind;
+  uint64_t sentUs;
+};
+
+struct Counters {
+  unsigned long sent = 0, replies = 0;
+  unsigned long parseErrors = 0;   // '{' lines that are not valid JSON
+  unsigned long mismatched = 0;    // valid reply of the wrong type / key
+  unsigned long errReplies = 0;    // {"t":"err"}
+  unsigned long timeouts = 0;
+  unsigned long unexpected = 0;    // reply with nothing in flight
+  unsigned long pushes = 0;
+  unsigned long otherLines = 0;    // non-JSON output (debug logs)
+  uint64_t txBytes = 0, rxBytes = 0;
+};
+
+static int fd = -1;
+static std::string rxBuf;
+static uint64_t rxTotal = 0;
+
+static uint64_t nowUs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)ts.tv_nsec / 1000ULL;
+}
+
+// xorshift32 — request mix only, independent of the firmware's streams
+static uint32_t rngState = 1;
+static uint32_t rngNext() {
+  rngState ^= rngState << 13;
+  rngState ^= rngState >> 17;
+  rngState ^= rngState << 5;
+  return rngState;
+}
+
+// ----------------------------------------------------------------------------
+// Port I/O
+// ----------------------------------------------------------------------------
+
+static speed_t baudConstant(int baud) {
+  switch (baud) {
+    case 9600:   return B9600;
+    case 57600:  return B57600;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 921600: return B921600;
+    default:     return B115200;
+  }
+}
+
+static bool openPort(const char* path, int baud) {
+  fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (fd < 0) return false;
+  struct termios tio;
+  if (tcgetattr(fd, &tio) == 0) {
+    cfmakeraw(&tio);
+    cfsetispeed(&tio, baudConstant(baud));
+    cfsetospeed(&tio, baudConstant(baud));
+    tio.c_cflag |= CLOCAL | CREAD;
+    tcsetattr(fd, TCSANOW, &tio);
+  }
+  tcflush(fd, TCIFLUSH);
+  return true;
+}
+
+static bool writeLine(const std::string& line, Counters* c) {
+  std::string out = line + "\n";
+  size_t off = 0;
+  while (off < out.size()) {
+    ssize_t n = write(fd, out.data() + off, out.size() - off);
+    if (n > 0) { off += (size_t)n; continue; }
+    if (n < 0 && (errno == EAGAIN || errno == EINTR)) {
+      struct pollfd p = { fd, POLLOUT, 0 };
+      poll(&p, 1, 10);
+      continue;
+    }
+    return false;
+  }
+  if (c) c->txBytes += out.size();
+  return true;
+}
+
+// Next complete line (CR/LF stripped), waiting at most waitMs for input
+static bool readLine(std::string& line, int waitMs) {
+  for (;;) {
+    size_t eol = rxBuf.find('\n');
+    if (eol != std::string::npos) {
+      line = rxBuf.substr(0, eol);
+      rxBuf.erase(0, eol + 1);
+      while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.pop_back();
+      return true;
+    }
+    struct pollfd p = { fd, POLLIN, 0 };
+    if (poll(&p, 1, waitMs) <= 0) return false;
+    char buf[4096];
+    ssize_t n = read(fd, buf, sizeof(buf));
+    if (n <= 0) return false;
+    rxBuf.append(buf, (size_t)n);
+    rxTotal += (uint64_t)n;
+    waitMs = 0;
+  }
+}
+
+// Wait for a line satisfying pred, skipping everything else
+template <typename Pred>
+static bool waitFor(std::string& line, int timeoutMs, Pred pred) {
+  uint64_t deadline = nowUs() + (uint64_t)timeoutMs * 1000;
+  while (nowUs() < deadline) {
+    int left = (int)((deadline - nowUs()) / 1000);
+    if (readLine(line, left > 0 ? left : 1) && pred(line)) return true;
+  }
+  return false;
+}
+
+// ----------------------------------------------------------------------------
+// Minimal JSON handling — syntax check and top-level string fields
+// ----------------------------------------------------------------------------
+
+static const char* skipWs(const char* p) {
+  while (*p == ' ' || *p == '\t') p++;
+  return p;
+}
+
+static const char* parseValue(const char* p, int depth);
+
+static const char* parseString(const char* p) {
+  if (*p != '"') return NULL;
+  for (p++; *p && *p != '"'; p++) {
+    if (*p == '\\' && *++p == '\0') return NULL;
+  }
+  return *p == '"' ? p + 1 : NULL;
+}
+
+static const char* parseValue(const char* p, int depth) {
+  if (depth > 16) return NULL;
+  p = skipWs(p);
+  if (*p == '{' || *p == '[') {
+    char close = *p == '{' ? '}' : ']';
+    p = skipWs(p + 1);
+    if (*p == close) return p + 1;
+    for (;;) {
+      if (close == '}') {
+        p = parseString(skipWs(p));
+        if (!p) return NULL;
+        p = skipWs(p);
+        if (*p++ != ':') return NULL;
+      }
+      p = parseValue(p, depth + 1);
+      if (!p) return NULL;
+      p = skipWs(p);
+      if (*p == ',') { p++; continue; }
+      return *p == close ? p + 1 : NULL;
+    }
+  }
+  if (*p == '"') return parseString(p);
+  if (!strncmp(p, "true", 4) || !strncmp(p, "null", 4)) return p + 4;
+  if (!strncmp(p, "false", 5)) return p + 5;
+  const char* start = p;
+  if (*p == '-') p++;
+  while ((*p >= '0' && *p <= '9') || *p == '.' || *p == 'e' || *p == 'E' || *p == '+' || *p == '-') p++;
+  return p > start ? p : NULL;
+}
+
+static bool jsonValid(const std::string& s) {
+  const char* end = parseValue(s.c_str(), 0);
+  return end && *skipWs(end) == '\0';
+}
+
+// Value of "key":"..." anywhere in the line. The firmware serializes compactly
+// and puts "t" and "k" first, so the first match is the top-level field.
+static std::string jsonStr(const std::string& s, const char* key) {
+  std::string pat = std::string("\"") + key + "\":\"";
+  size_t at = s.find(pat);
+  if (at == std::string::npos) return "";
+  at += pat.size();
+  size_t end = s.find('"', at);
+  return end == std::string::npos ? "" : s.substr(at, end - at);
+}
+
+// ----------------------------------------------------------------------------
+// HID cadence from a trace dump
+// ----------------------------------------------------------------------------
+
+struct Cadence {
+  bool valid = false;
+  uint16_t reports = 0;
+  uint32_t dropped = 0;
+  std::vector<uint32_t> mouseStepUs;   // gaps between mouse reports in a sweep
+  std::vector<uint32_t> keyHoldUs;     // key press → release
+};
+
+static bool captureTrace(Cadence& out, int timeoutMs) {
+  if (!writeLine("!hidtrace", NULL)) return false;
+  std::string line;
+  if (!waitFor(line, timeoutMs, [](const std::string& l) {
+        return l == "--- HIDTRACE START ---" || l.compare(0, 4, "-err") == 0;
+      })) return false;
+  if (line[0] == '-' && line[1] == 'e') return false;
+
+  std::vector<uint8_t> dump;
+  for (;;) {
+    if (!waitFor(line, timeoutMs, [](const std::string&) { return true; })) return false;
+    if (line == "--- HIDTRACE END ---") break;
+    uint8_t bytes[HID_TRACE_B64_LINE_MAX / 4 * 3];
+    if (line.size() > HID_TRACE_B64_LINE_MAX) continue;
+    int n = hid_trace_b64_decode_line(line.data(), line.size(), bytes);
+    if (n > 0) dump.insert(dump.end(), bytes, bytes + n);
+  }
+
+  if (!hid_trace_get_header(dump.data(), dump.size(), &out.reports, &out.dropped)) return false;
+  bool haveMouse = false, keyDown = false;
+  uint32_t lastMouse = 0, pressUs = 0;
+  for (uint16_t i = 0; i < out.reports; i++) {
+    HidTraceRecord r = hid_trace_get_record(
+        dump.data() + HID_TRACE_HEADER_SIZE + (size_t)i * HID_TRACE_RECORD_SIZE);
+    uint8_t type = hid_trace_type(r.meta);
+    if (type == HID_TRACE_MOUSE) {
+      uint32_t gap = r.us - lastMouse;
+      if (haveMouse && gap < STEP_GAP_MAX_US) out.mouseStepUs.push_back(gap);
+      lastMouse = r.us;
+      haveMouse = true;
+    } else if (type == HID_TRACE_KEYBOARD) {
+      bool down = r.p[0] || r.p[1] || r.p[2];
+      if (down && !keyDown) pressUs = r.us;
+      if (!down && keyDown) out.keyHoldUs.push_back(r.us - pressUs);
+      keyDown = down;
+    }
+  }
+  out.valid = true;
+  return true;
+}
+
+static bool resetTrace(int timeoutMs) {
+  if (!writeLine("!hidtracereset", NULL)) return false;
+  std::string line;
+  return waitFor(line, timeoutMs, [](const std::string& l) {
+    return l == "+ok" || l.compare(0, 4, "-err") == 0;
+  }) && line == "+ok";
+}
+
+// ----------------------------------------------------------------------------
+// Reporting
+// ----------------------------------------------------------------------------
+
+static double pct(std::vector<uint32_t>& v, double p) {
+  if (v.empty()) return 0;
+  size_t idx = (size_t)(p / 100.0 * (v.size() - 1) + 0.5);
+  return v[idx];
+}
+
+static void printLatency(const char* name, std::vector<uint32_t>& v) {
+  if (v.empty()) return;
+  std::sort(v.begin(), v.end());
+  printf("%-10s %7zu %9.2f %9.2f %9.2f %9.2f\n", name, v.size(),
+         pct(v, 50) / 1000.0, pct(v, 95) / 1000.0, pct(v, 99) / 1000.0, v.back() / 1000.0);
+}
+
+static void printCadenceRow(const char* name, std::vector<uint32_t>& base, std::vector<uint32_t>& load) {
+  std::sort(base.begin(), base.end());
+  std::sort(load.begin(), load.end());
+  printf("%-11s %6zu %8.2f %8.2f %8.2f   %6zu %8.2f %8.2f %8.2f\n", name,
+         base.size(), pct(base, 50) / 1000.0, pct(base, 99) / 1000.0,
+         base.empty() ? 0 : base.back() / 1000.0,
+         load.size(), pct(load, 50) / 1000.0, pct(load, 99) / 1000.0,
+         load.empty() ? 0 : load.back() / 1000.0);
+}
+
+// p99 rise in ms, or 0 when either phase has too few samples to compare
+static double p99Rise(std::vector<uint32_t>& base, std::vector<uint32_t>& load) {
+  if (base.size() < CADENCE_MIN_SAMPLES || load.size() < CADENCE_MIN_SAMPLES) return 0;
+  return (pct(load, 99) - pct(base, 99)) / 1000.0;
+}
+
+// ----------------------------------------------------------------------------
+// Main
+// ----------------------------------------------------------------------------
+
+static void usage() {
+  fprintf(stderr,
+    "Usage: proto_load [options] PORT\n"
+    "  --duration S      load phase length (default 30)\n"
+    "  --baseline S      idle phase for the HID cadence baseline; 0 skips the\n"
+    "                    cadence check (default 30)\n"
+    "  --concurrency N   requests in flight (default 1)\n"
+    "  --rate N          cap on requests/s (default 0 = unlimited)\n"
+    "  --mix a:b:c:d:e   weights for status:settings:wmode:simblocks:set\n"
+    "                    (default 4:1:1:1:1)\n"
+    "  --timeout MS      per-request timeout (default 2000)\n"
+    "  --slack MS        allowed HID p99 rise under load (default 5)\n"
+    "  --baud N          serial baud rate (default 115200; ignored by USB CDC)\n"
+    "  --seed N          request mix seed\n");
+}
+
+static bool parseMix(const char* s, unsigned* w) {
+  unsigned total = 0;
+  for (int i = 0; i < REQ_KIND_COUNT; i++) {
+    char* end;
+    w[i] = (unsigned)strtoul(s, &end, 10);
+    total += w[i];
+    if (i < REQ_KIND_COUNT - 1) {
+      if (*end != ':') return false;
+      s = end + 1;
+    } else if (*end != '\0') {
+      return false;
+    }
+  }
+  return total > 0;
+}
+
+int main(int argc, char** argv) {
+  Options opt;
+  for (int i = 1; i < argc; i++) {
+    const char* a = argv[i];
+    const char* v = (i + 1 < argc) ? argv[i + 1] : NULL;
+    if      (!strcmp(a, "--duration") && v)    { opt.duration = atof(v); i++; }
+    else if (!strcmp(a, "--baseline") && v)    { opt.baseline = atof(v); i++; }
+    else if (!strcmp(a, "--concurrency") && v) { opt.concurrency = atoi(v); i++; }
+    else if (!strcmp(a, "--rate") && v)        { opt.rate = atof(v); i++; }
+    else if (!strcmp(a, "--timeout") && v)     { opt.timeoutMs = atoi(v); i++; }
+    else if (!strcmp(a, "--slack") && v)       { opt.slackMs = atof(v); i++; }
+    else if (!strcmp(a, "--baud") && v)        { opt.baud = atoi(v); i++; }
+    else if (!strcmp(a, "--seed") && v)        { opt.seed = strtoul(v, NULL, 0); i++; }
+    else if (!strcmp(a, "--mix") && v) {
+      if (!parseMix(v, opt.weights)) { usage(); return 2; }
+      i++;
+    }
+    else if (a[0] != '-' && !opt.port) opt.port = a;
+    else { usage(); return 2; }
+  }
+  if (!opt.port || opt.concurrency < 1 || opt.duration <= 0) {
+    usage();
+    return 2;
+  }
+  rngState = opt.seed ? (uint32_t)opt.seed : 1;
+
+  if (!openPort(opt.port, opt.baud)) {
+    fprintf(stderr, "Cannot open %s: %s\n", opt.port, strerror(errno));
+    return 1;
+  }
+
+  // --- Handshake: settings gives the name to write back unchanged ---
+  std::string line;
+  writeLine("{\"t\":\"q\",\"k\":\"settings\"}", NULL);
+  if (!waitFor(line, opt.timeoutMs, [](const std::string& l) {
+        return jsonStr(l, "t") == "r" && jsonStr(l, "k") == "settings";
+      })) {
+    fprintf(stderr, "No JSON settings reply from %s\n", opt.port);
+    return 1;
+  }
+  // Name writes touch RAM only and don't reschedule the key / mouse timers,
+  // so the set path is exercised without disturbing the HID cadence
+  std::string setReq = "{\"t\":\"s\",\"d\":{\"name\":\"" + jsonStr(line, "name") + "\"}}";
+
+  // Index ranges for wmode / simblocks: probe until the device says invalid
+  unsigned wmodeCount = 0, jobCount = 0;
+  for (int pass = 0; pass < 2; pass++) {
+    const char* key = pass == 0 ? "wmode" : "simblocks";
+    unsigned& count = pass == 0 ? wmodeCount : jobCount;
+    while (count < 64) {
+      char req[64];
+      snprintf(req, sizeof(req), "{\"t\":\"q\",\"k\":\"%s\",\"i\":%u}", key, count);
+      writeLine(req, NULL);
+      if (!waitFor(line, opt.timeoutMs, [](const std::string& l) {
+            std::string t = jsonStr(l, "t");
+            return t == "r" || t == "err";
+          })) break;
+      if (jsonStr(line, "t") != "r") break;
+      count++;
+    }
+  }
+  if (wmodeCount == 0) opt.weights[REQ_WMODE] = 0;
+  if (jobCount == 0) opt.weights[REQ_SIMBLOCKS] = 0;
+  unsigned weightTotal = 0;
+  for (int k = 0; k < REQ_KIND_COUNT; k++) weightTotal += opt.weights[k];
+  if (weightTotal == 0) {
+    fprintf(stderr, "Request mix is empty\n");
+    return 1;
+  }
+
+  // --- Baseline: idle device, HID trace only ---
+  Cadence base, load;
+  bool cadence = opt.baseline > 0;
+  if (cadence && !resetTrace(opt.timeoutMs)) {
+    printf("HID trace not available (HID_TRACE_RECORDS=0?) — cadence check skipped\n");
+    cadence = false;
+  }
+  if (cadence) {
+    printf("Baseline: %.0f s idle...\n", opt.baseline);
+    fflush(stdout);
+    uint64_t end = nowUs() + (uint64_t)(opt.baseline * 1e6);
+    while (nowUs() < end) readLine(line, 50);
+    if (!captureTrace(base, opt.timeoutMs * 5) || !resetTrace(opt.timeoutMs)) {
+      printf("HID trace dump failed — cadence check skipped\n");
+      cadence = false;
+    }
+  }
+
+  // --- Load ---
+  printf("Load: %.0f s, concurrency %d%s...\n", opt.duration, opt.concurrency,
+         opt.rate > 0 ? ", rate-capped" : "");
+  fflush(stdout);
+
+  Counters c;
+  std::deque<Pending> inflight;
+  std::vector<uint32_t> rtt[REQ_KIND_COUNT];
+  std::vector<uint32_t> rttAll;
+  unsigned wmodeIdx = 0, jobIdx = 0;
+  uint64_t t0 = nowUs();
+  uint64_t loadEnd = t0 + (uint64_t)(opt.duration * 1e6);
+  uint64_t resyncUntil = 0;
+  uint64_t rxStart = rxTotal;
+
+  for (;;) {
+    uint64_t now = nowUs();
+    bool sending = now < loadEnd;
+    if (!sending && inflight.empty()) break;
+    if (!sending && now > loadEnd + (uint64_t)opt.timeoutMs * 1000) {
+      c.timeouts += inflight.size();
+      inflight.clear();
+      break;
+    }
+
+    while (sending && now >= resyncUntil && (int)inflight.size() < opt.concurrency &&
+           (opt.rate <= 0 || c.sent < (now - t0) / 1e6 * opt.rate)) {
+      uint32_t pick = rngNext() % weightTotal;
+      int kind = 0;
+      while (pick >= opt.weights[kind]) pick -= opt.weights[kind++];
+
+      char req[96];
+      switch (kind) {
+        case REQ_WMODE:
+          snprintf(req, sizeof(req), "{\"t\":\"q\",\"k\":\"wmode\",\"i\":%u}", wmodeIdx);
+          wmodeIdx = (wmodeIdx + 1) % wmodeCount;
+          break;
+        case REQ_SIMBLOCKS:
+          snprintf(req, sizeof(req), "{\"t\":\"q\",\"k\":\"simblocks\",\"i\":%u}", jobIdx);
+          jobIdx = (jobIdx + 1) % jobCount;
+          break;
+        case REQ_SET:
+          snprintf(req, sizeof(req), "%s", setReq.c_str());
+          break;
+        default:
+          snprintf(req, sizeof(req), "{\"t\":\"q\",\"k\":\"%s\"}", KIND_NAMES[kind]);
+          break;
+      }
+      if (!writeLine(req, &c)) {
+        fprintf(stderr, "Write failed: %s\n", strerror(errno));
+        return 1;
+      }
+      inflight.push_back({ (ReqKind)kind, nowUs() });
+      c.sent++;
+    }
+
+    if (readLine(line, 1)) {
+      if (line.empty() || line[0] != '{') {
+        if (!line.empty()) c.otherLines++;
+      } else if (!jsonValid(line)) {
+        c.parseErrors++;
+        if (!inflight.empty()) inflight.pop_front();
+      } else {
+        std::string t = jsonStr(line, "t");
+        if (t == "p") {
+          c.pushes++;
+        } else if (nowUs() < resyncUntil) {
+          // late reply to a request already counted as timed out
+        } else if (inflight.empty()) {
+          c.unexpected++;
+        } else {
+          Pending p = inflight.front();
+          inflight.pop_front();
+          c.replies++;
+          bool ok = p.kind == REQ_SET ? t == "ok"
+                                      : (t == "r" && jsonStr(line, "k") == KIND_NAMES[p.kind]);
+          if (t == "err") c.errReplies++;
+          else if (!ok) c.mismatched++;
+          uint32_t us = (uint32_t)(nowUs() - p.sentUs);
+          rtt[p.kind].push_back(us);
+          rttAll.push_back(us);
+        }
+      }
+    }
+
+    // Oldest request overdue: drop everything in flight and let stragglers
+    // drain so they are not matched against the next requests
+    if (!inflight.empty() && nowUs() - inflight.front().sentUs > (uint64_t)opt.timeoutMs * 1000) {
+      c.timeouts += inflight.size();
+      inflight.clear();
+      resyncUntil = nowUs() + 250000;
+    }
+  }
+  double elapsed = (nowUs() - t0) / 1e6;
+  c.rxBytes = rxTotal - rxStart;
+
+  if (cadence && !captureTrace(load, opt.timeoutMs * 5)) {
+    printf("HID trace dump failed — cadence check skipped\n");
+    cadence = false;
+  }
+
+  // --- Report ---
+  printf("\n%lu requests, %lu replies in %.1f s (%.1f req/s)\n", c.sent, c.replies,
+         elapsed, c.replies / elapsed);
+  printf("Throughput: tx %.0f B/s, rx %.0f B/s (%lu status pushes, %lu log lines)\n",
+         c.txBytes / elapsed, c.rxBytes / elapsed, c.pushes, c.otherLines);
+  printf("Errors: parse %lu, mismatched %lu, err replies %lu, timeouts %lu, unexpected %lu\n\n",
+         c.parseErrors, c.mismatched, c.errReplies, c.timeouts, c.unexpected);
+
+  printf("Round-trip latency (ms)\n");
+  printf("%-10s %7s %9s %9s %9s %9s\n", "request", "count", "p50", "p95", "p99", "max");
+  for (int k = 0; k < REQ_KIND_COUNT; k++) printLatency(KIND_NAMES[k], rtt[k]);
+  printLatency("all", rttAll);
+
+  if (!cadence) return 0;
+
+  printf("\nHID cadence (ms)              baseline                          load\n");
+  printf("%-11s %6s %8s %8s %8s   %6s %8s %8s %8s\n", "",
+         "n", "p50", "p99", "max", "n", "p50", "p99", "max");
+  printCadenceRow("mouse step", base.mouseStepUs, load.mouseStepUs);
+  printCadenceRow("key hold", base.keyHoldUs, load.keyHoldUs);
+  if (base.dropped || load.dropped) {
+    printf("(trace ring wrapped: each phase covers its last %u / %u reports)\n",
+           base.reports, load.reports);
+  }
+
+  double mouseRise = p99Rise(base.mouseStepUs, load.mouseStepUs);
+  double keyRise = p99Rise(base.keyHoldUs, load.keyHoldUs);
+  if (mouseRise > opt.slackMs || keyRise > opt.slackMs) {
+    printf("\nHID cadence DEGRADED under load: p99 mouse step %+.2f ms, key hold %+.2f ms "
+           "(slack %.1f ms)\n", mouseRise, keyRise, opt.slackMs);
+    return 3;
+  }
+  printf("\nHID cadence OK: p99 mouse step %+.2f ms, key hold %+.2f ms (slack %.1f ms)\n",
+         mouseRise, keyRise, opt.slackMs);
+  return 0;
+}